@@ -94,6 +94,14 @@ void CmPerfStatistics::InsertPerfStatistic(ApiCallRecord *record)
             { // existing
                perfStatisticRecords->callTimes ++ ;
                perfStatisticRecords->time += record->duration;
+               if (record->duration < perfStatisticRecords->minTime)
+               {
+                   perfStatisticRecords->minTime = record->duration;
+               }
+               if (record->duration > perfStatisticRecords->maxTime)
+               {
+                   perfStatisticRecords->maxTime = record->duration;
+               }
 
                //Update statistic records
                m_perfStatisticRecords[index] = perfStatisticRecords;
@@ -110,6 +118,8 @@ void CmPerfStatistics::InsertPerfStatistic(ApiCallRecord *record)
 
         perfStatisticRecords->callTimes = 1;
         perfStatisticRecords->time       = record->duration;
+        perfStatisticRecords->minTime    = record->duration;
+        perfStatisticRecords->maxTime    = record->duration;
 
         m_perfStatisticRecords.push_back(perfStatisticRecords);
         m_perfStatisticCount ++;
@@ -164,14 +174,17 @@ void CmPerfStatistics::DumpPerfStatisticRecords()
         fprintf(stdout, "Fail to create file CmPerfStatistics.txt \n ");
         return ;
     }
-    fprintf(m_perfStatisticFile,  "%-40s %s \t %s \n", "FunctionName", "Total Time(ms)", "Called Times");
+    fprintf(m_perfStatisticFile,  "%-40s %s \t %s \t %s \t %s \t %s \n", "FunctionName", "Total Time(ms)", "Called Times",
+        "Avg Time(ms)", "Min Time(ms)", "Max Time(ms)");
 
     for(uint32_t i=0 ; i< m_perfStatisticCount; i++)
     {
         ApiPerfStatistic *perfStatisticRecords = m_perfStatisticRecords[i];
 
-        fprintf(m_perfStatisticFile,  "%-40s %fms \t %d \n", perfStatisticRecords->functionName,
-           perfStatisticRecords->time, perfStatisticRecords->callTimes);
+        fprintf(m_perfStatisticFile,  "%-40s %fms \t %d \t %fms \t %fms \t %fms \n", perfStatisticRecords->functionName,
+           perfStatisticRecords->time, perfStatisticRecords->callTimes,
+           perfStatisticRecords->time / perfStatisticRecords->callTimes,
+           perfStatisticRecords->minTime, perfStatisticRecords->maxTime);
 
         CmSafeRelease(perfStatisticRecords);
     }
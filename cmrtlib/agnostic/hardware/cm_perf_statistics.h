@@ -37,6 +37,8 @@ struct ApiPerfStatistic
 {
     char  functionName[MSG_STRING_SIZE];       // function name
     float time;                                 // accumulative api duration
+    float minTime;                              // shortest single call
+    float maxTime;                              // longest single call
     uint32_t callTimes;                           // called times
 };
 
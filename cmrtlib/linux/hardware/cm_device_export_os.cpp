@@ -105,6 +105,11 @@ CM_RT_API int32_t CreateCmDeviceFromAdapter(CmDevice* &pCmDev, uint32_t& version
 //!             vaDisplay interface. If CmDevice is created from scratch, an
 //!             internal vaDisplay interface will be created by the runtime.
 //!             Creation of more than one CmDevice for concurrent use is supported.
+//!             Each CmDevice created from scratch opens its own DRM node and runs
+//!             vaInitialize. Components in one process should create a single
+//!             VADisplay and pass it to every CreateCmDevice call. The devices then
+//!             share the display and the media driver instance, and only the
+//!             per-device CM state (queues, heaps, surfaces) is created per call.
 //!             The CM API version supported by the library will be returned
 //!             in parameter version.
 //! \param      [out] device
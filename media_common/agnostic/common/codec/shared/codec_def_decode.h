@@ -233,6 +233,8 @@ struct CodechalDecodeParams
     HANDLE                  m_gpuAppTaskEvent;
     //! \brief execution call index in multiple execution call mode
     uint32_t                m_executeCallIndex = 0;
+    //! \brief [HEVC] Short format slice params of this frame are already parsed to long format by host
+    bool                    m_hostParsedSliceParams = false;
     //! \brief [Decode Histogram] Input buffer to hold decode histogram
     MOS_SURFACE             m_histogramSurface = {};
 };
@@ -114,6 +114,16 @@ public:
 
     bool IsExpired();
 
+    //!
+    //! \brief    Wait until all held trackers expire
+    //! \details  Polls the mapped tracker resource, no lock needed
+    //! \param    [in] timeoutUs
+    //!           Timeout in us
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if expired, MOS_STATUS_STILL_DRAWING on timeout
+    //!
+    MOS_STATUS Wait(uint32_t timeoutUs);
+
     void Merge(const FrameTrackerToken *token);
 
     inline void Merge(uint32_t index, uint32_t tracker) {m_holdTrackers[index] = tracker; }
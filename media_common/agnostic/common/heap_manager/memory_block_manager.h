@@ -421,6 +421,11 @@ private:
     //! \brief Pools of memory blocks sorted by their states based on the state indicated
     //!        by the latest TrackerId. The free pool is sorted in ascending order.
     MemoryBlockInternal *m_sortedBlockList[MemoryBlockInternal::State::stateCount] = {nullptr};
+    //! \brief   Last block of the submitted list.
+    //! \details Without a producer the submitted list is kept in ascending tracker ID order,
+    //!          appended from here, so RefreshBlockStates() can stop at the first block that
+    //!          is still in flight.
+    MemoryBlockInternal *m_submittedBlockListTail = nullptr;
     //! \brief Number of entries in each sorted block list.
     uint32_t m_sortedBlockListNumEntries[MemoryBlockInternal::State::stateCount] = {0};
     //! \brief Sizes of each block pool.
@@ -387,6 +387,7 @@ typedef enum _MEDIA_EVENT
     EVENT_DECODE_DDI_SETGPUPRIORITYVA,             //! event for Decode DDI SetGpuPriority
     EVENT_DECODE_FEATURE_DECODEMODE_REPORTVA,      //! event for Decode Feature Decode Mode Report
     EVENT_DECODE_INFO_PICTUREVA,                   //! event for Decode Picture Info VA
+    EVENT_VA_INIT_STEP,                            //! event for VA driver initialization step
 } MEDIA_EVENT;
 
 typedef enum _MEDIA_EVENT_TYPE
@@ -976,6 +977,7 @@ typedef enum _MT_PARAM_ID
     MT_MEDIA_COPY_PLANE_PITCH,
     MT_MEDIA_COPY_PLANE_OFFSET,
     MT_MEDIA_COPY_LIMITATION,
+    MT_MEDIA_COPY_ENGINE,
     MT_PARAM_ID_DEC_BASE = 0x03000000,
     MT_DEC_HUC_ERROR_STATUS2,
     MT_CODEC_HAL_MODE,
@@ -22,6 +22,11 @@
 //!
 //! \file     null_hardware.h
 //! \brief    Defines interfaces for null hardware.
+//! \details  Null HW keeps the whole CPU path and still submits to the kernel;
+//!           only the GPU work is predicated off with MI_SET_PREDICATE, so it
+//!           needs a real device. For host-side cost without a GPU, run the ULT
+//!           app (devult) with --bench, which reports <platform>_us_per_frame
+//!           and command buffer counts per frame from the stubbed device.
 
 
 #ifndef __NULL_HARDWARE_H__
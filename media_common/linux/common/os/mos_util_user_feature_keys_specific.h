@@ -40,5 +40,11 @@
 #define __MEDIA_USER_FEATURE_VALUE_ENABLE_SOFTPIN       "Enable Softpin"
 #define __MEDIA_USER_FEATURE_VALUE_DISABLE_KMD_WATCHDOG "Disable KMD Watchdog"
 #define __MEDIA_USER_FEATURE_VALUE_ENABLE_VM_BIND       "Enable VM Bind"
+#define __MEDIA_USER_FEATURE_VALUE_ENABLE_ASYNC_BO_DESTROY "Enable Async BO Destroy"
+#define __MEDIA_USER_FEATURE_VALUE_ENABLE_ASYNC_SUBMISSION "Enable Async Submission"
+#define __MEDIA_USER_FEATURE_VALUE_ENABLE_LOAD_AWARE_ENGINE_SELECTION "Enable Load Aware Engine Selection"
+#define __MEDIA_USER_FEATURE_VALUE_HW_SWIZZLE_THRESHOLD "HW Swizzle Threshold"
+#define __MEDIA_USER_FEATURE_VALUE_DMABUF_IMPORT_CACHE_ENTRIES "Dmabuf Import Cache Entries"
+#define __MEDIA_USER_FEATURE_VALUE_SHARE_DEVICE_CONTEXT "Share Device Context"
 
 #endif // __MOS_UTIL_USER_FEATURE_KEYS_SPECIFIC_H__
@@ -521,6 +521,8 @@ int32_t CmEventRT::GetTaskDriverId( int32_t & id )
 
 //*-----------------------------------------------------------------------------
 //| Purpose:    Query status of a task.
+//|             Looks up the HAL sync slot of m_taskDriverId directly, the flushed
+//|             task queue is not walked; QueryFlushedTasks only retires its head.
 //| Returns:    Result of the operation.
 //*-----------------------------------------------------------------------------
 int32_t CmEventRT::Query( void )
@@ -35,6 +35,7 @@ CmISHBase::CmISHBase():
     m_lockedData(nullptr),
     m_size(0),
     m_offset(0),
+    m_expandCount(0),
     m_trackerProducer(nullptr),
     m_lastTrackerToken(nullptr),
     m_addedKernelCount(0),
@@ -87,7 +88,7 @@ MOS_STATUS CmISHBase::Initialize(CM_HAL_STATE *cmhal, FrameTrackerProducer *trac
 {
     m_osInterface = cmhal->osInterface;
     m_trackerProducer = trackerProducer;
-    ExpandHeapSize(m_initSize);
+    CM_CHK_MOSSTATUS_RETURN(ExpandHeapSize(m_initSize));
 
     if (!cmhal->midThreadPreemptionDisabled)
     {
@@ -135,7 +136,7 @@ MOS_STATUS CmISHBase::LoadKernels(CmKernelEx **kernels, int count)
     }
     if (m_offset + neededSize > m_size)
     {
-        ExpandHeapSize(neededSize);
+        CM_CHK_MOSSTATUS_RETURN(ExpandHeapSize(neededSize));
     }
 
     if (!m_isSipKernelLoaded && m_sipKernelSize)
@@ -232,6 +233,15 @@ MOS_STATUS CmISHBase::ExpandHeapSize(uint32_t extraSize)
     lockParams.NoOverWrite = 1;
     lockParams.Uncached = 1;
     m_lockedData = (uint8_t*)m_osInterface->pfnLockResource(m_osInterface, m_resource, &lockParams);
+    CM_CHK_NULL_RETURN_MOSERROR(m_lockedData);
+
+    // The old heap is retired through its tracker, expansion never waits for
+    // the GPU, but every kernel has to be copied again into the new heap.
+    if (m_destroyedResources.size())
+    {
+        m_expandCount++;
+        CM_NORMALMESSAGE("ISH expanded to %u bytes, %u expansions", m_size, m_expandCount);
+    }
 
     // one new tracker token with one new resource
     m_lastTrackerToken = MOS_New(FrameTrackerToken);
@@ -44,6 +44,8 @@ public:
 
     uint32_t GetSize() {return m_size; }
 
+    uint32_t GetExpandCount() {return m_expandCount; }
+
     MOS_STATUS Refresh();
 
     inline void Submit(uint32_t trackerIndex, uint32_t tracker) {m_lastTrackerToken->Merge(trackerIndex, tracker) ; }
@@ -65,6 +67,7 @@ protected:
     uint8_t *m_lockedData;
     uint32_t m_size;
     uint32_t m_offset;
+    uint32_t m_expandCount;  // heap reallocations after the initial one
 
     // sync resources
     //uint32_t *m_latestTracker;
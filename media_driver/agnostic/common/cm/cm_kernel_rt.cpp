@@ -3512,6 +3512,9 @@ int32_t CmKernelRT::IsKernelDataReusable( CmThreadSpaceRT* threadSpace)
 
 //*-----------------------------------------------------------------------------
 //| Purpose:    Prepare Kernel Data including thread args, kernel args
+//|             m_lastKernelData is reused as is when nothing is dirty and patched
+//|             through the per argument isDirty flags by UpdateKernelData when it
+//|             is idle; it is rebuilt only while a flushed task still holds it.
 //| Returns:    Result of the operation.
 //*-----------------------------------------------------------------------------
 int32_t CmKernelRT::CreateKernelData(
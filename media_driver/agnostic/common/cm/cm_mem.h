@@ -215,17 +215,17 @@ inline int CmSafeMemCompare( const void* dst, const void* src, const size_t byte
 
 /*****************************************************************************\
 Inline Function:
-    GetCpuInstructionLevel
+    QueryCpuInstructionLevel
 
 Description:
-    Returns the highest level of IA32 intruction extensions supported by the CPU
-    ( i.e. SSE, SSE2, SSE4, etc )
+    Queries CPUID for the highest level of IA32 intruction extensions supported
+    by the CPU ( i.e. SSE, SSE2, SSE4, etc )
 
 Output:
     CPU_INSTRUCTION_LEVEL - highest level of IA32 instruction extension(s) supported
     by CPU
 \*****************************************************************************/
-inline CPU_INSTRUCTION_LEVEL GetCpuInstructionLevel( void )
+inline CPU_INSTRUCTION_LEVEL QueryCpuInstructionLevel( void )
 {
     int cpuInfo[4];
     memset( cpuInfo, 0, 4*sizeof(int) );
@@ -257,6 +257,25 @@ inline CPU_INSTRUCTION_LEVEL GetCpuInstructionLevel( void )
     return cpuInstructionLevel;
 }
 
+/*****************************************************************************\
+Inline Function:
+    GetCpuInstructionLevel
+
+Description:
+    Returns the highest level of IA32 intruction extensions supported by the CPU.
+    CPUID is serializing and traps to the hypervisor in a VM, and surface reads
+    pass the level on every row, so it is queried only once.
+
+Output:
+    CPU_INSTRUCTION_LEVEL - highest level of IA32 instruction extension(s) supported
+    by CPU
+\*****************************************************************************/
+inline CPU_INSTRUCTION_LEVEL GetCpuInstructionLevel( void )
+{
+    static const CPU_INSTRUCTION_LEVEL cpuInstructionLevel = QueryCpuInstructionLevel();
+    return cpuInstructionLevel;
+}
+
 /*****************************************************************************\
 Inline Function:
     Round
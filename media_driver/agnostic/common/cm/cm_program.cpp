@@ -58,6 +58,9 @@ namespace CMRT_UMD
 //|               size              [in]     Size of memory
 //|               pProgram          [in]     Reference to pointer to CmProgram
 //|               options           [in]     jitter or non-jitter
+//|             With "nojitter" the GenX binaries embedded in the ISA file by the
+//|             offline compiler are used and the jitter library is never loaded,
+//|             which is the way to avoid JIT cost at every process start.
 //| Returns:    Result of the operation.
 //*-----------------------------------------------------------------------------
 int32_t CmProgramRT::Create( CmDeviceRT* device, void* cisaCode, const uint32_t cisaCodeSize, CmProgramRT*& pProgram,  const char* options, const uint32_t programId )
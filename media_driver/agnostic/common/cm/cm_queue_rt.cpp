@@ -970,6 +970,13 @@ CM_RT_API int32_t CmQueueRT::EnqueueWithGroup( CmTask* task, CmEvent* & event, c
     return result;
 }
 
+//*-----------------------------------------------------------------------------
+//| Purpose:    Enqueue a task whose kernels share one media walker, optionally
+//|             split into CM_HINTS_MASK_NUM_TASKS sub tasks with one event.
+//|             Per slice walkers are not generated, the hardware thread dispatcher
+//|             already spreads a single walker across all enabled slices.
+//| Returns:    Result of the operation.
+//*-----------------------------------------------------------------------------
 CM_RT_API int32_t CmQueueRT::EnqueueWithHints(
                                         CmTask* kernelArray,
                                         CmEvent* & event,
@@ -2804,6 +2811,10 @@ finish:
 //! Flush a geneal task to HAL CM layer for execution.
 //! This is a non-blocking call. i.e. it returs immediately without waiting for
 //! GPU to finish the execution of tasks.
+//! Each task is one HAL submission with one task id and sync slot, which is
+//! what its event tracks. Small kernels are batched by adding them to one
+//! CmTask, every kernel of a task gets its own media state in the same
+//! command buffer.
 //! INPUT: task -- Pointer to CmTaskInternal object
 //! OUTPUT:
 //!     CM_SUCCESS if all tasks in the queue are submitted
@@ -3617,6 +3628,10 @@ CM_RT_API int32_t CmQueueRT::EnqueueCopyGPUToCPUFullStride( CmSurface2D* surface
 //*---------------------------------------------------------------------------------------------------------
 //| Name:       CreateGPUCopyKernel()
 //| Purpose:    Create GPUCopy kernel, reuse the kernel if it has been created and resuable
+//|             The copy program is preloaded by CmDeviceRT::Initialize unless the
+//|             device is created with CM_DEVICE_CONFIG_GPUCOPY_DISABLE, so a miss here
+//|             only creates the kernel object. Kernels stay per queue because their
+//|             arguments are rewritten per copy while a task holds them locked.
 //| Arguments:
 //|             widthInByte      [in]  surface's width in bytes
 //|             height           [in]  surface's height
@@ -1444,6 +1444,10 @@ int32_t CmSurfaceManagerBase::DestroySurface( CmBuffer_RT* & buffer,
 
 //*-----------------------------------------------------------------------------
 //| Purpose:    Destroy Surface2d up in SurfaceManager
+//|             The userptr BO is released rather than cached: once the surface
+//|             is destroyed the application may free the memory, and a new
+//|             allocation at the same address is backed by different pages.
+//|             Applications recycling host buffers keep the surface alive.
 //| Returns:    Result of the operation.
 //*-----------------------------------------------------------------------------
 int32_t CmSurfaceManagerBase::DestroySurface( CmSurface2DUPRT* & surface2dUP,
@@ -1501,6 +1505,8 @@ int32_t CmSurfaceManagerBase::DestroySurface( CmSurface2DUPRT* & surface2dUP,
 
 //*-----------------------------------------------------------------------------
 //| Purpose:    Destroy surface  in SurfaceManager
+//|             The freed BO goes back to the size bucketed reuse cache of the
+//|             bufmgr, so a same sized surface created next frame recycles it.
 //| Returns:    Result of the operation.
 //*-----------------------------------------------------------------------------
 int32_t CmSurfaceManagerBase::DestroySurface( CmSurface2DRT* & surface2d,
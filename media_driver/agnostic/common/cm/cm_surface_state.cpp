@@ -1310,6 +1310,8 @@ MOS_STATUS CmSurfaceState2Dor3D::UpdateSurfaceState()
                 else if (m_mmcState == MOS_MEMCOMP_MC ||
                      m_mmcState == MOS_MEMCOMP_RC)
                 {
+                    // Bind the compressed surface in place, e.g. a media
+                    // compressed NV12/P010 decode output, without a resolve.
                     SurfStateParams.MmcState = m_mmcState;
 
                     if (m_planeParams[idx].planeID == MHW_U_PLANE && 
@@ -371,7 +371,11 @@ public:
 
     //!
     //! \brief    Send long format Slice level commands
-    //! \details  Send long format Slice level commands in HEVC decode driver
+    //! \details  Send long format Slice level commands in HEVC decode driver.
+    //!           Called once per slice straight into the primary command buffer.
+    //!           Nearly every HCP_SLICE_STATE, REF_IDX and WEIGHTOFFSET field is taken
+    //!           from the slice params, so there is no per-slice template to reuse;
+    //!           the per-slice cost is the MHW command packing itself.
     //!
     //! \param    [out] cmdBuffer
     //!           Pointer to Command buffer
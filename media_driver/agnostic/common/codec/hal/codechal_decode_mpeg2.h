@@ -236,7 +236,10 @@ public:
 
     //!
     //! \brief    Copy bitstream to local buffer
-    //! \details  Copy bitstream to local buffer in MPEG2 decode driver
+    //! \details  Copy bitstream to local buffer in MPEG2 decode driver.
+    //!           Only used for incomplete pictures and error concealment; complete
+    //!           frames are decoded from the app buffer in place. The copy is done
+    //!           on the GPU (HuC, or the driver copy path where HuC is absent).
     //!
     //! \return   MOS_STATUS
     //!           MOS_STATUS_SUCCESS if success, else fail reason
@@ -538,7 +538,10 @@ protected:
 
     //!
     //! \brief    Initialise bitstream for VC1 decoder
-    //! \details  Initialise members' value of bitstream struct for VC1 decoder
+    //! \details  Initialise members' value of bitstream struct for VC1 decoder.
+    //!           buffer is the locked app data buffer, read in place; only the bits
+    //!           consumed by header parsing are staged, a few DWORDs at a time, by
+    //!           UpdateBitstreamBuffer. Slice data itself is never copied or scanned.
     //! \param    [in] buffer
     //!           Original bitstream buffer
     //! \param    [in] length
@@ -171,6 +171,10 @@ public:
 
     //!
     //! \brief    SW scoreboard init kernel function
+    //! \details  The surface for each surfaceIndex is allocated once and reused,
+    //!           but its contents are not: MbEnc binds it writable and updates the
+    //!           scoreboard as threads retire, so it has to be re-initialized before
+    //!           every MbEnc dispatch even when size and pattern are unchanged.
     //!
     //! \param    [in] params
     //!           Pointer to KernelParams
@@ -141,6 +141,10 @@ static uint32_t codechalEncodeSearchPath[2][8][16] =
 //!
 //! \class    CodechalKernelHme
 //! \brief    Codechal kernel hme
+//! \details  HME runs per encoder instance on its own downscaled surfaces. To
+//!           share motion analysis between encodes of one source, run AVC FEI
+//!           PreEnc once and feed its MV output to each encode as the FEI MV
+//!           predictor buffer (MVPredictorEnable).
 //!
 class CodechalKernelHme : public CodechalKernelBase
 {
@@ -952,13 +952,9 @@ MOS_STATUS RenderHal_DSH_RefreshSync(PRENDERHAL_INTERFACE pRenderHal)
                 uint64_t uiDiff;
                 double  TimeMS;
                 uint32_t uiComponent;
-                uint32_t performanceSize = sizeof(uint64_t) * 2 + sizeof(RENDERHAL_COMPONENT);
-                uint8_t *data = (uint8_t*)MOS_AllocAndZeroMemory(performanceSize);
-                if (data == nullptr)
-                {
-                    eStatus = MOS_STATUS_NO_SPACE;
-                    goto finish;
-                }
+                // Small enough to live on the stack, this runs for every retired media state
+                uint8_t data[sizeof(uint64_t) * 2 + sizeof(RENDERHAL_COMPONENT)] = {};
+                uint32_t performanceSize = sizeof(data);
                 // Dump Kernel execution time when media state is being freed
                 pDynamicState->memoryBlock.ReadData(data, pDynamicState->Performance.dwOffset, performanceSize);
                 pCurrentPtr = data;
@@ -978,8 +974,6 @@ MOS_STATUS RenderHal_DSH_RefreshSync(PRENDERHAL_INTERFACE pRenderHal)
 
                     pRenderHal->kernelTime[uiComponent] += TimeMS;
                 }
-
-                MOS_SafeFreeMemory(data);
             }
 
             // Detach from submitted states, return to pool
@@ -1292,8 +1286,7 @@ PRENDERHAL_KRN_ALLOCATION RenderHal_DSH_LoadDynamicKernel(
     // Kernel already loaded
     if (pKernelAllocation)
     {
-        // found match and Update kernel usage
-        pRenderHal->pfnTouchDynamicKernel(pRenderHal, pKernelAllocation);
+        // Usage is updated once on exit, same as for a newly loaded kernel
 
         // Increment reference counter
         pKernel->bLoaded = 1;
@@ -133,11 +133,12 @@ MOS_STATUS Configure::Read(Value &value,
     int32_t     ret     = 0;
     MOS_STATUS  status  = MOS_STATUS_SUCCESS;
     auto        &defs   = GetDefinitions(group);
-    auto        def     = defs[MakeHash(valueName)];
-    if (def == nullptr)
+    auto        it      = defs.find(MakeHash(valueName));
+    if (it == defs.end() || it->second == nullptr)
     {
         return MOS_STATUS_INVALID_HANDLE;
     }
+    auto        def     = it->second;
     auto        defaultType = def->DefaultValue().ValueType();
 
     if (def->IsDebugOnly() && !m_isDebugMode)
@@ -197,11 +198,12 @@ MOS_STATUS Configure::Write(
 {
     auto &defs = GetDefinitions(group);
 
-    auto def = defs[MakeHash(valueName)];
-    if (def == nullptr)
+    auto it = defs.find(MakeHash(valueName));
+    if (it == defs.end() || it->second == nullptr)
     {
         return MOS_STATUS_INVALID_HANDLE;
     }
+    auto def = it->second;
 
     if (def->IsDebugOnly() && !m_isDebugMode)
     {
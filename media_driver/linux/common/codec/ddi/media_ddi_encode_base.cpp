@@ -166,6 +166,21 @@ VAStatus DdiEncodeBase::StatusReport(
 
     m_encodeCtx->BufMgr.pCodedBufferSegment->status    = 0;
 
+    // The frame currently bound to this buffer was resolved by an earlier map, reuse its slot
+    // instead of scanning and re-querying the status report queue
+    int32_t cachedIndex = (int32_t)mediaBuf->uiCodedReportSlot - 1;
+    if ((cachedIndex >= 0) && (cachedIndex < DDI_ENCODE_MAX_STATUS_REPORT_BUFFER) &&
+        (m_encodeCtx->statusReportBuf.infos[cachedIndex].pCodedBuf == (void *)mediaBuf->bo) &&
+        (m_encodeCtx->statusReportBuf.infos[cachedIndex].uiSize != 0))
+    {
+        m_encodeCtx->BufMgr.pCodedBufferSegment->buf    = DdiMediaUtil_LockBuffer(mediaBuf, MOS_LOCKFLAG_READONLY);
+        m_encodeCtx->BufMgr.pCodedBufferSegment->size   = m_encodeCtx->statusReportBuf.infos[cachedIndex].uiSize;
+        m_encodeCtx->BufMgr.pCodedBufferSegment->status = m_encodeCtx->statusReportBuf.infos[cachedIndex].uiStatus;
+        *buf = m_encodeCtx->BufMgr.pCodedBufferSegment;
+        return VA_STATUS_SUCCESS;
+    }
+    mediaBuf->uiCodedReportSlot = 0;
+
     //when this function is called, there must be a frame is ready, will wait until get the right information.
     uint32_t size         = 0;
     int32_t  index        = 0;
@@ -187,6 +202,7 @@ VAStatus DdiEncodeBase::StatusReport(
             {
                 return VA_STATUS_ERROR_ENCODING_ERROR;
             }
+            mediaBuf->uiCodedReportSlot = index + 1;
             break;
         }
 
@@ -433,6 +449,9 @@ VAStatus DdiEncodeBase::RemoveFromStatusReportQueue(DDI_MEDIA_BUFFER *buf)
     DDI_CHK_NULL(m_encodeCtx, "Null m_encodeCtx", VA_STATUS_ERROR_INVALID_CONTEXT);
     DDI_CHK_NULL(buf, "Null buf", VA_STATUS_ERROR_INVALID_CONTEXT);
 
+    // The buffer is bound to a new frame
+    buf->uiCodedReportSlot = 0;
+
     int32_t    index  = 0;
     uint32_t   size   = 0;
     uint32_t   status = 0;
@@ -31,6 +31,9 @@
 #include "mos_cmdbufmgr.h"
 #include "media_libva_caps.h"
 
+class MediaBufferPoolNext;
+class MediaDmaBufImportCacheNext;
+
 //!
 //! \struct DDI_MEDIA_CONTEXT
 //! \brief  Media heap for shared internal structures
@@ -48,9 +51,11 @@ struct DDI_MEDIA_CONTEXT
 
     PDDI_MEDIA_HEAP     pSurfaceHeap  = nullptr;
     uint32_t            uiNumSurfaces = 0;
+    MediaDmaBufImportCacheNext *pImportCache = nullptr;
 
     PDDI_MEDIA_HEAP     pBufferHeap   = nullptr;
     uint32_t            uiNumBufs     = 0;
+    MediaBufferPoolNext *pBufferPool  = nullptr;
 
     PDDI_MEDIA_HEAP     pImageHeap    = nullptr;
     uint32_t            uiNumImages   = 0;
@@ -88,6 +93,7 @@ struct DDI_MEDIA_CONTEXT
 
     // Apogeio MOS module
     MOS_DEVICE_HANDLE   m_osDeviceContext = MOS_INVALID_HANDLE;
+    bool                m_sharedOsDevice  = false;    // m_osDeviceContext is owned by MediaSharedDeviceNext
 
     // mutexs to protect the shared resource among multiple context
     MEDIA_MUTEX_T       SurfaceMutex   = {};
@@ -168,6 +174,7 @@ struct DDI_MEDIA_CONTEXT
     AuxTableMgr         *m_auxTableMgr      = nullptr;
 
     bool                m_useSwSwizzling    = false;
+    uint32_t            m_hwSwizzleThreshold = 0;     // surfaces this big are detiled through a GPU copy, 0 disables
     bool                m_tileYFlag         = false;
 
 #if !defined(ANDROID) && defined(X11_FOUND)
@@ -31,6 +31,7 @@
 #include <sys/mman.h>
 #include <sys/ioctl.h>
 #include <unistd.h>
+#include <errno.h>
 
 #if !defined(ANDROID) && defined(X11_FOUND)
 #include <X11/Xutil.h>
@@ -72,6 +73,11 @@
 #include "media_libva_interface_next.h"
 #include "media_interfaces_hwinfo_device.h"
 #include "media_libva_caps_next.h"
+#include "media_libva_buffer_pool_next.h"
+#include "media_libva_import_cache_next.h"
+#include "media_libva_shared_device_next.h"
+#include "media_libva_lib_preload_next.h"
+#include "mos_init_trace_specific.h"
 #endif
 
 #define BO_BUSY_TIMEOUT_LIMIT 100
@@ -297,7 +303,8 @@ static uint32_t DdiMedia_CreateRenderTarget(
     uint32_t                      height,
     DDI_MEDIA_SURFACE_DESCRIPTOR *surfDesc,
     uint32_t                      surfaceUsageHint,
-    int                           memType
+    int                           memType,
+    PDDI_MEDIA_SURFACE_BATCH      batch = nullptr
 )
 {
     DdiMediaUtil_LockMutex(&mediaDrvCtx->SurfaceMutex);
@@ -327,7 +334,7 @@ static uint32_t DdiMedia_CreateRenderTarget(
     surfaceElement->pSurface->surfaceUsageHint= surfaceUsageHint;
     surfaceElement->pSurface->memType         = memType;
 
-    if(DdiMediaUtil_CreateSurface(surfaceElement->pSurface, mediaDrvCtx)!= VA_STATUS_SUCCESS)
+    if(DdiMediaUtil_CreateSurface(surfaceElement->pSurface, mediaDrvCtx, batch)!= VA_STATUS_SUCCESS)
     {
         MOS_FreeMemory(surfaceElement->pSurface);
         DdiMediaUtil_ReleasePMediaSurfaceFromHeap(mediaDrvCtx->pSurfaceHeap, surfaceElement->uiVaSurfaceID);
@@ -1411,6 +1418,17 @@ static VAStatus DdiMedia_HeapInitialize(
     DDI_CHK_NULL(mediaCtx->pMfeCtxHeap, "nullptr MfeCtxHeap", VA_STATUS_ERROR_ALLOCATION_FAILED);
     mediaCtx->pMfeCtxHeap->uiHeapElementSize = sizeof(DDI_MEDIA_VACONTEXT_HEAP_ELEMENT);
 
+    // Recycler for CPU backed parameter buffers, optional for callers
+    mediaCtx->pBufferPool = MOS_New(MediaBufferPoolNext);
+
+    uint32_t importCacheEntries = 16;
+    ReadUserSetting(
+        mediaCtx->m_userSettingPtr,
+        importCacheEntries,
+        __MEDIA_USER_FEATURE_VALUE_DMABUF_IMPORT_CACHE_ENTRIES,
+        MediaUserSetting::Group::Device);
+    mediaCtx->pImportCache = MOS_New(MediaDmaBufImportCacheNext, importCacheEntries);
+
     // init the mutexs
     DdiMediaUtil_InitMutex(&mediaCtx->SurfaceMutex);
     DdiMediaUtil_InitMutex(&mediaCtx->BufferMutex);
@@ -1439,31 +1457,33 @@ static VAStatus DdiMedia_HeapDestroy(
 {
     DDI_CHK_NULL(mediaCtx, "nullptr ctx", VA_STATUS_ERROR_INVALID_CONTEXT);
     // destroy heaps
-    MOS_FreeMemory(mediaCtx->pSurfaceHeap->pHeapBase);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pSurfaceHeap);
     MOS_FreeMemory(mediaCtx->pSurfaceHeap);
+    MOS_Delete(mediaCtx->pImportCache);
 
-    MOS_FreeMemory(mediaCtx->pBufferHeap->pHeapBase);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pBufferHeap);
     MOS_FreeMemory(mediaCtx->pBufferHeap);
+    MOS_Delete(mediaCtx->pBufferPool);
 
-    MOS_FreeMemory(mediaCtx->pImageHeap->pHeapBase);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pImageHeap);
     MOS_FreeMemory(mediaCtx->pImageHeap);
 
-    MOS_FreeMemory(mediaCtx->pDecoderCtxHeap->pHeapBase);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pDecoderCtxHeap);
     MOS_FreeMemory(mediaCtx->pDecoderCtxHeap);
 
-    MOS_FreeMemory(mediaCtx->pEncoderCtxHeap->pHeapBase);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pEncoderCtxHeap);
     MOS_FreeMemory(mediaCtx->pEncoderCtxHeap);
 
-    MOS_FreeMemory(mediaCtx->pVpCtxHeap->pHeapBase);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pVpCtxHeap);
     MOS_FreeMemory(mediaCtx->pVpCtxHeap);
 
-    MOS_FreeMemory(mediaCtx->pProtCtxHeap->pHeapBase);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pProtCtxHeap);
     MOS_FreeMemory(mediaCtx->pProtCtxHeap);
 
-    MOS_FreeMemory(mediaCtx->pCmCtxHeap->pHeapBase);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pCmCtxHeap);
     MOS_FreeMemory(mediaCtx->pCmCtxHeap);
 
-    MOS_FreeMemory(mediaCtx->pMfeCtxHeap->pHeapBase);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pMfeCtxHeap);
     MOS_FreeMemory(mediaCtx->pMfeCtxHeap);
     // destroy the mutexs
     DdiMediaUtil_DestroyMutex(&mediaCtx->SurfaceMutex);
@@ -1733,6 +1753,14 @@ VAStatus DdiMedia_InitMediaContext (
 {
     DDI_FUNCTION_ENTER();
 
+    MosInitStepTrace initTrace(MOS_INIT_STEP_TOTAL);
+
+#if !defined(ANDROID) && defined(X11_FOUND)
+    // Output libraries do not depend on the device, warm them up meanwhile
+    static const char *const outputLibs[] = {X11_LIB_NAME, LIBVA_X11_NAME, nullptr};
+    MediaLibPreloadNext outputPreload(outputLibs);
+#endif
+
     if(major_version)
     {
         *major_version = VA_MAJOR_VERSION;
@@ -1767,6 +1795,7 @@ VAStatus DdiMedia_InitMediaContext (
     mosCtx.fd              = mediaCtx->fd;
     mosCtx.m_userSettingPtr = mediaCtx->m_userSettingPtr;
 
+    MosInitStepTrace osUtilitiesTrace(MOS_INIT_STEP_OS_UTILITIES);
     MosInterface::InitOsUtilities(&mosCtx);
     mediaCtx->m_apoMosEnabled = SetupApoMosSwitch(devicefd, mediaCtx->m_userSettingPtr);
 
@@ -1784,6 +1813,7 @@ VAStatus DdiMedia_InitMediaContext (
         mosCtx.m_apoMosEnabled = mediaCtx->m_apoMosEnabled;
 
         MosOcaInterfaceSpecific::InitInterface(&mosCtx);
+        osUtilitiesTrace.End();
 
         mediaCtx->pGtSystemInfo = (MEDIA_SYSTEM_INFO *)MOS_AllocAndZeroMemory(sizeof(MEDIA_SYSTEM_INFO));
         if (nullptr == mediaCtx->pGtSystemInfo)
@@ -1792,12 +1822,26 @@ VAStatus DdiMedia_InitMediaContext (
             return VA_STATUS_ERROR_ALLOCATION_FAILED;
         }
 
-        if (MosInterface::CreateOsDeviceContext(&mosCtx, &mediaCtx->m_osDeviceContext) != MOS_STATUS_SUCCESS)
+        // Displays opened on the same device can opt in to one device context
+        bool shareDevice = false;
+        ReadUserSetting(
+            mediaCtx->m_userSettingPtr,
+            shareDevice,
+            __MEDIA_USER_FEATURE_VALUE_SHARE_DEVICE_CONTEXT,
+            MediaUserSetting::Group::Device);
+        mediaCtx->m_sharedOsDevice = shareDevice;
+
+        MosInitStepTrace deviceTrace(MOS_INIT_STEP_DEVICE_CONTEXT);
+        MOS_STATUS deviceStatus = shareDevice ?
+            MediaSharedDeviceNext::Acquire(&mosCtx, &mediaCtx->m_osDeviceContext) :
+            MosInterface::CreateOsDeviceContext(&mosCtx, &mediaCtx->m_osDeviceContext);
+        if (deviceStatus != MOS_STATUS_SUCCESS)
         {
             DDI_ASSERTMESSAGE("Unable to create MOS device context.");
             FreeForMediaContext(mediaCtx);
             return VA_STATUS_ERROR_OPERATION_FAILED;
         }
+        deviceTrace.End();
         mediaCtx->pDrmBufMgr                = mosCtx.bufmgr;
         mediaCtx->iDeviceId                 = mosCtx.iDeviceId;
         mediaCtx->SkuTable                  = mosCtx.m_skuTable;
@@ -1811,6 +1855,14 @@ VAStatus DdiMedia_InitMediaContext (
         mediaCtx->bIsAtomSOC                = mosCtx.bIsAtomSOC;
         mediaCtx->perfData                  = mosCtx.pPerfData;
 
+        uint32_t hwSwizzleThreshold = 0x800000;
+        ReadUserSetting(
+            mediaCtx->m_userSettingPtr,
+            hwSwizzleThreshold,
+            __MEDIA_USER_FEATURE_VALUE_HW_SWIZZLE_THRESHOLD,
+            MediaUserSetting::Group::Device);
+        mediaCtx->m_hwSwizzleThreshold = hwSwizzleThreshold;
+
 #ifdef _MMC_SUPPORTED
         if (mosCtx.ppMediaMemDecompState == nullptr)
         {
@@ -1824,6 +1876,8 @@ VAStatus DdiMedia_InitMediaContext (
     }
     else if (mediaCtx->modularizedGpuCtxEnabled)
     {
+        osUtilitiesTrace.End();
+
         mediaCtx->pDrmBufMgr = mos_bufmgr_gem_init(mediaCtx->fd, DDI_CODEC_BATCH_BUFFER_SIZE);
         if (nullptr == mediaCtx->pDrmBufMgr)
         {
@@ -1852,7 +1906,9 @@ VAStatus DdiMedia_InitMediaContext (
             FreeForMediaContext(mediaCtx);
             return VA_STATUS_ERROR_ALLOCATION_FAILED;
         }
+        MosInitStepTrace gfxInfoTrace(MOS_INIT_STEP_GFX_INFO);
         MOS_STATUS eStatus = HWInfo_GetGfxInfo(mediaCtx->fd, mediaCtx->pDrmBufMgr, &platform, skuTable, waTable, mediaCtx->pGtSystemInfo, mediaCtx->m_userSettingPtr);
+        gfxInfoTrace.End();
         if (MOS_STATUS_SUCCESS != eStatus)
         {
             DDI_ASSERTMESSAGE("Fatal error - unsuccesfull Sku/Wa/GtSystemInfo initialization");
@@ -1966,6 +2022,14 @@ VAStatus DdiMedia_InitMediaContext (
         mediaCtx->m_useSwSwizzling = bSimulationEnable || MEDIA_IS_SKU(&mediaCtx->SkuTable, FtrUseSwSwizzling);
         mediaCtx->m_tileYFlag      = MEDIA_IS_SKU(&mediaCtx->SkuTable, FtrTileY);
 
+        uint32_t hwSwizzleThreshold = 0x800000;
+        ReadUserSetting(
+            mediaCtx->m_userSettingPtr,
+            hwSwizzleThreshold,
+            __MEDIA_USER_FEATURE_VALUE_HW_SWIZZLE_THRESHOLD,
+            MediaUserSetting::Group::Device);
+        mediaCtx->m_hwSwizzleThreshold = hwSwizzleThreshold;
+
         mediaCtx->m_osContext = OsContext::GetOsContextObject();
         if (mediaCtx->m_osContext == nullptr)
         {
@@ -2018,13 +2082,16 @@ VAStatus DdiMedia_InitMediaContext (
         return VA_STATUS_ERROR_INVALID_PARAMETER;
     }
 
+    MosInitStepTrace heapsTrace(MOS_INIT_STEP_HEAPS);
     if (DdiMedia_HeapInitialize(mediaCtx) != VA_STATUS_SUCCESS)
     {
         DestroyMediaContextMutex(mediaCtx);
         FreeForMediaContext(mediaCtx);
         return VA_STATUS_ERROR_ALLOCATION_FAILED;
     }
+    heapsTrace.End();
 
+    MosInitStepTrace interfacesTrace(MOS_INIT_STEP_MEDIA_INTERFACES);
     //Caps need platform and sku table, especially in MediaLibvaCapsCp::IsDecEncryptionSupported
     mediaCtx->m_caps = MediaLibvaCaps::CreateMediaLibvaCaps(mediaCtx);
     if (!mediaCtx->m_caps)
@@ -2044,11 +2111,13 @@ VAStatus DdiMedia_InitMediaContext (
         return VA_STATUS_ERROR_ALLOCATION_FAILED;
     }
     ctx->max_image_formats = mediaCtx->m_caps->GetImageFormatsMaxNum();
+    interfacesTrace.End();
 
 #ifdef _MANUAL_SOFTLET_
     apoDdiEnabled = MediaLibvaApoDecision::InitDdiApoState(devicefd, mediaCtx->m_userSettingPtr);
     if(apoDdiEnabled)
     {
+        MosInitStepTrace softletTrace(MOS_INIT_STEP_SOFTLET);
         if (DdiMedia__InitializeSoftlet(mediaCtx, apoDdiEnabled) != VA_STATUS_SUCCESS)
         {
             DDI_ASSERTMESSAGE("Softlet initialize failed");
@@ -2059,6 +2128,9 @@ VAStatus DdiMedia_InitMediaContext (
 #endif
 
 #if !defined(ANDROID) && defined(X11_FOUND)
+    outputPreload.Wait();
+    MosInitStepTrace outputTrace(MOS_INIT_STEP_OUTPUT);
+
     DdiMediaUtil_InitMutex(&mediaCtx->PutSurfaceRenderMutex);
     DdiMediaUtil_InitMutex(&mediaCtx->PutSurfaceSwapBufferMutex);
 
@@ -2264,7 +2336,14 @@ VAStatus DdiMedia_Terminate (
 
     if (mediaCtx->m_apoMosEnabled)
     {
-        MosInterface::DestroyOsDeviceContext(mediaCtx->m_osDeviceContext);
+        if (mediaCtx->m_sharedOsDevice)
+        {
+            MediaSharedDeviceNext::Release(mediaCtx->m_osDeviceContext);
+        }
+        else
+        {
+            MosInterface::DestroyOsDeviceContext(mediaCtx->m_osDeviceContext);
+        }
         mediaCtx->m_osDeviceContext = MOS_INVALID_HANDLE;
         MOS_FreeMemory(mediaCtx->pGtSystemInfo);
         MosOcaInterfaceSpecific::UninitInterface();
@@ -2872,6 +2951,11 @@ VAStatus DdiMedia_CreateSurfaces2(
         return VA_STATUS_ERROR_UNSUPPORTED_RT_FORMAT;
     }
 
+    // all surfaces of the call share one shape, so their bos are created in one pass
+    DDI_MEDIA_SURFACE_BATCH surfaceBatch;
+    MOS_ZeroMemory(&surfaceBatch, sizeof(surfaceBatch));
+    surfaceBatch.count = num_surfaces;
+
     for (uint32_t i = 0; i < num_surfaces; i++)
     {
         PDDI_MEDIA_SURFACE_DESCRIPTOR surfDesc = nullptr;
@@ -2882,6 +2966,7 @@ VAStatus DdiMedia_CreateSurfaces2(
             surfDesc = (PDDI_MEDIA_SURFACE_DESCRIPTOR)MOS_AllocAndZeroMemory(sizeof(DDI_MEDIA_SURFACE_DESCRIPTOR));
             if (surfDesc == nullptr)
             {
+                DdiMediaUtil_ReleaseSurfaceBatch(&surfaceBatch);
                 return VA_STATUS_ERROR_ALLOCATION_FAILED;
             }
             surfDesc->uiFlags        = descFlag;
@@ -2922,12 +3007,14 @@ VAStatus DdiMedia_CreateSurfaces2(
                 if (eStatus != MOS_STATUS_SUCCESS)
                 {
                     DDI_VERBOSEMESSAGE("DDI:Failed to copy surface buffer data!");
+                    DdiMediaUtil_ReleaseSurfaceBatch(&surfaceBatch);
                     return VA_STATUS_ERROR_OPERATION_FAILED;
                 }
                 eStatus = MOS_SecureMemcpy(surfDesc->uiOffsets, sizeof(surfDesc->uiOffsets), externalBufDescripor.offsets, sizeof(externalBufDescripor.offsets));
                 if (eStatus != MOS_STATUS_SUCCESS)
                 {
                     DDI_VERBOSEMESSAGE("DDI:Failed to copy surface buffer data!");
+                    DdiMediaUtil_ReleaseSurfaceBatch(&surfaceBatch);
                     return VA_STATUS_ERROR_OPERATION_FAILED;
                 }
 
@@ -2938,12 +3025,13 @@ VAStatus DdiMedia_CreateSurfaces2(
                     {
                         MOS_FreeMemory(surfDesc);
                         DDI_VERBOSEMESSAGE("Buffer Address is invalid");
+                        DdiMediaUtil_ReleaseSurfaceBatch(&surfaceBatch);
                         return VA_STATUS_ERROR_INVALID_PARAMETER;
                     }
                 }
             }
         }
-        VASurfaceID vaSurfaceID = (VASurfaceID)DdiMedia_CreateRenderTarget(mediaCtx, mediaFmt, width, height, surfDesc, surfaceUsageHint, MOS_MEMPOOL_VIDEOMEMORY);
+        VASurfaceID vaSurfaceID = (VASurfaceID)DdiMedia_CreateRenderTarget(mediaCtx, mediaFmt, width, height, surfDesc, surfaceUsageHint, MOS_MEMPOOL_VIDEOMEMORY, &surfaceBatch);
         if (VA_INVALID_ID != vaSurfaceID)
         {
             surfaces[i] = vaSurfaceID;
@@ -2955,9 +3043,11 @@ VAStatus DdiMedia_CreateSurfaces2(
             {
                 MOS_FreeMemory(surfDesc);
             }
+            DdiMediaUtil_ReleaseSurfaceBatch(&surfaceBatch);
             return VA_STATUS_ERROR_ALLOCATION_FAILED;
         }
     }
+    DdiMediaUtil_ReleaseSurfaceBatch(&surfaceBatch);
 
     MOS_TraceEventExt(EVENT_VA_SURFACE, EVENT_TYPE_END, &num_surfaces, sizeof(uint32_t), surfaces, num_surfaces*sizeof(VAGenericID));
     return VA_STATUS_SUCCESS;
@@ -5168,6 +5258,27 @@ VAStatus SwizzleSurface(PDDI_MEDIA_CONTEXT mediaCtx, PGMM_RESOURCE_INFO pGmmResI
     uiPicHeight = pGmmResInfo->GetBaseHeight();
     uiSize = pGmmResInfo->GetSizeSurface();
     uiPitch = pGmmResInfo->GetRenderPitch();
+
+    // Legacy TileX/TileY without Yf/Ys is a plain swizzle of whole tile
+    // lines, which MosSwizzleData does far faster than the generic CpuBlt
+    GMM_TILE_TYPE     gmmTileType = pGmmResInfo->GetTileType();
+    GMM_RESOURCE_FLAG gmmFlags    = pGmmResInfo->GetResFlags();
+    if ((gmmTileType == GMM_TILED_Y || gmmTileType == GMM_TILED_X) &&
+        !gmmFlags.Info.TiledYf && !gmmFlags.Info.TiledYs &&
+        uiPitch != 0 && (uiSize % uiPitch) == 0)
+    {
+        MOS_TILE_TYPE tiling = (gmmTileType == GMM_TILED_Y) ? MOS_TILE_Y : MOS_TILE_X;
+        if (bUpload)
+        {
+            MosUtilities::MosSwizzleData(pResourceBase, (uint8_t *)pLockedAddr, MOS_TILE_LINEAR, tiling, uiSize / uiPitch, uiPitch, 0);
+        }
+        else
+        {
+            MosUtilities::MosSwizzleData((uint8_t *)pLockedAddr, pResourceBase, tiling, MOS_TILE_LINEAR, uiSize / uiPitch, uiPitch, 0);
+        }
+        return vaStatus;
+    }
+
     gmmResCopyBlt.Gpu.pData = pLockedAddr;
     gmmResCopyBlt.Sys.pData = pResourceBase;
     gmmResCopyBlt.Sys.RowPitch = uiPitch;
@@ -5200,15 +5311,34 @@ VAStatus SwizzleSurface(PDDI_MEDIA_CONTEXT mediaCtx, PGMM_RESOURCE_INFO pGmmResI
 //!         Source plane pitch
 //! \param  [in] height
 //!         Plane hight
+//! \param  [in] srcUncached
+//!         Source is a WC/uncached mapping, read it with streaming loads
 //!
 static void DdiMedia_CopyPlane(
     uint8_t *dst,
     uint32_t dstPitch,
     uint8_t *src,
     uint32_t srcPitch,
-    uint32_t height)
+    uint32_t height,
+    bool     srcUncached = false)
 {
     uint32_t rowSize = std::min(dstPitch, srcPitch);
+    if (srcUncached)
+    {
+        if (dstPitch == srcPitch)
+        {
+            MosUtilities::MosStreamingMemcpy(dst, src, (size_t)rowSize * height);
+            return;
+        }
+        for (uint32_t y = 0; y < height; y += 1)
+        {
+            MosUtilities::MosStreamingMemcpy(dst, src, rowSize);
+            dst += dstPitch;
+            src += srcPitch;
+        }
+        return;
+    }
+
     for (int y = 0; y < height; y += 1)
     {
         memcpy(dst, src, rowSize);
@@ -5301,7 +5431,9 @@ static VAStatus DdiMedia_CopySurfaceToImage(
         ySrc = (uint8_t*)surfData;
     }
 
-    DdiMedia_CopyPlane(yDst, image->pitches[0], ySrc, surface->iPitch, image->height);
+    // ySrc is a GPU mapping unless it was swizzled into system memory
+    bool srcUncached = (swizzleData == nullptr) && (surfData != surface->pSystemShadow);
+    DdiMedia_CopyPlane(yDst, image->pitches[0], ySrc, surface->iPitch, image->height, srcUncached);
     if (image->num_planes > 1)
     {
         uint8_t *uSrc = ySrc + surface->iPitch * surface->iHeight;
@@ -5312,13 +5444,13 @@ static VAStatus DdiMedia_CopySurfaceToImage(
         uint32_t imageChromaHeight = 0;
         DdiMedia_GetChromaPitchHeight(DdiMedia_MediaFormatToOsFormat(surface->format), surface->iPitch, surface->iHeight, &chromaPitch, &chromaHeight);
         DdiMedia_GetChromaPitchHeight(image->format.fourcc, image->pitches[0], image->height, &imageChromaPitch, &imageChromaHeight);
-        DdiMedia_CopyPlane(uDst, image->pitches[1], uSrc, chromaPitch, imageChromaHeight);
+        DdiMedia_CopyPlane(uDst, image->pitches[1], uSrc, chromaPitch, imageChromaHeight, srcUncached);
 
         if(image->num_planes > 2)
         {
             uint8_t *vSrc = uSrc + chromaPitch * chromaHeight;
             uint8_t *vDst = yDst + image->offsets[2];
-            DdiMedia_CopyPlane(vDst, image->pitches[2], vSrc, chromaPitch, imageChromaHeight);
+            DdiMedia_CopyPlane(vDst, image->pitches[2], vSrc, chromaPitch, imageChromaHeight, srcUncached);
         }
     }
 
@@ -7162,6 +7294,97 @@ static uint32_t DdiMedia_GetDrmFormatOfCompositeObject(uint32_t fourcc)
 }
 
 
+//!
+//! \brief  Fill desc from the layout cached on the surface by a previous export
+//!
+//! \param  [in] mediaCtx
+//!         Pointer to media context
+//! \param  [in] mediaSurface
+//!         Pointer to media surface
+//! \param  [in] flags
+//!         Export flags
+//! \param  [out] desc
+//!         Descriptor, objects[0].fd is a new duplicate of the cached prime fd
+//!
+//! \return bool
+//!     true if the cache matched the surface bo and flags
+//!
+static bool DdiMedia_GetCachedExportDescriptor(
+    PDDI_MEDIA_CONTEXT           mediaCtx,
+    DDI_MEDIA_SURFACE           *mediaSurface,
+    uint32_t                     flags,
+    VADRMPRIMESurfaceDescriptor *desc)
+{
+    bool hit = false;
+
+    DdiMediaUtil_LockMutex(&mediaCtx->SurfaceMutex);
+    if (mediaSurface->pExportDesc != nullptr     &&
+        mediaSurface->pExportBo == mediaSurface->bo &&
+        mediaSurface->uiExportFlags == flags)
+    {
+        // Same dma-buf as a fresh export of the bo, without the prime ioctl
+        int32_t fd = fcntl(mediaSurface->pExportDesc->objects[0].fd, F_DUPFD_CLOEXEC, 0);
+        if (fd >= 0)
+        {
+            *desc               = *mediaSurface->pExportDesc;
+            desc->objects[0].fd = fd;
+            mediaSurface->name  = fd;
+            hit                 = true;
+        }
+    }
+    DdiMediaUtil_UnLockMutex(&mediaCtx->SurfaceMutex);
+
+    return hit;
+}
+
+//!
+//! \brief  Cache desc on the surface together with a private duplicate of its prime fd
+//!
+//! \param  [in] mediaCtx
+//!         Pointer to media context
+//! \param  [in] mediaSurface
+//!         Pointer to media surface
+//! \param  [in] flags
+//!         Export flags
+//! \param  [in] desc
+//!         Descriptor just returned to the application
+//!
+static void DdiMedia_CacheExportDescriptor(
+    PDDI_MEDIA_CONTEXT           mediaCtx,
+    DDI_MEDIA_SURFACE           *mediaSurface,
+    uint32_t                     flags,
+    VADRMPRIMESurfaceDescriptor *desc)
+{
+    // The application owns desc->objects[0].fd, keep a private one
+    int32_t fd = fcntl(desc->objects[0].fd, F_DUPFD_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        return;
+    }
+
+    DdiMediaUtil_LockMutex(&mediaCtx->SurfaceMutex);
+    if (mediaSurface->pExportDesc == nullptr)
+    {
+        mediaSurface->pExportDesc = (VADRMPRIMESurfaceDescriptor *)MOS_AllocAndZeroMemory(sizeof(VADRMPRIMESurfaceDescriptor));
+    }
+    else
+    {
+        close(mediaSurface->pExportDesc->objects[0].fd);
+    }
+
+    if (mediaSurface->pExportDesc == nullptr)
+    {
+        DdiMediaUtil_UnLockMutex(&mediaCtx->SurfaceMutex);
+        close(fd);
+        return;
+    }
+    *mediaSurface->pExportDesc               = *desc;
+    mediaSurface->pExportDesc->objects[0].fd = fd;
+    mediaSurface->uiExportFlags              = flags;
+    mediaSurface->pExportBo                  = mediaSurface->bo;
+    DdiMediaUtil_UnLockMutex(&mediaCtx->SurfaceMutex);
+}
+
 //!
 //! \brief   API for export surface handle to other component
 //!
@@ -7205,13 +7428,20 @@ VAStatus DdiMedia_ExportSurfaceHandle(
         return VA_STATUS_ERROR_UNSUPPORTED_MEMORY_TYPE;
     }
 
+    VADRMPRIMESurfaceDescriptor *desc = (VADRMPRIMESurfaceDescriptor *)descriptor;
+
+    // Repeated exports of an unchanged surface skip the layout queries
+    if (DdiMedia_GetCachedExportDescriptor(mediaCtx, mediaSurface, flags, desc))
+    {
+        return VA_STATUS_SUCCESS;
+    }
+
     if (mos_bo_gem_export_to_prime(mediaSurface->bo, (int32_t*)&mediaSurface->name))
     {
         DDI_ASSERTMESSAGE("Failed drm_intel_gem_export_to_prime operation!!!\n");
         return VA_STATUS_ERROR_OPERATION_FAILED;
     }
 
-    VADRMPRIMESurfaceDescriptor *desc = (VADRMPRIMESurfaceDescriptor *)descriptor;
     desc->fourcc = DdiMedia_MediaFormatToOsFormat(mediaSurface->format);
     if(desc->fourcc == VA_STATUS_ERROR_UNSUPPORTED_RT_FORMAT)
     {
@@ -7450,6 +7680,8 @@ VAStatus DdiMedia_ExportSurfaceHandle(
         }
     }
 
+    DdiMedia_CacheExportDescriptor(mediaCtx, mediaSurface, flags, desc);
+
     return VA_STATUS_SUCCESS;
 }
 
@@ -7546,6 +7778,105 @@ MEDIAAPI_EXPORT VAStatus DdiMedia_ExtGetSurfaceHandle(
     return VA_STATUS_SUCCESS;
 }
 
+//!
+//! \brief  Export a sync_file fd signaled when the last submission using a BO completes
+//!
+static VAStatus DdiMedia_ExportBoSyncFd(MOS_LINUX_BO *bo, int32_t *fd)
+{
+    DDI_CHK_NULL(bo, "nullptr bo", VA_STATUS_ERROR_INVALID_PARAMETER);
+
+    int32_t ret = mos_gem_bo_export_sync_file(bo, fd);
+    if (ret == -ENOTSUP)
+    {
+        // Only implicit fences are known for the BO, vaSyncSurface/vaSyncBuffer still work
+        return VA_STATUS_ERROR_UNIMPLEMENTED;
+    }
+    else if (ret != 0)
+    {
+        DDI_ASSERTMESSAGE("Failed to export sync file, ret = %d", ret);
+        return VA_STATUS_ERROR_OPERATION_FAILED;
+    }
+    return VA_STATUS_SUCCESS;
+}
+
+//!
+//! \brief  Export surface sync fd
+//! \details The returned sync_file fd becomes readable once the last submission
+//!          rendering to the surface has completed, so it can be waited on
+//!          with poll/epoll instead of vaSyncSurface. The caller owns the fd.
+//!
+//! \param  [in] dpy
+//!         VA display
+//! \param  [in] surface
+//!         VA surface ID
+//! \param  [out] fd
+//!         Sync file fd
+//!
+//! \return VAStatus
+//!     VA_STATUS_SUCCESS if success, VA_STATUS_ERROR_UNIMPLEMENTED if only
+//!     vaSyncSurface can wait for the surface, else fail reason
+//!
+MEDIAAPI_EXPORT VAStatus DdiMedia_ExportSurfaceSyncFd(
+    VADisplay      dpy,
+    VASurfaceID    surface,
+    int32_t       *fd)
+{
+    DDI_CHK_NULL(dpy,                    "nullptr dpy",                    VA_STATUS_ERROR_INVALID_DISPLAY);
+    DDI_CHK_NULL(fd,                     "nullptr fd",                     VA_STATUS_ERROR_INVALID_PARAMETER);
+
+    VADriverContextP   ctx      = ((VADisplayContextP)dpy)->pDriverContext;
+    DDI_CHK_NULL(ctx,                    "nullptr ctx",                    VA_STATUS_ERROR_INVALID_CONTEXT);
+
+    PDDI_MEDIA_CONTEXT mediaCtx = DdiMedia_GetMediaContext(ctx);
+    DDI_CHK_NULL(mediaCtx,               "nullptr mediaCtx",               VA_STATUS_ERROR_INVALID_CONTEXT);
+    DDI_CHK_NULL(mediaCtx->pSurfaceHeap, "nullptr mediaCtx->pSurfaceHeap", VA_STATUS_ERROR_INVALID_CONTEXT);
+    DDI_CHK_LESS((uint32_t)surface, mediaCtx->pSurfaceHeap->uiAllocatedHeapElements, "Invalid surface", VA_STATUS_ERROR_INVALID_SURFACE);
+
+    DDI_MEDIA_SURFACE  *mediaSurface = DdiMedia_GetSurfaceFromVASurfaceID(mediaCtx, surface);
+    DDI_CHK_NULL(mediaSurface,           "nullptr mediaSurface",           VA_STATUS_ERROR_INVALID_SURFACE);
+
+    return DdiMedia_ExportBoSyncFd(mediaSurface->bo, fd);
+}
+
+//!
+//! \brief  Export buffer sync fd
+//! \details Same as DdiMedia_ExportSurfaceSyncFd for a GPU backed VA buffer,
+//!          e.g. a coded buffer, replacing a blocking vaSyncBuffer.
+//!
+//! \param  [in] dpy
+//!         VA display
+//! \param  [in] buf_id
+//!         VA buffer ID
+//! \param  [out] fd
+//!         Sync file fd
+//!
+//! \return VAStatus
+//!     VA_STATUS_SUCCESS if success, VA_STATUS_ERROR_UNIMPLEMENTED if only
+//!     vaSyncBuffer can wait for the buffer, else fail reason
+//!
+MEDIAAPI_EXPORT VAStatus DdiMedia_ExportBufferSyncFd(
+    VADisplay      dpy,
+    VABufferID     buf_id,
+    int32_t       *fd)
+{
+    DDI_CHK_NULL(dpy,                    "nullptr dpy",                    VA_STATUS_ERROR_INVALID_DISPLAY);
+    DDI_CHK_NULL(fd,                     "nullptr fd",                     VA_STATUS_ERROR_INVALID_PARAMETER);
+
+    VADriverContextP   ctx      = ((VADisplayContextP)dpy)->pDriverContext;
+    DDI_CHK_NULL(ctx,                    "nullptr ctx",                    VA_STATUS_ERROR_INVALID_CONTEXT);
+
+    PDDI_MEDIA_CONTEXT mediaCtx = DdiMedia_GetMediaContext(ctx);
+    DDI_CHK_NULL(mediaCtx,               "nullptr mediaCtx",               VA_STATUS_ERROR_INVALID_CONTEXT);
+    DDI_CHK_NULL(mediaCtx->pBufferHeap,  "nullptr mediaCtx->pBufferHeap",  VA_STATUS_ERROR_INVALID_CONTEXT);
+    DDI_CHK_LESS((uint32_t)buf_id, mediaCtx->pBufferHeap->uiAllocatedHeapElements, "Invalid buffer", VA_STATUS_ERROR_INVALID_BUFFER);
+
+    DDI_MEDIA_BUFFER   *buf          = DdiMedia_GetBufferFromVABufferID(mediaCtx, buf_id);
+    DDI_CHK_NULL(buf,                    "nullptr buf",                    VA_STATUS_ERROR_INVALID_BUFFER);
+    DDI_CHK_NULL(buf->bo,                "CPU buffers have no fence",      VA_STATUS_ERROR_UNIMPLEMENTED);
+
+    return DdiMedia_ExportBoSyncFd(buf->bo, fd);
+}
+
 //!
 //! \brief  Map buffer 2
 //! 
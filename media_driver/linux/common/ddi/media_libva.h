@@ -1622,6 +1622,40 @@ MEDIAAPI_EXPORT VAStatus DdiMedia_HybridQueryBufferAttributes(
     void        *outputData,
     uint32_t    *outputDataLen);
 
+//! \brief  Export a sync_file fd signaled when the surface's last submission completes
+//!
+//! \param  [in] dpy
+//!     VA display
+//! \param  [in] surface
+//!     VA surface ID
+//! \param  [out] fd
+//!     Sync file fd, owned by the caller
+//!
+//! \return VAStatus
+//!     VA_STATUS_SUCCESS if success, else fail reason
+//!
+MEDIAAPI_EXPORT VAStatus DdiMedia_ExportSurfaceSyncFd(
+    VADisplay    dpy,
+    VASurfaceID  surface,
+    int32_t     *fd);
+
+//! \brief  Export a sync_file fd signaled when the buffer's last submission completes
+//!
+//! \param  [in] dpy
+//!     VA display
+//! \param  [in] buf_id
+//!     VA buffer ID
+//! \param  [out] fd
+//!     Sync file fd, owned by the caller
+//!
+//! \return VAStatus
+//!     VA_STATUS_SUCCESS if success, else fail reason
+//!
+MEDIAAPI_EXPORT VAStatus DdiMedia_ExportBufferSyncFd(
+    VADisplay    dpy,
+    VABufferID   buf_id,
+    int32_t     *fd);
+
 //! \brief  Set frame ID
 //!
 //! \param  [in] ctx
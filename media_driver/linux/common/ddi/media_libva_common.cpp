@@ -35,16 +35,15 @@ static void* DdiMedia_GetVaContextFromHeap(PDDI_MEDIA_HEAP  mediaHeap, uint32_t
     PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT  vaCtxHeapElmt = nullptr;
     void                              *context = nullptr;
 
-    DdiMediaUtil_LockMutex(mutex);
+    // Heap elements never move (see MediaLibvaCommonNext::GrowHeap), no lock needed
+    MOS_UNUSED(mutex);
     if(nullptr == mediaHeap || index >= mediaHeap->uiAllocatedHeapElements)
     {
-        DdiMediaUtil_UnLockMutex(mutex);
         return nullptr;
     }
     vaCtxHeapElmt  = (PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT)mediaHeap->pHeapBase;
     vaCtxHeapElmt += index;
     context        = vaCtxHeapElmt->pVaContext;
-    DdiMediaUtil_UnLockMutex(mutex);
 
     return context;
 }
@@ -143,11 +142,9 @@ DDI_MEDIA_SURFACE* DdiMedia_GetSurfaceFromVASurfaceID (PDDI_MEDIA_CONTEXT mediaC
     if(validSurface)
     {
         DDI_CHK_LESS(i, mediaCtx->pSurfaceHeap->uiAllocatedHeapElements, "invalid surface id", nullptr);
-        DdiMediaUtil_LockMutex(&mediaCtx->SurfaceMutex);
         surfaceElement  = (PDDI_MEDIA_SURFACE_HEAP_ELEMENT)mediaCtx->pSurfaceHeap->pHeapBase;
         surfaceElement += i;
         surface         = surfaceElement->pSurface;
-        DdiMediaUtil_UnLockMutex(&mediaCtx->SurfaceMutex);
     }
 
     return surface;
@@ -195,6 +192,8 @@ PDDI_MEDIA_SURFACE DdiMedia_ReplaceSurfaceWithNewFormat(PDDI_MEDIA_SURFACE surfa
     dstSurface->uiLockedBufID = VA_INVALID_ID;
     dstSurface->uiLockedImageID = VA_INVALID_ID;
     dstSurface->pSurfDesc = nullptr;
+    dstSurface->pExportDesc = nullptr;
+    dstSurface->pExportBo = nullptr;
     //lock surface heap
     DdiMediaUtil_LockMutex(&mediaCtx->SurfaceMutex);
     uint32_t i;
@@ -310,6 +309,8 @@ PDDI_MEDIA_SURFACE DdiMedia_ReplaceSurfaceWithVariant(PDDI_MEDIA_SURFACE surface
     DDI_CHK_NULL(dstSurface, "nullptr dstSurface", nullptr);
 
     dstSurface->uiVariantFlag = 1;
+    dstSurface->pExportDesc = nullptr;
+    dstSurface->pExportBo = nullptr;
     dstSurface->format = aligned_format;
     dstSurface->iWidth = aligned_width;
     dstSurface->iHeight = aligned_height;
@@ -340,11 +341,9 @@ DDI_MEDIA_BUFFER* DdiMedia_GetBufferFromVABufferID (PDDI_MEDIA_CONTEXT mediaCtx,
 
     i                = (uint32_t)bufferID;
     DDI_CHK_LESS(i, mediaCtx->pBufferHeap->uiAllocatedHeapElements, "invalid buffer id", nullptr);
-    DdiMediaUtil_LockMutex(&mediaCtx->BufferMutex);
     bufHeapElement  = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)mediaCtx->pBufferHeap->pHeapBase;
     bufHeapElement += i;
     buf             = bufHeapElement->pBuffer;
-    DdiMediaUtil_UnLockMutex(&mediaCtx->BufferMutex);
 
     return buf;
 }
@@ -366,11 +365,9 @@ void* DdiMedia_GetContextFromVABufferID (PDDI_MEDIA_CONTEXT mediaCtx, VABufferID
 
     i                = (uint32_t)bufferID;
     DDI_CHK_LESS(i, mediaCtx->pBufferHeap->uiAllocatedHeapElements, "invalid buffer id", nullptr);
-    DdiMediaUtil_LockMutex(&mediaCtx->BufferMutex);
     bufHeapElement  = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)mediaCtx->pBufferHeap->pHeapBase;
     bufHeapElement += bufferID;
     ctx            = bufHeapElement->pCtx;
-    DdiMediaUtil_UnLockMutex(&mediaCtx->BufferMutex);
 
     return ctx;
 }
@@ -37,6 +37,7 @@
 #include "inttypes.h"
 
 #include "media_libva_util.h"
+#include "media_libva_import_cache_next.h"
 #include "mos_utilities.h"
 #include "mos_os.h"
 #include "mos_defs.h"
@@ -98,8 +99,10 @@ void DdiMediaUtil_MediaPrintFps()
         sprintf(fpsFileName, FPS_FILE_NAME);
         if ((fp = fopen(fpsFileName, "wb")) == nullptr)
         {
+            frameCountFps = -1;
             pthread_mutex_unlock(&fpsMutex);
             DDI_ASSERTMESSAGE("Unable to open fps file.");
+            return;
         }
 
         fwrite(temp, 1, strlen(temp), fp);
@@ -146,6 +149,113 @@ bool DdiMediaUtil_IsExternalSurface(PDDI_MEDIA_SURFACE surface)
     }
 }
 
+void DdiMediaUtil_ReleaseSurfaceBatch(PDDI_MEDIA_SURFACE_BATCH batch)
+{
+    if (nullptr == batch || nullptr == batch->bos)
+    {
+        return;
+    }
+
+    // unused bos go back to the bufmgr reuse cache
+    for (uint32_t i = batch->next; i < batch->allocated; i++)
+    {
+        mos_bo_unreference(batch->bos[i]);
+    }
+    MOS_FreeMemory(batch->bos);
+    batch->bos       = nullptr;
+    batch->allocated = 0;
+    batch->next      = 0;
+}
+
+//!
+//! \brief  Take a bo from a surface batch, creating the whole batch on first use
+//!
+//! \param  [in] batch
+//!         Surface batch
+//! \param  [in] bufmgr
+//!         Mos buffer manager
+//! \param  [in] gmmPitch
+//!         Pitch calculated by gmm
+//! \param  [in] gmmSize
+//!         Size calculated by gmm
+//! \param  [in,out] tileformat
+//!         Requested and returned tiling
+//! \param  [in] memType
+//!         Memory type
+//! \param  [out] pitch
+//!         Pitch of the returned bo
+//!
+//! \return MOS_LINUX_BO*
+//!     bo if the batch matches the request, nullptr otherwise
+//!
+static MOS_LINUX_BO *DdiMediaUtil_AcquireBatchedBo(
+    PDDI_MEDIA_SURFACE_BATCH    batch,
+    MOS_BUFMGR                 *bufmgr,
+    uint32_t                    gmmPitch,
+    uint32_t                    gmmSize,
+    uint32_t                   *tileformat,
+    int                         memType,
+    uint32_t                   *pitch)
+{
+    if (nullptr == batch || batch->count <= 1)
+    {
+        return nullptr;
+    }
+
+    if (nullptr == batch->bos)
+    {
+        if (batch->next != 0)
+        {
+            // the batch already exhausted or failed once, do not retry
+            return nullptr;
+        }
+
+        batch->bos = (MOS_LINUX_BO **)MOS_AllocAndZeroMemory(batch->count * sizeof(MOS_LINUX_BO *));
+        if (nullptr == batch->bos)
+        {
+            return nullptr;
+        }
+
+        unsigned long ulPitch = gmmPitch;
+        if (*tileformat == I915_TILING_NONE)
+        {
+            batch->allocated = mos_gem_bo_alloc_batch(bufmgr, "MEDIA", gmmSize, 0,
+                I915_TILING_NONE, 0, 4096, memType, batch->bos, batch->count);
+        }
+        else
+        {
+            batch->allocated = mos_gem_bo_alloc_tiled_batch(bufmgr, "MEDIA", gmmPitch,
+                (gmmSize + gmmPitch - 1) / gmmPitch, 1, tileformat, &ulPitch, 0, memType,
+                batch->bos, batch->count);
+        }
+        batch->size       = gmmSize;
+        batch->pitch      = (uint32_t)ulPitch;
+        batch->tileformat = *tileformat;
+        batch->memType    = memType;
+        batch->next       = 0;
+
+        if (batch->allocated == 0)
+        {
+            MOS_FreeMemory(batch->bos);
+            batch->bos  = nullptr;
+            batch->next = 1;
+            return nullptr;
+        }
+    }
+    else if (batch->size != gmmSize || batch->tileformat != *tileformat || batch->memType != memType)
+    {
+        return nullptr;
+    }
+
+    if (batch->next >= batch->allocated)
+    {
+        return nullptr;
+    }
+
+    *pitch = batch->pitch;
+    return batch->bos[batch->next++];
+}
+
 //!
 //! \brief  Allocate surface
 //!
@@ -159,6 +269,8 @@ bool DdiMediaUtil_IsExternalSurface(PDDI_MEDIA_SURFACE surface)
 //!         Pointer to ddi media surface
 //! \param  [in] mediaDrvCtx
 //!         Pointer to ddi media context
+//! \param  [in] batch
+//!         Optional surface batch, nullptr to allocate a single bo
 //!
 //! \return VAStatus
 //!     VA_STATUS_SUCCESS if success, else fail reason
@@ -168,7 +280,8 @@ VAStatus DdiMediaUtil_AllocateSurface(
     int32_t                     width,
     int32_t                     height,
     PDDI_MEDIA_SURFACE          mediaSurface,
-    PDDI_MEDIA_CONTEXT          mediaDrvCtx)
+    PDDI_MEDIA_CONTEXT          mediaDrvCtx,
+    PDDI_MEDIA_SURFACE_BATCH    batch)
 {
     uint32_t                    pitch = 0;
     MOS_LINUX_BO               *bo = nullptr;
@@ -348,7 +461,9 @@ VAStatus DdiMediaUtil_AllocateSurface(
             }
             else
             {
-                bo = mos_bo_gem_create_from_prime(mediaDrvCtx->pDrmBufMgr, mediaSurface->pSurfDesc->ulBuffer, mediaSurface->pSurfDesc->uiSize);
+                bo = mediaDrvCtx->pImportCache ?
+                    mediaDrvCtx->pImportCache->Import(mediaDrvCtx->pDrmBufMgr, mediaSurface->pSurfDesc->ulBuffer, mediaSurface->pSurfDesc->uiSize) :
+                    mos_bo_gem_create_from_prime(mediaDrvCtx->pDrmBufMgr, mediaSurface->pSurfDesc->ulBuffer, mediaSurface->pSurfDesc->uiSize);
             }
 
             if (bo != nullptr)
@@ -369,7 +484,9 @@ VAStatus DdiMediaUtil_AllocateSurface(
         }
         else if (mediaSurface->pSurfDesc->uiVaMemType == VA_SURFACE_ATTRIB_MEM_TYPE_DRM_PRIME_2)
         {
-            bo = mos_bo_gem_create_from_prime(mediaDrvCtx->pDrmBufMgr, mediaSurface->pSurfDesc->ulBuffer, mediaSurface->pSurfDesc->uiSize);
+            bo = mediaDrvCtx->pImportCache ?
+                mediaDrvCtx->pImportCache->Import(mediaDrvCtx->pDrmBufMgr, mediaSurface->pSurfDesc->ulBuffer, mediaSurface->pSurfDesc->uiSize) :
+                mos_bo_gem_create_from_prime(mediaDrvCtx->pDrmBufMgr, mediaSurface->pSurfDesc->ulBuffer, mediaSurface->pSurfDesc->uiSize);
             if( bo != nullptr )
             {
                 pitch = mediaSurface->pSurfDesc->uiPitches[0];
@@ -753,16 +870,21 @@ VAStatus DdiMediaUtil_AllocateSurface(
 
         mem_type = MemoryPolicyManager::UpdateMemoryPolicy(&memPolicyPar);
 
-        if ( tileformat == I915_TILING_NONE )
+        // surfaces of a burst share the gmm layout, take their bo from the batch
+        bo = DdiMediaUtil_AcquireBatchedBo(batch, mediaDrvCtx->pDrmBufMgr, gmmPitch, gmmSize, &tileformat, mem_type, &pitch);
+        if (nullptr == bo)
         {
-            bo = mos_bo_alloc(mediaDrvCtx->pDrmBufMgr, "MEDIA", gmmSize, 4096, mem_type);
-            pitch = gmmPitch;
-        }
-        else
-        {
-            unsigned long  ulPitch = 0;
-            bo = mos_bo_alloc_tiled(mediaDrvCtx->pDrmBufMgr, "MEDIA", gmmPitch, (gmmSize + gmmPitch -1)/gmmPitch, 1, &tileformat, (unsigned long *)&ulPitch, 0, mem_type);
-            pitch = ulPitch;
+            if ( tileformat == I915_TILING_NONE )
+            {
+                bo = mos_bo_alloc(mediaDrvCtx->pDrmBufMgr, "MEDIA", gmmSize, 4096, mem_type);
+                pitch = gmmPitch;
+            }
+            else
+            {
+                unsigned long  ulPitch = 0;
+                bo = mos_bo_alloc_tiled(mediaDrvCtx->pDrmBufMgr, "MEDIA", gmmPitch, (gmmSize + gmmPitch -1)/gmmPitch, 1, &tileformat, (unsigned long *)&ulPitch, 0, mem_type);
+                pitch = ulPitch;
+            }
         }
 
         mediaSurface->bMapped = false;
@@ -869,6 +991,12 @@ VAStatus DdiMediaUtil_AllocateBuffer(
         mediaBuffer->bo         = bo;
         mediaBuffer->pData      = (uint8_t*) bo->virt;
 
+        // Coded buffers are read back by the CPU every frame
+        if (mediaBuffer->uiType == VAEncCodedBufferType)
+        {
+            mos_gem_bo_set_map_hot(bo, true);
+        }
+
         DDI_VERBOSEMESSAGE("Alloc %8d bytes resource.",size);
         uint32_t event[] = {bo->handle, format, size, 1, size, bo->size, 0, 0};
         MOS_TraceEventExt(EVENT_VA_BUFFER, EVENT_TYPE_INFO, event, sizeof(event), &mediaBuffer->pGmmResourceInfo->GetResFlags(), sizeof(GMM_RESOURCE_FLAG));
@@ -988,7 +1116,7 @@ finish:
     return hRes;
 }
 
-VAStatus DdiMediaUtil_CreateSurface(DDI_MEDIA_SURFACE  *surface, PDDI_MEDIA_CONTEXT mediaDrvCtx)
+VAStatus DdiMediaUtil_CreateSurface(DDI_MEDIA_SURFACE  *surface, PDDI_MEDIA_CONTEXT mediaDrvCtx, PDDI_MEDIA_SURFACE_BATCH batch)
 {
     VAStatus hr = VA_STATUS_SUCCESS;
 
@@ -999,7 +1127,8 @@ VAStatus DdiMediaUtil_CreateSurface(DDI_MEDIA_SURFACE  *surface, PDDI_MEDIA_CONT
                          surface->iWidth,
                          surface->iHeight,
                          surface,
-                         mediaDrvCtx);
+                         mediaDrvCtx,
+                         batch);
     if (VA_STATUS_SUCCESS == hr && nullptr != surface->bo)
         surface->base = surface->name;
 
@@ -1213,7 +1342,12 @@ void* DdiMediaUtil_LockSurfaceInternal(DDI_MEDIA_SURFACE  *surface, uint32_t fla
             DDI_CHK_CONDITION((surfSize <= 0 || surface->iPitch <= 0), "Invalid surface size or pitch", nullptr);
 
             VAStatus vaStatus = VA_STATUS_SUCCESS;
-            if (MEDIA_IS_SKU(&surface->pMediaCtx->SkuTable, FtrLocalMemory))
+
+            // Large surfaces are cheaper to detile with a GPU copy into a linear
+            // staging BO than with the CPU swizzle below
+            uint32_t hwSwizzleThreshold = surface->pMediaCtx->m_hwSwizzleThreshold;
+            if (MEDIA_IS_SKU(&surface->pMediaCtx->SkuTable, FtrLocalMemory) ||
+                (hwSwizzleThreshold != 0 && surfSize >= hwSwizzleThreshold))
             {
                 if (surface->pShadowBuffer == nullptr)
                 {
@@ -1340,7 +1474,11 @@ void DdiMediaUtil_UnlockSurfaceInternal(DDI_MEDIA_SURFACE  *surface)
         }
         else if (surface->pShadowBuffer != nullptr)
         {
-            SwizzleSurfaceByHW(surface, true);
+            // Read only locks leave the surface untouched, skip the copy back
+            if (!(surface->uiMapFlag & MOS_LOCKFLAG_READONLY) || (surface->uiMapFlag & MOS_LOCKFLAG_WRITEONLY))
+            {
+                SwizzleSurfaceByHW(surface, true);
+            }
 
             mos_bo_unmap(surface->pShadowBuffer->bo);
             mos_bo_unmap(surface->bo);
@@ -1490,6 +1628,15 @@ void DdiMediaUtil_FreeSurface(DDI_MEDIA_SURFACE *surface)
         surface->pShadowBuffer = nullptr;
     }
 
+    // Drop the cached export layout and its private prime fd
+    if (surface->pExportDesc != nullptr)
+    {
+        close(surface->pExportDesc->objects[0].fd);
+        MOS_FreeMemory(surface->pExportDesc);
+        surface->pExportDesc = nullptr;
+        surface->pExportBo   = nullptr;
+    }
+
     if(surface->bMapped)
     {
         DdiMediaUtil_UnlockSurface(surface);
@@ -1632,14 +1779,11 @@ PDDI_MEDIA_SURFACE_HEAP_ELEMENT DdiMediaUtil_AllocPMediaSurfaceFromHeap(PDDI_MED
 
     if (nullptr == surfaceHeap->pFirstFreeHeapElement)
     {
-        void *newHeapBase = MOS_ReallocMemory(surfaceHeap->pHeapBase, (surfaceHeap->uiAllocatedHeapElements + DDI_MEDIA_HEAP_INCREMENTAL_SIZE) * sizeof(DDI_MEDIA_SURFACE_HEAP_ELEMENT));
-
-        if (nullptr == newHeapBase)
+        if (nullptr == MediaLibvaCommonNext::GrowHeap(surfaceHeap, sizeof(DDI_MEDIA_SURFACE_HEAP_ELEMENT), DDI_MEDIA_HEAP_INCREMENTAL_SIZE))
         {
-            DDI_ASSERTMESSAGE("DDI: realloc failed.");
+            DDI_ASSERTMESSAGE("DDI: heap grow failed.");
             return nullptr;
         }
-        surfaceHeap->pHeapBase                    = newHeapBase;
         PDDI_MEDIA_SURFACE_HEAP_ELEMENT surfaceHeapBase  = (PDDI_MEDIA_SURFACE_HEAP_ELEMENT)surfaceHeap->pHeapBase;
         surfaceHeap->pFirstFreeHeapElement        = (void*)(&surfaceHeapBase[surfaceHeap->uiAllocatedHeapElements]);
         for (int32_t i = 0; i < (DDI_MEDIA_HEAP_INCREMENTAL_SIZE); i++)
@@ -1682,13 +1826,11 @@ PDDI_MEDIA_BUFFER_HEAP_ELEMENT DdiMediaUtil_AllocPMediaBufferFromHeap(PDDI_MEDIA
     PDDI_MEDIA_BUFFER_HEAP_ELEMENT  mediaBufferHeapElmt = nullptr;
     if (nullptr == bufferHeap->pFirstFreeHeapElement)
     {
-        void *newHeapBase = MOS_ReallocMemory(bufferHeap->pHeapBase, (bufferHeap->uiAllocatedHeapElements + DDI_MEDIA_HEAP_INCREMENTAL_SIZE) * sizeof(DDI_MEDIA_BUFFER_HEAP_ELEMENT));
-        if (nullptr == newHeapBase)
+        if (nullptr == MediaLibvaCommonNext::GrowHeap(bufferHeap, sizeof(DDI_MEDIA_BUFFER_HEAP_ELEMENT), DDI_MEDIA_HEAP_INCREMENTAL_SIZE))
         {
-            DDI_ASSERTMESSAGE("DDI: realloc failed.");
+            DDI_ASSERTMESSAGE("DDI: heap grow failed.");
             return nullptr;
         }
-        bufferHeap->pHeapBase                                 = newHeapBase;
         PDDI_MEDIA_BUFFER_HEAP_ELEMENT mediaBufferHeapBase    = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)bufferHeap->pHeapBase;
         bufferHeap->pFirstFreeHeapElement     = (void*)(&mediaBufferHeapBase[bufferHeap->uiAllocatedHeapElements]);
         for (int32_t i = 0; i < (DDI_MEDIA_HEAP_INCREMENTAL_SIZE); i++)
@@ -1728,14 +1870,11 @@ PDDI_MEDIA_IMAGE_HEAP_ELEMENT DdiMediaUtil_AllocPVAImageFromHeap(PDDI_MEDIA_HEAP
 
     if (nullptr == imageHeap->pFirstFreeHeapElement)
     {
-        void *newHeapBase = MOS_ReallocMemory(imageHeap->pHeapBase, (imageHeap->uiAllocatedHeapElements + DDI_MEDIA_HEAP_INCREMENTAL_SIZE) * sizeof(DDI_MEDIA_IMAGE_HEAP_ELEMENT));
-
-        if (nullptr == newHeapBase)
+        if (nullptr == MediaLibvaCommonNext::GrowHeap(imageHeap, sizeof(DDI_MEDIA_IMAGE_HEAP_ELEMENT), DDI_MEDIA_HEAP_INCREMENTAL_SIZE))
         {
-            DDI_ASSERTMESSAGE("DDI: realloc failed.");
+            DDI_ASSERTMESSAGE("DDI: heap grow failed.");
             return nullptr;
         }
-        imageHeap->pHeapBase                           = newHeapBase;
         PDDI_MEDIA_IMAGE_HEAP_ELEMENT vaimageHeapBase  = (PDDI_MEDIA_IMAGE_HEAP_ELEMENT)imageHeap->pHeapBase;
         imageHeap->pFirstFreeHeapElement               = (void*)(&vaimageHeapBase[imageHeap->uiAllocatedHeapElements]);
         for (int32_t i = 0; i < (DDI_MEDIA_HEAP_INCREMENTAL_SIZE); i++)
@@ -1779,14 +1918,11 @@ PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT DdiMediaUtil_AllocPVAContextFromHeap(PDDI_MEDI
 
     if (nullptr == vaContextHeap->pFirstFreeHeapElement)
     {
-        void *newHeapBase = MOS_ReallocMemory(vaContextHeap->pHeapBase, (vaContextHeap->uiAllocatedHeapElements + DDI_MEDIA_HEAP_INCREMENTAL_SIZE) * sizeof(DDI_MEDIA_VACONTEXT_HEAP_ELEMENT));
-
-        if (nullptr == newHeapBase)
+        if (nullptr == MediaLibvaCommonNext::GrowHeap(vaContextHeap, sizeof(DDI_MEDIA_VACONTEXT_HEAP_ELEMENT), DDI_MEDIA_HEAP_INCREMENTAL_SIZE))
         {
-            DDI_ASSERTMESSAGE("DDI: realloc failed.");
+            DDI_ASSERTMESSAGE("DDI: heap grow failed.");
             return nullptr;
         }
-        vaContextHeap->pHeapBase                            = newHeapBase;
         PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT vacontextHeapBase = (PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT)vaContextHeap->pHeapBase;
         vaContextHeap->pFirstFreeHeapElement        = (void*)(&(vacontextHeapBase[vaContextHeap->uiAllocatedHeapElements]));
         for (int32_t i = 0; i < (DDI_MEDIA_HEAP_INCREMENTAL_SIZE); i++)
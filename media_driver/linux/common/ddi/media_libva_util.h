@@ -37,6 +37,30 @@
 //!
 void     DdiMediaUtil_MediaPrintFps();
 
+//!
+//! \brief  Buffer objects created in one pass for a burst of identically
+//!         shaped surfaces, e.g. a decode surface pool
+//!
+typedef struct _DDI_MEDIA_SURFACE_BATCH
+{
+    uint32_t               count;       // number of surfaces in the burst
+    uint32_t               allocated;   // number of bos created for the burst
+    uint32_t               next;        // index of the next bo to hand out
+    uint32_t               size;        // surface size the bos were created for
+    uint32_t               pitch;       // pitch returned by the bufmgr
+    uint32_t               tileformat;  // tiling the bos were created with
+    int                    memType;     // memory type the bos were created with
+    MOS_LINUX_BO         **bos;
+} DDI_MEDIA_SURFACE_BATCH, *PDDI_MEDIA_SURFACE_BATCH;
+
+//!
+//! \brief  Release the bos of a surface batch which were not consumed
+//!
+//! \param  [in] batch
+//!         Surface batch
+//!
+void DdiMediaUtil_ReleaseSurfaceBatch(PDDI_MEDIA_SURFACE_BATCH batch);
+
 //!
 //! \brief  Create surface
 //! 
@@ -44,11 +68,13 @@ void     DdiMediaUtil_MediaPrintFps();
 //!         Ddi media surface
 //! \param  [in] mediaDrvCtx
 //!         Pointer to ddi media context
+//! \param  [in] batch
+//!         Optional surface batch to take a pre-created bo from
 //!         
 //! \return VAStatus
 //!     VA_STATUS_SUCCESS if success, else fail reason
 //!
-VAStatus DdiMediaUtil_CreateSurface(DDI_MEDIA_SURFACE  *surface, PDDI_MEDIA_CONTEXT mediaDrvCtx);
+VAStatus DdiMediaUtil_CreateSurface(DDI_MEDIA_SURFACE  *surface, PDDI_MEDIA_CONTEXT mediaDrvCtx, PDDI_MEDIA_SURFACE_BATCH batch = nullptr);
 
 //!
 //! \brief  Create buffer
@@ -356,6 +382,9 @@ void     DdiMediaUtil_UnRefBufObjInMediaBuffer(PDDI_MEDIA_BUFFER buf);
 
 //!
 //! \brief  Open Intel's Graphics Device to get the file descriptor
+//! \details Fallback only: normally the app picks the GPU and libva hands the
+//!          driver its DRM fd, so device choice (and any balancing across GPUs)
+//!          belongs to the app or VA loader, not to the driver.
 //! 
 //! \param  [in] devName
 //!         Device name
@@ -1114,6 +1114,56 @@ mos_gem_bo_alloc_tiled(struct mos_bufmgr *bufmgr, const char *name,
                                                tiling, stride, 0, mem_type);
 }
 
+/**
+ * Batch allocation entry points used by the surface pool. The mock has no
+ * shared address carving, so they just loop over the single allocators.
+ */
+drm_export int
+mos_gem_bo_alloc_batch(struct mos_bufmgr *bufmgr,
+                const char *name,
+                unsigned long size,
+                unsigned long flags,
+                uint32_t tiling_mode,
+                unsigned long stride,
+                unsigned int alignment,
+                int mem_type,
+                struct mos_linux_bo **bos,
+                int count)
+{
+    int allocated;
+
+    if (bufmgr == nullptr || bos == nullptr || count <= 0)
+        return 0;
+
+    for (allocated = 0; allocated < count; allocated++) {
+        bos[allocated] = mos_gem_bo_alloc_internal(bufmgr, name, size, flags,
+                                    tiling_mode, stride, alignment, mem_type);
+        if (bos[allocated] == nullptr)
+            break;
+    }
+    return allocated;
+}
+
+drm_export int
+mos_gem_bo_alloc_tiled_batch(struct mos_bufmgr *bufmgr, const char *name,
+                int x, int y, int cpp, uint32_t *tiling_mode,
+                unsigned long *pitch, unsigned long flags,
+                int mem_type, struct mos_linux_bo **bos, int count)
+{
+    int allocated;
+
+    if (bufmgr == nullptr || bos == nullptr || count <= 0)
+        return 0;
+
+    for (allocated = 0; allocated < count; allocated++) {
+        bos[allocated] = mos_gem_bo_alloc_tiled(bufmgr, name, x, y, cpp,
+                                    tiling_mode, pitch, flags, mem_type);
+        if (bos[allocated] == nullptr)
+            break;
+    }
+    return allocated;
+}
+
 static struct mos_linux_bo *
 mos_gem_bo_alloc_userptr(struct mos_bufmgr *bufmgr,
                 const char *name,
@@ -2011,6 +2061,32 @@ mos_gem_bo_unmap_wc(struct mos_linux_bo *bo)
     return mos_gem_bo_unmap(bo);
 }
 
+void
+mos_gem_bo_set_map_hot(struct mos_linux_bo *bo, bool hot)
+{
+}
+
+int
+mos_gem_bo_export_sync_file(struct mos_linux_bo *bo, int *fd)
+{
+    return -ENOTSUP;
+}
+
+void
+mos_gem_bo_set_persistent(struct mos_linux_bo *bo)
+{
+}
+
+void
+mos_gem_bo_mark_queued(struct mos_linux_bo *bo)
+{
+}
+
+void
+mos_gem_bo_mark_submitted(struct mos_linux_bo *bo)
+{
+}
+
 int
 mos_gem_bo_unmap_gtt(struct mos_linux_bo *bo)
 {
@@ -4385,6 +4461,14 @@ fini:
     return ret;
 }
 
+int mos_set_context_param_load_balance_ext(struct mos_linux_context *ctx,
+                     struct i915_engine_class_instance *ci,
+                     unsigned int count,
+                     bool expose_siblings)
+{
+    return mos_set_context_param_load_balance(ctx, ci, count);
+}
+
 bool mos_gem_bo_is_softpin(struct mos_linux_bo *bo)
 {
     struct mos_bo_gem *bo_gem = (struct mos_bo_gem *) bo;
@@ -23,9 +23,16 @@
 
 using namespace std;
 
+extern bool g_benchMode;
+
 void UltGetCmdBuf(PMOS_COMMAND_BUFFER pCmdBuffer)
 {
     auto cmdValidator = CmdValidator::GetInstance();
+    cmdValidator->RecordCmdBufSize(pCmdBuffer);
+    if (g_benchMode)
+    {
+        return;
+    }
     cmdValidator->Validate(pCmdBuffer);
 }
 
@@ -48,6 +55,12 @@ void CmdValidator::GpuCmdsValidationInit(const GpuCmdFactory *cmdFactory, Platfo
     cmdValidator->CreateGpuCmds(cmdFactory, platform);
 }
 
+void CmdValidator::RecordCmdBufSize(const PMOS_COMMAND_BUFFER pCmdBuffer)
+{
+    m_cmdBufCount++;
+    m_cmdBufBytes += (uint64_t)(pCmdBuffer->pCmdPtr - pCmdBuffer->pCmdBase) * sizeof(*pCmdBuffer->pCmdBase);
+}
+
 void CmdValidator::Validate(const PMOS_COMMAND_BUFFER pCmdBuffer) const
 {
     for (auto p = pCmdBuffer->pCmdBase; p != pCmdBuffer->pCmdPtr; p++)
@@ -46,15 +46,28 @@ public:
     void Reset()
     {
         m_gpuCmds.clear();
+        m_cmdBufCount = 0;
+        m_cmdBufBytes = 0;
     }
 
+    void RecordCmdBufSize(const PMOS_COMMAND_BUFFER pCmdBuffer);
+
     void Validate(const PMOS_COMMAND_BUFFER pCmdBuffer) const;
 
+    // Submitted command buffers and their used bytes since the last Reset
+    uint32_t GetCmdBufCount() const { return m_cmdBufCount; }
+
+    uint64_t GetCmdBufBytes() const { return m_cmdBufBytes; }
+
 private:
 
     static CmdValidator *m_instance;
 
     std::vector<pcmditf_t> m_gpuCmds;
+
+    uint32_t m_cmdBufCount = 0;
+
+    uint64_t m_cmdBufBytes = 0;
 };
 
 #endif // __CMD_VALIDATOR_H__
@@ -20,6 +20,7 @@
 * OTHER DEALINGS IN THE SOFTWARE.
 */
 #include "ddi_test_encode.h"
+#include <chrono>
 
 using namespace std;
 
@@ -84,6 +85,7 @@ void MediaEncodeDdiTest::EncodeExecute(EncTestData *pEncData, Platform_t platfor
     EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
         << ", Failed function = m_driverLoader.m_ctx.vtable->vaCreateContext" << endl;
 
+    auto frameLoopStart = chrono::steady_clock::now();
     for (int i = 0; i < pEncData->m_num_frames; i++)
     {
         ret = m_driverLoader.m_ctx.vtable->vaBeginPicture(&m_driverLoader.m_ctx, context_id,resources[0]);
@@ -134,6 +136,22 @@ void MediaEncodeDdiTest::EncodeExecute(EncTestData *pEncData, Platform_t platfor
         }
       }
 
+    // Host time and command buffer usage per frame through the DDI, exposed in the
+    // gtest xml/json report (--gtest_output) so they can be tracked across builds.
+    if (pEncData->m_num_frames > 0)
+    {
+        auto frameLoopUs = chrono::duration_cast<chrono::microseconds>(
+            chrono::steady_clock::now() - frameLoopStart).count();
+        RecordProperty(string(g_platformName[platform]) + "_us_per_frame",
+            (int)(frameLoopUs / pEncData->m_num_frames));
+
+        auto cmdValidator = CmdValidator::GetInstance();
+        RecordProperty(string(g_platformName[platform]) + "_cmd_bufs_per_frame",
+            (int)(cmdValidator->GetCmdBufCount() / pEncData->m_num_frames));
+        RecordProperty(string(g_platformName[platform]) + "_cmd_bytes_per_frame",
+            (int)(cmdValidator->GetCmdBufBytes() / pEncData->m_num_frames));
+    }
+
     ret = m_driverLoader.m_ctx.vtable->vaDestroySurfaces(&m_driverLoader.m_ctx,
         &resources[0], resources.size());
     EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
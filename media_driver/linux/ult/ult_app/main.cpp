@@ -29,6 +29,7 @@ using namespace std;
 
 const char*        g_driverPath;
 vector<Platform_t> g_platform;
+bool               g_benchMode;
 
 static bool ParseCmd(int argc, char *argv[]);
 
@@ -46,25 +47,30 @@ int main(int argc, char *argv[])
 
 static bool ParsePlatform(const char *str);
 static bool ParseDriverPath(const char *str);
+static bool ParseBenchMode(const char *str);
 
 static bool ParseCmd(int argc, char *argv[])
 {
     g_driverPath = nullptr;
     g_platform.clear();
+    g_benchMode  = false;
 
     for (int i = 1; i < argc; i++)
     {
-        if (ParseDriverPath(argv[i]) == false && ParsePlatform(argv[i]) == false)
+        if (ParseDriverPath(argv[i]) == false && ParsePlatform(argv[i]) == false &&
+            ParseBenchMode(argv[i]) == false)
         {
             printf("ERROR\n    Bad command line parameter!\n\n");
-            printf("USAGE\n    devult [driver_path] [platform_name...]\n\n");
+            printf("USAGE\n    devult [driver_path] [platform_name...] [--bench]\n\n");
             printf("DESCRIPTION\n    [driver_path]     : Use default driver relative path if not specify driver_path.\n"
-                "    [platform_name...]: Select zero or more items from {SKL, BXT, BDW}.\n\n");
+                "    [platform_name...]: Select zero or more items from {SKL, BXT, BDW}.\n"
+                "    [--bench]         : Skip GPU command validation, so the recorded us_per_frame\n"
+                "                        is only the driver's CPU cost of building and submitting.\n\n");
             printf("EXAMPLE\n    devult\n"
                 "    devult ./build/media_driver/iHD_drv_video.so\n"
                 "    devult skl\n"
                 "    devult ./build/media_driver/iHD_drv_video.so skl\n"
-                "    devult ./build/media_driver/iHD_drv_video.so skl\n\n");
+                "    devult ./build/media_driver/iHD_drv_video.so skl --bench\n\n");
             return false;
         }
     }
@@ -103,3 +109,14 @@ static bool ParseDriverPath(const char *str)
 
     return false;
 }
+
+static bool ParseBenchMode(const char *str)
+{
+    if (strcmp(str, "--bench") == 0)
+    {
+        g_benchMode = true;
+        return true;
+    }
+
+    return false;
+}
@@ -50,6 +50,8 @@ MOS_STATUS VpPipelineG12Adapter::Render(PCVPHAL_RENDER_PARAMS pcRenderParams)
 {
     VP_FUNC_CALL();
 
+    // Per frame decision: the softlet VpPipeline is tried first, and only the feature sets
+    // it rejects fall back to the legacy VphalRenderer.
     MOS_STATUS eStatus = VpPipelineAdapterLegacy::Render(pcRenderParams);
 
     if (eStatus == MOS_STATUS_SUCCESS)
@@ -72,6 +72,9 @@ namespace decode
 
         DecodeScalabilityPars scalPars;
         MOS_ZeroMemory(&scalPars, sizeof(ScalabilityPars));
+        // AV1 decode packets only program AVP in legacy single pipe mode, multi pipe
+        // needs per pipe tile column split and pipe sync which are not supported yet.
+        scalPars.disableScalability = true;
         scalPars.disableRealTile = true;
         scalPars.enableVE = MOS_VE_SUPPORTED(m_osInterface);
         if (MEDIA_IS_SKU(m_skuTable, FtrWithSlimVdbox))
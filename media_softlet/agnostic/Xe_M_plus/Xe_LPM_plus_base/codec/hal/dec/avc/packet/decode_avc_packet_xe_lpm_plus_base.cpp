@@ -131,7 +131,8 @@ MOS_STATUS AvcDecodePktXe_Lpm_Plus_Base::PackSliceLevelCmds(MOS_COMMAND_BUFFER &
             m_mmcState->UpdateUserFeatureKey(&(m_avcBasicFeature->m_destSurface));
         })
 
-    if (!m_osInterface->pfnIsMismatchOrderProgrammingSupported())
+    // A batched frame is followed by the next frame in the same command buffer
+    if (!m_osInterface->pfnIsMismatchOrderProgrammingSupported() && !m_avcPipeline->IsFrameSubmissionDeferred())
     {
         DECODE_CHK_STATUS(m_miItf->AddMiBatchBufferEnd(&cmdBuffer, nullptr));
     }
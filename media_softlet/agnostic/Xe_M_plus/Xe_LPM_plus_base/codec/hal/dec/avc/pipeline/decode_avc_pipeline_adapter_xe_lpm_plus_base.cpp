@@ -89,6 +89,13 @@ MOS_STATUS DecodeAvcPipelineAdapterXe_Lpm_Plus_Base::GetStatusReport(
     return m_decoder->GetStatusReport(status, numStatus);
 }
 
+MOS_STATUS DecodeAvcPipelineAdapterXe_Lpm_Plus_Base::FlushBatchedFrames()
+{
+    DECODE_FUNC_CALL();
+    DECODE_CHK_NULL(m_decoder);
+    return m_decoder->FlushBatchedFrames();
+}
+
 bool DecodeAvcPipelineAdapterXe_Lpm_Plus_Base::IsIncompletePicture()
 {
      return (!m_decoder->IsCompleteBitstream());
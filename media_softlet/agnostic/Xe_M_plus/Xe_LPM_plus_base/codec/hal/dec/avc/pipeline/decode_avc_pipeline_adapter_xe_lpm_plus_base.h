@@ -76,6 +76,8 @@ public:
 
     virtual MOS_STATUS SetDecodeFormat(bool isShortFormat) override;
 
+    virtual MOS_STATUS FlushBatchedFrames() override;
+
 protected:
     std::shared_ptr<decode::AvcPipelineXe_Lpm_Plus_Base> m_decoder;
 
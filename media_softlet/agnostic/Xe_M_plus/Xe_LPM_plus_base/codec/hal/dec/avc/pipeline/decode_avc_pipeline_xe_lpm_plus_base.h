@@ -107,6 +107,13 @@ protected:
     //!
     MOS_STATUS InitContext();
 
+    //!
+    //! \brief  Check if current frame may be batched with the following frames
+    //! \return bool
+    //!         true for small frames without CENC
+    //!
+    bool IsFrameBatchable();
+
 #if USE_CODECHAL_DEBUG_TOOL
     //!
     //! \brief    Dump the parameters
@@ -121,6 +128,8 @@ protected:
 private:
     AvcDecodePktXe_Lpm_Plus_Base* m_avcDecodePkt = nullptr;
 
+    static constexpr uint32_t m_maxBatchedFramePixels = 640 * 480; //!< Largest frame recorded by frame batching
+
 MEDIA_CLASS_DEFINE_END(decode__AvcPipelineXe_Lpm_Plus_Base)
 };
 
@@ -76,6 +76,8 @@ MOS_STATUS HevcPipelineXe_Lpm_Plus_Base::Init(void *settings)
     DECODE_CHK_STATUS(RegisterPacket(DecodePacketId(this, hevcRealTilePacketId), hevcDecodePktRealTile));
     DECODE_CHK_STATUS(hevcDecodePktRealTile->Init());
 
+    DECODE_CHK_STATUS(PreAllocate());
+
     return MOS_STATUS_SUCCESS;
 }
 
@@ -124,7 +126,7 @@ MOS_STATUS HevcPipelineXe_Lpm_Plus_Base::InitScalabOption(HevcBasicFeature &basi
         ReadUserFeature(m_userSettingPtr, "HCP Decode User Pipe Num", MediaUserSetting::Group::Sequence).Get<uint8_t>();
 #endif
     // Long format real tile requires subset params
-    if (!basicFeature.m_shortFormatInUse && basicFeature.m_hevcSubsetParams == nullptr)
+    if (!basicFeature.IsShortFormatFrame() && basicFeature.m_hevcSubsetParams == nullptr)
     {
         scalPars.disableRealTile = true;
     }
@@ -178,11 +180,12 @@ MOS_STATUS HevcPipelineXe_Lpm_Plus_Base::AllocateResources(HevcBasicFeature &bas
 
     // In hevc short format decode, second level command buffer is programmed by Huc, so not need lock it.
     // In against hevc long format decode driver have to program second level command buffer, so it should
-    // be lockable.
+    // be lockable. Frames parsed by host are programmed by driver as well, so keep it lockable then.
+    bool bbLockable = !basicFeature.m_shortFormatInUse || basicFeature.m_hostSliceParseInUse;
     if (m_secondLevelBBArray == nullptr)
     {
         m_secondLevelBBArray = m_allocator->AllocateBatchBufferArray(
-            size, count, m_secondLevelBBNum, true, basicFeature.m_shortFormatInUse ? notLockableVideoMem : lockableVideoMem);
+            size, count, m_secondLevelBBNum, true, bbLockable ? lockableVideoMem : notLockableVideoMem);
         DECODE_CHK_NULL(m_secondLevelBBArray);
         PMHW_BATCH_BUFFER &batchBuf = m_secondLevelBBArray->Fetch();
         DECODE_CHK_NULL(batchBuf);
@@ -192,7 +195,7 @@ MOS_STATUS HevcPipelineXe_Lpm_Plus_Base::AllocateResources(HevcBasicFeature &bas
         PMHW_BATCH_BUFFER &batchBuf = m_secondLevelBBArray->Fetch();
         DECODE_CHK_NULL(batchBuf);
         DECODE_CHK_STATUS(m_allocator->Resize(
-            batchBuf, size, count, basicFeature.m_shortFormatInUse ? notLockableVideoMem : lockableVideoMem));
+            batchBuf, size, count, bbLockable ? lockableVideoMem : notLockableVideoMem));
     }
 
     return MOS_STATUS_SUCCESS;
@@ -230,7 +233,7 @@ MOS_STATUS HevcPipelineXe_Lpm_Plus_Base::Prepare(void *params)
                     m_basicFeature->m_hevcSliceParams,
                     m_basicFeature->m_hevcRextSliceParams,
                     m_basicFeature->m_numSlices,
-                    m_basicFeature->m_shortFormatInUse);
+                    m_basicFeature->IsShortFormatFrame());
             }
 
             CODECHAL_DEBUG_TOOL(
@@ -476,7 +479,7 @@ MOS_STATUS HevcPipelineXe_Lpm_Plus_Base::DumpParams(HevcBasicFeature &basicFeatu
             basicFeature.m_hevcSliceParams,
             basicFeature.m_hevcRextSliceParams,
             basicFeature.m_numSlices,
-            basicFeature.m_shortFormatInUse));
+            basicFeature.IsShortFormatFrame()));
     }
 
     if(basicFeature.m_hevcSubsetParams != nullptr)
@@ -85,7 +85,11 @@ MOS_STATUS JpegDecodePktXe_Lpm_Plus_Base::PackPictureLevelCmds(MOS_COMMAND_BUFFE
     DECODE_CHK_STATUS(EndStatusReport(statusReportMfx, &cmdBuffer));
     DECODE_CHK_STATUS(UpdateStatusReportNext(statusReportGlobalCount, &cmdBuffer));
 
-    DECODE_CHK_STATUS(m_miItf->AddMiBatchBufferEnd(&cmdBuffer, nullptr));
+    // A batched image is followed by the next image in the same command buffer
+    if (!m_jpegPipeline->IsFrameSubmissionDeferred())
+    {
+        DECODE_CHK_STATUS(m_miItf->AddMiBatchBufferEnd(&cmdBuffer, nullptr));
+    }
 
     return MOS_STATUS_SUCCESS;
 }
@@ -87,6 +87,13 @@ MOS_STATUS DecodeJpegPipelineAdapterXe_Lpm_Plus_Base::GetStatusReport(
     return m_decoder->GetStatusReport(status, numStatus);
 }
 
+MOS_STATUS DecodeJpegPipelineAdapterXe_Lpm_Plus_Base::FlushBatchedFrames()
+{
+    DECODE_FUNC_CALL();
+    DECODE_CHK_NULL(m_decoder);
+    return m_decoder->FlushBatchedFrames();
+}
+
 bool DecodeJpegPipelineAdapterXe_Lpm_Plus_Base::IsIncompletePicture()
 {
      return (!m_decoder->IsCompleteBitstream());
@@ -68,6 +68,8 @@ public:
 
     void SetDummyReferenceStatus(CODECHAL_DUMMY_REFERENCE_STATUS status) override;
 
+    virtual MOS_STATUS FlushBatchedFrames() override;
+
 
 #ifdef _DECODE_PROCESSING_SUPPORTED
     virtual bool IsDownSamplingSupported() override;
@@ -53,10 +53,23 @@ MOS_STATUS JpegPipelineXe_Lpm_Plus_Base::Init(void *settings)
     return MOS_STATUS_SUCCESS;
 }
 
+bool JpegPipelineXe_Lpm_Plus_Base::IsFrameBatchable()
+{
+    if (m_basicFeature == nullptr)
+    {
+        return false;
+    }
+
+    return (m_basicFeature->m_width * m_basicFeature->m_height) <= m_maxBatchedFramePixels;
+}
+
 MOS_STATUS JpegPipelineXe_Lpm_Plus_Base::GetStatusReport(void *status, uint16_t numStatus)
 {
     DECODE_FUNC_CALL();
 
+    // Batched images only complete once they are submitted
+    DECODE_CHK_STATUS(FlushBatchedFrames());
+
     m_statusReport->GetReport(numStatus, status);
 
     return MOS_STATUS_SUCCESS;
@@ -225,6 +238,7 @@ MOS_STATUS JpegPipelineXe_Lpm_Plus_Base::Execute()
         {
             DECODE_CHK_STATUS(InitContext());
             DECODE_CHK_STATUS(ActivateDecodePackets());
+            SetFrameBatching(IsFrameBatchable());
             DECODE_CHK_STATUS(ExecuteActivePackets());
 
 #if (_DEBUG || _RELEASE_INTERNAL)
@@ -110,6 +110,13 @@ protected:
     //!
     MOS_STATUS InitContext();
 
+    //!
+    //! \brief  Check if current image may be batched with the following images
+    //! \return bool
+    //!         true for thumbnail sized images
+    //!
+    bool IsFrameBatchable();
+
 #if USE_CODECHAL_DEBUG_TOOL
     //!
     //! \brief    Dump the parameters
@@ -124,6 +131,8 @@ protected:
 private:
     JpegDecodePktXe_Lpm_Plus_Base *m_jpegDecodePkt = nullptr;
 
+    static constexpr uint32_t m_maxBatchedFramePixels = 640 * 480; //!< Largest image recorded by frame batching
+
 MEDIA_CLASS_DEFINE_END(decode__JpegPipelineXe_Lpm_Plus_Base)
 };
 
@@ -302,6 +302,8 @@ MOS_STATUS Vp9PipelineXe_Lpm_Plus_Base::InitContexOption(Vp9BasicFeature &basicF
     DecodeScalabilityPars scalPars;
     MOS_ZeroMemory(&scalPars, sizeof(scalPars));
 
+    // Single pipe frames go to a load balanced virtual engine, so separate decode
+    // contexts already spread over all VDBOXes. Frames of one context stay in order.
     scalPars.usingHcp           = true;
     scalPars.enableVE           = MOS_VE_SUPPORTED(m_osInterface);
     scalPars.disableScalability = m_hwInterface->IsDisableScalability();
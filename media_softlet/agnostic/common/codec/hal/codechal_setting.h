@@ -51,6 +51,7 @@ public:
     uint8_t                 chromaFormat = 0;                 //!< Applies currently to HEVC/VP9 only, specifies chromaformat as 420/422/444.
     bool                    intelEntrypointInUse = false;          //!< Applies to decode only, application is using a Intel-specific entrypoint.
     bool                    shortFormatInUse = false;              //!< Applies to decode only, application is passing short format slice data.
+    bool                    hostSliceParseInUse = false;           //!< Applies to HEVC short format decode only, host may parse slice headers to long format.
 
     bool                    disableDecodeSyncLock = false;         //!< Flag to indicate if Decode O/P can be locked for sync.
 
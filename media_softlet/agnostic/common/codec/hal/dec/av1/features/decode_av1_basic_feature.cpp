@@ -439,6 +439,9 @@ namespace decode
 
         DECODE_CHK_STATUS(m_internalTarget.UpdateRefList(m_av1PicParams->m_currPic.FrameIdx, m_refFrameIndexList));
 
+        // Film grain is injected by AVP in the same pass as reconstruction (see
+        // AVP_PIC_STATE applyFilmGrainFlag and the film grain output address in
+        // AVP_PIPE_BUF_ADDR_STATE), so no render pass is added here.
         if (m_filmGrainEnabled)
         {
             m_filmGrainProcParams = (FilmGrainProcParams*)&decodeParams->m_filmGrainProcParams;
@@ -58,7 +58,7 @@ namespace decode
         }
 
         Av1RefAssociatedBufs *bufs = MOS_New(Av1RefAssociatedBufs);
-        bufs->mvBuf = m_allocator->AllocateBuffer(
+        bufs->mvBuf = m_allocator->AllocatePooledBuffer(
             avpBufSizeParam.bufferSize, "MvTemporalBuffer", resourceInternalReadWriteCache, notLockableVideoMem);
 
         if (m_avpItf->GetAvpBufSize(mhw::vdbox::avp::segmentIdBuffer,
@@ -66,7 +66,7 @@ namespace decode
         {
             DECODE_ASSERTMESSAGE( "Failed to get SegmentIdBuffer size.");
         }
-        bufs->segIdWriteBuf.buffer = m_allocator->AllocateBuffer(
+        bufs->segIdWriteBuf.buffer = m_allocator->AllocatePooledBuffer(
             avpBufSizeParam.bufferSize, "SegmentIdWriteBuffer", resourceInternalReadWriteCache, notLockableVideoMem);
 
         bufs->bwdAdaptCdfBuf.buffer = m_allocator->AllocateBuffer(MOS_ALIGN_CEIL(m_basicFeature->m_cdfMaxNumBytes,
@@ -91,14 +91,14 @@ namespace decode
         DECODE_CHK_STATUS(m_avpItf->GetAvpBufSize(
             mhw::vdbox::avp::mvTemporalBuffer,
             &avpBufSizeParam));
-        DECODE_CHK_STATUS(m_allocator->Resize(
-            buffer->mvBuf, avpBufSizeParam.bufferSize, notLockableVideoMem, false));
+        DECODE_CHK_STATUS(m_allocator->ResizePooled(
+            buffer->mvBuf, avpBufSizeParam.bufferSize, notLockableVideoMem));
 
         DECODE_CHK_STATUS(m_avpItf->GetAvpBufSize(
             mhw::vdbox::avp::segmentIdBuffer,
             &avpBufSizeParam));
-        DECODE_CHK_STATUS(m_allocator->Resize(
-            buffer->segIdWriteBuf.buffer, avpBufSizeParam.bufferSize, notLockableVideoMem, false));
+        DECODE_CHK_STATUS(m_allocator->ResizePooled(
+            buffer->segIdWriteBuf.buffer, avpBufSizeParam.bufferSize, notLockableVideoMem));
 
         RecordSegIdBufInfo(buffer);
         RecordCdfTableBufInfo(buffer);
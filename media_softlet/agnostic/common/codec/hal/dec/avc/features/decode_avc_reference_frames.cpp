@@ -142,6 +142,64 @@ namespace decode
         return &(m_basicFeature->m_destSurface.OsResource);
     }
 
+    PMOS_RESOURCE AvcReferenceFrames::GetNearestValidReference(const CODEC_AVC_PIC_PARAMS &picParams, uint8_t frameIndex)
+    {
+        DECODE_FUNC_CALL();
+
+        int32_t missingPoc = MOS_MIN(picParams.CurrFieldOrderCnt[0], picParams.CurrFieldOrderCnt[1]);
+        for (uint32_t i = 0; i < CODEC_AVC_MAX_NUM_REF_FRAME; i++)
+        {
+            if (!CodecHal_PictureIsInvalid(picParams.RefFrameList[i]) &&
+                picParams.RefFrameList[i].FrameIdx == frameIndex)
+            {
+                missingPoc = MOS_MIN(picParams.FieldOrderCntList[i][0], picParams.FieldOrderCntList[i][1]);
+                break;
+            }
+        }
+
+        PMOS_RESOURCE nearest      = nullptr;
+        bool          nearestClean = false;
+        uint32_t      nearestDist  = 0;
+        for (uint32_t i = 0; i < CODEC_AVC_MAX_NUM_REF_FRAME; i++)
+        {
+            uint8_t frameIdx = picParams.RefFrameList[i].FrameIdx;
+            if (CodecHal_PictureIsInvalid(picParams.RefFrameList[i]) ||
+                frameIdx >= CODEC_AVC_NUM_UNCOMPRESSED_SURFACE || frameIdx == frameIndex)
+            {
+                continue;
+            }
+
+            PMOS_RESOURCE buffer = GetReferenceByFrameIndex(frameIdx);
+            if (buffer == nullptr)
+            {
+                continue;
+            }
+
+            int32_t  poc   = MOS_MIN(picParams.FieldOrderCntList[i][0], picParams.FieldOrderCntList[i][1]);
+            bool     clean = !m_corrupted[frameIdx];
+            uint32_t dist  = (uint32_t)MOS_ABS(poc - missingPoc);
+            if (nearest == nullptr || (clean && !nearestClean) ||
+                (clean == nearestClean && dist < nearestDist))
+            {
+                nearest      = buffer;
+                nearestClean = clean;
+                nearestDist  = dist;
+            }
+        }
+
+        return nearest;
+    }
+
+    void AvcReferenceFrames::MarkCurFrameCorrupted(const CODEC_AVC_PIC_PARAMS &picParams)
+    {
+        DECODE_FUNC_CALL();
+
+        if (picParams.CurrPic.FrameIdx < CODEC_AVC_NUM_UNCOMPRESSED_SURFACE)
+        {
+            m_corrupted[picParams.CurrPic.FrameIdx] = true;
+        }
+    }
+
      MOS_STATUS AvcReferenceFrames::UpdateCurResource(const CODEC_AVC_PIC_PARAMS &picParams)
     {
         DECODE_FUNC_CALL();
@@ -161,6 +219,12 @@ namespace decode
                         "Invalid frame index of current frame");
         PCODEC_REF_LIST destEntry = m_refList[currPic.FrameIdx];
 
+        // A second field keeps the corruption state of the first one
+        if (!CodecHal_PictureIsField(currPic) || !m_basicFeature->m_secondField)
+        {
+            m_corrupted[currPic.FrameIdx] = false;
+        }
+
         DECODE_CHK_STATUS(UpdateCurResource(picParams));
 
         //MVC related inter-view reference
@@ -90,6 +90,25 @@ public:
     //!
     PMOS_RESOURCE GetValidReference();
 
+    //!
+    //! \brief  Get the valid reference whose POC is nearest to a missing reference
+    //! \details Used by error recovery, references which are not corrupted are preferred
+    //! \param  [in] picParams
+    //!         Picture parameters
+    //! \param  [in] frameIndex
+    //!         Frame index of the missing reference
+    //! \return PMOS_RESOURCE
+    //!         Nearest valid reference resource, nullptr if no valid reference
+    //!
+    PMOS_RESOURCE GetNearestValidReference(const CODEC_AVC_PIC_PARAMS &picParams, uint8_t frameIndex);
+
+    //!
+    //! \brief  Mark current frame as corrupted since it is decoded with substituted references
+    //! \param  [in] picParams
+    //!         Picture parameters
+    //!
+    void MarkCurFrameCorrupted(const CODEC_AVC_PIC_PARAMS &picParams);
+
     //!
     //! \brief  Update current resource for reference list
     //! \param  [in] picParams
@@ -101,6 +120,7 @@ public:
 
     CODEC_PIC_ID        m_avcPicIdx[CODEC_AVC_MAX_NUM_REF_FRAME];          //!< Picture Index
     PCODEC_REF_LIST     m_refList[CODEC_AVC_NUM_UNCOMPRESSED_SURFACE];     //!< Pointer to reference list
+    bool                m_corrupted[CODEC_AVC_NUM_UNCOMPRESSED_SURFACE] = {}; //!< Frames decoded with substituted references
 
 protected:
     //!
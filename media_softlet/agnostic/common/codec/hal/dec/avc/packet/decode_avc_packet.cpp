@@ -115,8 +115,7 @@ MOS_STATUS AvcDecodePkt::AddForceWakeup(MOS_COMMAND_BUFFER &cmdBuffer)
 
 MOS_STATUS AvcDecodePkt::SendPrologWithFrameTracking(MOS_COMMAND_BUFFER &cmdBuffer, bool frameTrackingRequested)
 {
-    DecodeSubPacket *subPacket   = m_avcPipeline->GetSubPacket(DecodePacketId(m_avcPipeline, markerSubPacketId));
-    DecodeMarkerPkt *makerPacket = dynamic_cast<DecodeMarkerPkt *>(subPacket);
+    DecodeMarkerPkt *makerPacket = m_avcPipeline->GetMarkerPkt();
     DECODE_CHK_NULL(makerPacket);
     DECODE_CHK_STATUS(makerPacket->Execute(cmdBuffer));
 
@@ -140,8 +139,7 @@ MOS_STATUS AvcDecodePkt::SendPrologWithFrameTracking(MOS_COMMAND_BUFFER &cmdBuff
 
      DECODE_CHK_STATUS(Mhw_SendGenericPrologCmdNext(&cmdBuffer, &genericPrologParams, m_miItf));
 
-    subPacket                               = m_avcPipeline->GetSubPacket(DecodePacketId(m_avcPipeline, predicationSubPacketId));
-    DecodePredicationPkt *predicationPacket = dynamic_cast<DecodePredicationPkt *>(subPacket);
+    DecodePredicationPkt *predicationPacket = m_avcPipeline->GetPredicationPkt();
     DECODE_CHK_NULL(predicationPacket);
     DECODE_CHK_STATUS(predicationPacket->Execute(cmdBuffer));
 
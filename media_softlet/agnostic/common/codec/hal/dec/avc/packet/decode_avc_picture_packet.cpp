@@ -325,6 +325,15 @@ MHW_SETPAR_DECL_SRC(MFX_PIPE_BUF_ADDR_STATE, AvcDecodePicPkt)
         uint8_t frameIdx               = activeRefList[i];
         uint8_t frameId                = (m_avcBasicFeature->m_picIdRemappingInUse) ? i : refFrames.m_refList[frameIdx]->ucFrameId;
         params.presReferences[frameId] = refFrames.GetReferenceByFrameIndex(frameIdx);
+        if (params.presReferences[frameId] == nullptr && m_avcPipeline->IsErrorRecoveryEnabled())
+        {
+            // Conceal with the nearest valid reference rather than the first one in the list
+            params.presReferences[frameId] = refFrames.GetNearestValidReference(*m_avcPicParams, frameIdx);
+            if (params.presReferences[frameId] != nullptr)
+            {
+                refFrames.MarkCurFrameCorrupted(*m_avcPicParams);
+            }
+        }
 
         // Return error if reference surface's width or height is less than dest surface.
         if (params.presReferences[frameId] != nullptr)
@@ -38,7 +38,8 @@ MOS_STATUS HevcBasicFeature::Init(void *setting)
     DECODE_CHK_NULL(setting);
     DECODE_CHK_NULL(m_hwInterface);
 
-    m_shortFormatInUse = ((CodechalSetting*)setting)->shortFormatInUse;
+    m_shortFormatInUse    = ((CodechalSetting*)setting)->shortFormatInUse;
+    m_hostSliceParseInUse = m_shortFormatInUse && ((CodechalSetting*)setting)->hostSliceParseInUse;
 
     DECODE_CHK_STATUS(DecodeBasicFeature::Init(setting));
 
@@ -78,6 +79,7 @@ MOS_STATUS HevcBasicFeature::Update(void *params)
     m_hevcRextSliceParams= static_cast<PCODEC_HEVC_EXT_SLICE_PARAMS>(decodeParams->m_extSliceParams);
     m_hevcSccPicParams   = static_cast<PCODEC_HEVC_SCC_PIC_PARAMS>(decodeParams->m_advPicParams);
     m_hevcSubsetParams   = static_cast<PCODEC_HEVC_SUBSET_PARAMS>(decodeParams->m_subsetParams);
+    m_hostParsedSlices   = m_hostSliceParseInUse && decodeParams->m_hostParsedSliceParams;
 
     DECODE_CHK_STATUS(SetPictureStructs());
     DECODE_CHK_STATUS(SetSliceStructs());
@@ -498,6 +500,12 @@ bool HevcBasicFeature::IsIndependentSlice(uint32_t sliceIdx)
            (! m_hevcSliceParams[sliceIdx].LongSliceFlags.fields.dependent_slice_segment_flag);
 }
 
+bool HevcBasicFeature::IsShortFormatFrame()
+{
+    // Slices parsed by host already carry long format params, no HuC S2L needed
+    return m_shortFormatInUse && !m_hostParsedSlices;
+}
+
 MOS_STATUS HevcBasicFeature::SetRequiredBitstreamSize(uint32_t requiredSize)
 {
     DECODE_FUNC_CALL();
@@ -599,7 +607,7 @@ MOS_STATUS HevcBasicFeature::SetSliceStructs()
         DECODE_CHK_STATUS(SetRequiredBitstreamSize(lastSlice->slice_data_offset + lastSlice->slice_data_size));
     }
 
-    if (!m_shortFormatInUse)
+    if (!IsShortFormatFrame())
     {
         DECODE_CHK_STATUS(ErrorDetectAndConcealForLongFormat());
     }
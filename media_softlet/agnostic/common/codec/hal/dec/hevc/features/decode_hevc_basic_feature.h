@@ -62,6 +62,7 @@ public:
 
     bool IsLastSlice(uint32_t sliceIdx);
     bool IsIndependentSlice(uint32_t sliceIdx);
+    bool IsShortFormatFrame();
 
     // Parameters passed from application
     PCODEC_HEVC_PIC_PARAMS          m_hevcPicParams = nullptr;      //!< Pointer to picture parameter
@@ -91,6 +92,8 @@ public:
 
     bool                            m_dummyReferenceSlot[CODECHAL_MAX_CUR_NUM_REF_FRAME_HEVC];
     bool                            m_shortFormatInUse = false;     //!< Indicate if short format
+    bool                            m_hostSliceParseInUse = false;  //!< Indicate if host may parse short format slices to long format
+    bool                            m_hostParsedSlices = false;     //!< Indicate if slices of current frame are parsed to long format by host
 
 protected:
     virtual MOS_STATUS SetRequiredBitstreamSize(uint32_t requiredSize) override;
@@ -48,7 +48,7 @@ MOS_BUFFER* HevcMvBufferOpInf::Allocate()
     uint32_t mvtbSize   = ((((m_basicFeature->m_width + 31) >> 5) * (((m_basicFeature->m_height + 31) >> 5)) + 1)&(-2));
     uint32_t bufferSize = MOS_MAX(mvtSize, mvtbSize) * MHW_CACHELINE_SIZE;
 
-    auto buffer = m_allocator->AllocateBuffer(bufferSize, "MvTemporalBuffer",
+    auto buffer = m_allocator->AllocatePooledBuffer(bufferSize, "MvTemporalBuffer",
         resourceInternalReadWriteCache, notLockableVideoMem);
 
     return buffer;
@@ -68,7 +68,7 @@ MOS_STATUS HevcMvBufferOpInf::Resize(MOS_BUFFER* &buffer)
     uint32_t mvtbSize   = ((((m_basicFeature->m_width + 31) >> 5) * (((m_basicFeature->m_height + 31) >> 5)) + 1)&(-2));
     uint32_t bufferSize = MOS_MAX(mvtSize, mvtbSize) * MHW_CACHELINE_SIZE;
 
-    auto status = m_allocator->Resize(buffer, bufferSize, notLockableVideoMem, false);
+    auto status = m_allocator->ResizePooled(buffer, bufferSize, notLockableVideoMem);
     return status;
 }
 
@@ -136,6 +136,65 @@ PMOS_RESOURCE HevcReferenceFrames::GetValidReference()
     return &(m_basicFeature->m_destSurface.OsResource);
 }
 
+PMOS_RESOURCE HevcReferenceFrames::GetNearestValidReference(
+    const CODEC_HEVC_PIC_PARAMS &picParams, uint8_t frameIndex, uint8_t &nearestFrameIndex)
+{
+    DECODE_FUNC_CALL();
+
+    int32_t missingPoc = picParams.CurrPicOrderCntVal;
+    for (uint32_t i = 0; i < CODEC_MAX_NUM_REF_FRAME_HEVC; i++)
+    {
+        if (!CodecHal_PictureIsInvalid(picParams.RefFrameList[i]) &&
+            picParams.RefFrameList[i].FrameIdx == frameIndex)
+        {
+            missingPoc = picParams.PicOrderCntValList[i];
+            break;
+        }
+    }
+
+    PMOS_RESOURCE nearest      = nullptr;
+    bool          nearestClean = false;
+    uint32_t      nearestDist  = 0;
+    for (uint32_t i = 0; i < CODEC_MAX_NUM_REF_FRAME_HEVC; i++)
+    {
+        uint8_t frameIdx = picParams.RefFrameList[i].FrameIdx;
+        if (CodecHal_PictureIsInvalid(picParams.RefFrameList[i]) ||
+            frameIdx >= CODECHAL_NUM_UNCOMPRESSED_SURFACE_HEVC || frameIdx == frameIndex)
+        {
+            continue;
+        }
+
+        PMOS_RESOURCE buffer = GetReferenceByFrameIndex(frameIdx);
+        if (buffer == nullptr)
+        {
+            continue;
+        }
+
+        bool     clean = !m_corrupted[frameIdx];
+        uint32_t dist  = (uint32_t)MOS_ABS(picParams.PicOrderCntValList[i] - missingPoc);
+        if (nearest == nullptr || (clean && !nearestClean) ||
+            (clean == nearestClean && dist < nearestDist))
+        {
+            nearest           = buffer;
+            nearestClean      = clean;
+            nearestDist       = dist;
+            nearestFrameIndex = frameIdx;
+        }
+    }
+
+    return nearest;
+}
+
+void HevcReferenceFrames::MarkCurFrameCorrupted(const CODEC_HEVC_PIC_PARAMS &picParams)
+{
+    DECODE_FUNC_CALL();
+
+    if (picParams.CurrPic.FrameIdx < CODECHAL_NUM_UNCOMPRESSED_SURFACE_HEVC)
+    {
+        m_corrupted[picParams.CurrPic.FrameIdx] = true;
+    }
+}
+
 MOS_STATUS HevcReferenceFrames::UpdateCurResource(const CODEC_HEVC_PIC_PARAMS &picParams, bool isSCCIBCMode)
 {
     DECODE_FUNC_CALL();
@@ -184,6 +243,7 @@ MOS_STATUS HevcReferenceFrames::UpdateCurFrame(const CODEC_HEVC_PIC_PARAMS & pic
                     "Invalid frame index of current frame");
     PCODEC_REF_LIST destEntry = m_refList[picParams.CurrPic.FrameIdx];
     MOS_ZeroMemory(destEntry, sizeof(CODEC_REF_LIST));
+    m_corrupted[picParams.CurrPic.FrameIdx] = false;
 
     DECODE_CHK_STATUS(UpdateCurResource(picParams, isSCCIBCMode));
 
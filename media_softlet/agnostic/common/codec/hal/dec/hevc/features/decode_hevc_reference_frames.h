@@ -103,6 +103,27 @@ public:
     //!
     PMOS_RESOURCE GetValidReference();
 
+    //!
+    //! \brief  Get the valid reference whose POC is nearest to a missing reference
+    //! \details Used by error recovery, references which are not corrupted are preferred
+    //! \param  [in] picParams
+    //!         Picture parameters
+    //! \param  [in] frameIndex
+    //!         Frame index of the missing reference
+    //! \param  [out] nearestFrameIndex
+    //!         Frame index of the returned reference
+    //! \return  PMOS_RESOURCE
+    //!         Nearest valid reference resource, nullptr if no valid reference
+    //!
+    PMOS_RESOURCE GetNearestValidReference(const CODEC_HEVC_PIC_PARAMS &picParams, uint8_t frameIndex, uint8_t &nearestFrameIndex);
+
+    //!
+    //! \brief  Mark current frame as corrupted since it is decoded with substituted references
+    //! \param  [in] picParams
+    //!         Picture parameters
+    //!
+    void MarkCurFrameCorrupted(const CODEC_HEVC_PIC_PARAMS &picParams);
+
     //!
     //! \brief  Fix reference list for slice
     //! \param  [in] picParams
@@ -118,6 +139,7 @@ public:
     PCODEC_REF_LIST     m_refList[CODECHAL_NUM_UNCOMPRESSED_SURFACE_HEVC];  //!< Pointer to reference list
     bool                m_curIsIntra = true;                                //!< Indicate current picture is intra
     uint8_t             m_IBCRefIdx = 0;                                    //!< Reference ID for IBC mode
+    bool                m_corrupted[CODECHAL_NUM_UNCOMPRESSED_SURFACE_HEVC] = {}; //!< Frames decoded with substituted references
 
 protected:
     //!
@@ -74,7 +74,7 @@ MOS_STATUS HevcTileCoding::UpdateSlice(const CODEC_HEVC_PIC_PARAMS & picParams,
 {
     DECODE_FUNC_CALL();
 
-    if (m_basicFeature->m_shortFormatInUse)
+    if (m_basicFeature->IsShortFormatFrame())
     {
         return MOS_STATUS_SUCCESS;
     }
@@ -124,7 +124,7 @@ MOS_STATUS HevcTileCoding::UpdateSliceTileInfo()
 {
     DECODE_FUNC_CALL();
 
-    if (m_basicFeature->m_shortFormatInUse)
+    if (m_basicFeature->IsShortFormatFrame())
     {
         return MOS_STATUS_SUCCESS;
     }
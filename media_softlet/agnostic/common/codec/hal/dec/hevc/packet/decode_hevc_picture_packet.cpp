@@ -240,6 +240,37 @@ namespace decode
         hcpBufSizePar.dwPicHeight    = m_hevcBasicFeature->m_height;
         hcpBufSizePar.dwMaxFrameSize = m_hevcBasicFeature->m_dataSize;
 
+        return AllocateVariableResources(hcpBufSizePar);
+    }
+
+    MOS_STATUS HevcDecodePicPkt::PreAllocate()
+    {
+        DECODE_FUNC_CALL();
+
+        HcpBufferSizePar hcpBufSizePar;
+        MOS_ZeroMemory(&hcpBufSizePar, sizeof(hcpBufSizePar));
+
+        hcpBufSizePar.ucMaxBitDepth  = m_hevcBasicFeature->m_bitDepth;
+        hcpBufSizePar.ucChromaFormat = m_hevcBasicFeature->m_chromaFormat;
+        hcpBufSizePar.dwPicWidth     = m_hevcBasicFeature->m_width;
+        hcpBufSizePar.dwPicHeight    = m_hevcBasicFeature->m_height;
+        // Bitstream size is unknown before the first frame, assume half of a 4:2:0 8 bit frame
+        hcpBufSizePar.dwMaxFrameSize = m_hevcBasicFeature->m_width * m_hevcBasicFeature->m_height * 3 / 4;
+
+        // Buffers only grow on resize, so the end state fits any CTB size
+        for (uint32_t ctbLog2SizeY = 4; ctbLog2SizeY <= 6; ctbLog2SizeY++)
+        {
+            hcpBufSizePar.dwCtbLog2SizeY = ctbLog2SizeY;
+            DECODE_CHK_STATUS(AllocateVariableResources(hcpBufSizePar));
+        }
+
+        return MOS_STATUS_SUCCESS;
+    }
+
+    MOS_STATUS HevcDecodePicPkt::AllocateVariableResources(HcpBufferSizePar &hcpBufSizePar)
+    {
+        DECODE_FUNC_CALL();
+
         auto AllocateBuffer = [&](PMOS_BUFFER &buffer, const HCP_INTERNAL_BUFFER_TYPE bufferType, const char *bufferName) {
             uint32_t bufSize = 0;
             hcpBufSizePar.bufferType = bufferType;
@@ -646,6 +677,16 @@ namespace decode
                 }
 
                 params.presReferences[i] = refFrames.GetReferenceByFrameIndex(frameIdx);
+                if (params.presReferences[i] == nullptr && m_hevcPipeline->IsErrorRecoveryEnabled())
+                {
+                    // Conceal with the nearest valid reference and keep decoding without reset
+                    params.presReferences[i] = refFrames.GetNearestValidReference(*m_hevcPicParams, frameIdx, frameIdx);
+                    if (params.presReferences[i] != nullptr)
+                    {
+                        DECODE_NORMALMESSAGE("Reference frame for current frame is missing, substituted for error recovery.");
+                        refFrames.MarkCurFrameCorrupted(*m_hevcPicParams);
+                    }
+                }
                 if (params.presReferences[i] == nullptr)
                 {
                     PCODEC_REF_LIST curFrameInRefList = refFrames.m_refList[m_hevcPicParams->CurrPic.FrameIdx];
@@ -64,6 +64,14 @@ public:
     //!
     virtual MOS_STATUS Prepare() override;
 
+    //!
+    //! \brief  Allocate row store and stream out buffers for the largest
+    //!         frame hinted at creation, for all CTB sizes
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    virtual MOS_STATUS PreAllocate() override;
+
     //! \brief   Set current phase for packet
     //!
     //! \return   MOS_STATUS
@@ -88,6 +96,7 @@ public:
 protected:
     virtual MOS_STATUS AllocateFixedResources();
     virtual MOS_STATUS AllocateVariableResources();
+    MOS_STATUS         AllocateVariableResources(mhw::vdbox::hcp::HcpBufferSizePar &hcpBufSizePar);
     MOS_STATUS         FixHcpPipeBufAddrParams(mhw::vdbox::hcp::HCP_PIPE_BUF_ADDR_STATE_PAR &par) const;
     MOS_STATUS         AddAllCmds_HCP_SURFACE_STATE(MOS_COMMAND_BUFFER &cmdBuffer);
     MOS_STATUS         AddAllCmds_HCP_QM_STATE(MOS_COMMAND_BUFFER &cmdBuffer);
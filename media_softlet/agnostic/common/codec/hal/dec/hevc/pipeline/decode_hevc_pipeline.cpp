@@ -248,7 +248,7 @@ MOS_STATUS HevcPipeline::CreatePhaseList(HevcBasicFeature &basicFeature, const S
     DECODE_FUNC_CALL();
     DECODE_ASSERT(m_phaseList.empty());
 
-    if (basicFeature.m_shortFormatInUse)
+    if (basicFeature.IsShortFormatFrame())
     {
         DECODE_CHK_STATUS(CreatePhase<HevcPhaseS2L>());
     }
@@ -313,7 +313,7 @@ MOS_STATUS HevcPipeline::HwStatusCheck(const DecodeStatusMfx &status)
 {
     DECODE_FUNC_CALL();
 
-    if (m_basicFeature->m_shortFormatInUse)
+    if (m_basicFeature->IsShortFormatFrame())
     {
         // Check HuC_status2 Imem loaded bit, if 0, return error
         if (((status.m_hucErrorStatus2 >> 32) && (m_hwInterface->GetHucInterfaceNext()->GetHucStatus2ImemLoadedMask())) == 0)
@@ -346,7 +346,7 @@ MOS_STATUS HevcPipeline::HwStatusCheck(const DecodeStatusMfx &status)
 
 bool HevcPipeline::IsShortFormat()
 {
-    return m_basicFeature->m_shortFormatInUse;
+    return m_basicFeature->IsShortFormatFrame();
 }
 
 HevcPipeline::HevcDecodeMode HevcPipeline::GetDecodeMode()
@@ -50,6 +50,12 @@ DecodeAllocator::DecodeAllocator(PMOS_INTERFACE osInterface, bool limitedLMemBar
 
 DecodeAllocator::~DecodeAllocator()
 {
+    for (auto &pooled : m_bufferPool)
+    {
+        Destroy(pooled.buffer);
+    }
+    m_bufferPool.clear();
+
     MOS_Delete(m_allocator);
 }
 
@@ -77,6 +83,7 @@ MOS_BUFFER* DecodeAllocator::AllocateBuffer(
     {
         return nullptr;
     }
+    m_allocationCount++;
 
     if (initOnAllocate)
     {
@@ -153,6 +160,7 @@ MOS_SURFACE* DecodeAllocator::AllocateSurface(
     {
         return nullptr;
     }
+    m_allocationCount++;
     if (GetSurfaceInfo(surface) != MOS_STATUS_SUCCESS)
     {
         DECODE_ASSERTMESSAGE("Failed to get surface informaton for %s", nameOfSurface);
@@ -191,6 +199,7 @@ MOS_SURFACE *DecodeAllocator::AllocateLinearSurface(
     {
         return nullptr;
     }
+    m_allocationCount++;
     if (GetSurfaceInfo(surface) != MOS_STATUS_SUCCESS)
     {
         DECODE_ASSERTMESSAGE("Failed to get surface informaton for %s", nameOfSurface);
@@ -260,6 +269,7 @@ PMHW_BATCH_BUFFER DecodeAllocator::AllocateBatchBuffer(
         MOS_Delete(batchBuffer);
         return nullptr;
     }
+    m_allocationCount++;
 
     return batchBuffer;
 }
@@ -455,6 +465,88 @@ MOS_STATUS DecodeAllocator::Resize(
     return MOS_STATUS_SUCCESS;
 }
 
+uint32_t DecodeAllocator::GetPoolSizeClass(uint32_t size)
+{
+    uint32_t msb = 0;
+    while ((size >> msb) > 1)
+    {
+        msb++;
+    }
+
+    uint32_t step = MOS_MAX((1u << msb) >> 3, (uint32_t)MOS_PAGE_SIZE);
+    return MOS_ALIGN_CEIL(size, step);
+}
+
+MOS_BUFFER* DecodeAllocator::AllocatePooledBuffer(const uint32_t sizeOfBuffer, const char* nameOfBuffer,
+    ResourceUsage resUsageType, ResourceAccessReq accessReq)
+{
+    // Pool is ascending by size, so the first match is the best fit
+    for (auto iter = m_bufferPool.begin(); iter != m_bufferPool.end(); iter++)
+    {
+        if (iter->buffer->size >= sizeOfBuffer &&
+            iter->resUsageType == resUsageType &&
+            iter->accessReq == accessReq)
+        {
+            MOS_BUFFER *buffer = iter->buffer;
+            m_bufferPool.erase(iter);
+            buffer->name = nameOfBuffer;
+            return buffer;
+        }
+    }
+
+    return AllocateBuffer(GetPoolSizeClass(sizeOfBuffer), nameOfBuffer, resUsageType, accessReq);
+}
+
+MOS_STATUS DecodeAllocator::ResizePooled(MOS_BUFFER* &buffer, const uint32_t sizeNew, ResourceAccessReq accessReq)
+{
+    DECODE_CHK_NULL(buffer);
+
+    // Smaller resolution only uses the front part of the largest seen buffer
+    if (sizeNew <= buffer->size)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    ResourceUsage resUsageType = ConvertGmmResourceUsage(buffer->OsResource.pGmmResInfo->GetCachePolicyUsage());
+    MOS_BUFFER *bufferNew = AllocatePooledBuffer(sizeNew, buffer->name, resUsageType, accessReq);
+    DECODE_CHK_NULL(bufferNew);
+
+    DECODE_CHK_STATUS(Recycle(buffer, accessReq));
+    buffer = bufferNew;
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS DecodeAllocator::Recycle(MOS_BUFFER* &buffer, ResourceAccessReq accessReq)
+{
+    DECODE_CHK_NULL(m_allocator);
+    if (buffer == nullptr)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    PooledBuffer pooled;
+    pooled.buffer       = buffer;
+    pooled.resUsageType = ConvertGmmResourceUsage(buffer->OsResource.pGmmResInfo->GetCachePolicyUsage());
+    pooled.accessReq    = accessReq;
+    buffer              = nullptr;
+
+    auto iter = m_bufferPool.begin();
+    while (iter != m_bufferPool.end() && iter->buffer->size < pooled.buffer->size)
+    {
+        iter++;
+    }
+    m_bufferPool.insert(iter, pooled);
+
+    if (m_bufferPool.size() > m_bufferPoolMaxNum)
+    {
+        DECODE_CHK_STATUS(Destroy(m_bufferPool.front().buffer));
+        m_bufferPool.erase(m_bufferPool.begin());
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
 MOS_STATUS DecodeAllocator::Destroy(MOS_BUFFER* & buffer)
 {
     DECODE_CHK_NULL(m_allocator);
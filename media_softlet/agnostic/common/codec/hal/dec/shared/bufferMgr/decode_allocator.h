@@ -295,6 +295,57 @@ public:
     MOS_STATUS Resize(PMHW_BATCH_BUFFER &batchBuffer, const uint32_t sizeOfBufferNew, const uint32_t numOfBufferNew,
         ResourceAccessReq accessReq = lockableVideoMem);
 
+    //!
+    //! \brief  Allocate buffer from recycle pool
+    //! \details Hand out the smallest recycled buffer which is large enough,
+    //!          otherwise allocate a new one rounded up to the pool size class
+    //! \param  [in] sizeOfBuffer
+    //!         Buffer size
+    //! \param  [in] nameOfBuffer
+    //!         Buffer name
+    //! \param  [in] resUsageType
+    //!         ResourceUsage to be set
+    //! \param  [in] accessReq
+    //!         Resource access requirement
+    //! \return MOS_BUFFER*
+    //!         return the pointer to MOS_BUFFER, its size may exceed sizeOfBuffer
+    //!
+    MOS_BUFFER* AllocatePooledBuffer(const uint32_t sizeOfBuffer, const char* nameOfBuffer,
+        ResourceUsage resUsageType, ResourceAccessReq accessReq);
+
+    //!
+    //! \brief  Resize linear buffer through recycle pool
+    //! \details Smaller sizes keep using the current buffer, for larger sizes
+    //!          the current buffer is recycled and replaced from the pool
+    //! \param  [in/out] buffer
+    //!         The pointer of linear buffer
+    //! \param  [in] sizeNew
+    //!         New size for linear buffer
+    //! \param  [in] accessReq
+    //!         Resource access requirement
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS ResizePooled(MOS_BUFFER* &buffer, const uint32_t sizeNew, ResourceAccessReq accessReq);
+
+    //!
+    //! \brief  Recycle buffer to pool for later AllocatePooledBuffer
+    //! \param  [in/out] buffer
+    //!         The buffer to be recycled, set to nullptr
+    //! \param  [in] accessReq
+    //!         Resource access requirement the buffer was allocated with
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS Recycle(MOS_BUFFER* &buffer, ResourceAccessReq accessReq);
+
+    //!
+    //! \brief  Get the number of resources allocated so far
+    //! \return uint32_t
+    //!         Count of buffer, surface and batch buffer allocations
+    //!
+    uint32_t GetAllocationCount() { return m_allocationCount; }
+
     //!
     //! \brief  Destroy buffer
     //! \param  [in] resource
@@ -548,10 +599,30 @@ protected:
     //!
     void SetAccessRequirement(ResourceAccessReq accessReq, MOS_ALLOC_GFXRES_PARAMS &allocParams);
 
+    //!
+    //! \brief    Round buffer size up to pool size class
+    //! \param    uint32_t size
+    //!           [in] Requested size
+    //! \return   uint32_t
+    //!           Size class, at most 1/8 larger than size
+    //!
+    static uint32_t GetPoolSizeClass(uint32_t size);
+
+    struct PooledBuffer
+    {
+        MOS_BUFFER        *buffer;
+        ResourceUsage     resUsageType;
+        ResourceAccessReq accessReq;
+    };
+
     PMOS_INTERFACE m_osInterface = nullptr;  //!< PMOS_INTERFACE
     Allocator *m_allocator = nullptr;
     bool m_limitedLMemBar = false; //!< Indicate if running with limited LMem bar config
 
+    std::vector<PooledBuffer> m_bufferPool;              //!< Recycled buffers, ascending by size
+    static const uint32_t     m_bufferPoolMaxNum = 32;   //!< Max recycled buffers, smallest are evicted first
+    uint32_t                  m_allocationCount  = 0;    //!< Number of resources allocated
+
 #if (_DEBUG || _RELEASE_INTERNAL)
     bool m_forceLockable = false;
 #endif
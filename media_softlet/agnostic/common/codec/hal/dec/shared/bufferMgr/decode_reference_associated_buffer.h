@@ -126,6 +126,10 @@ public:
 
     //!
     //! \brief  Update buffers for current picture
+    //! \details This is already incremental: buffers of references that stay in
+    //!          the list keep their entry, retired ones are parked and recycled
+    //!          for the current frame, so a sliding-window DPB change moves one
+    //!          buffer and allocates nothing once the pool is warm.
     //! \param  [in] frameIdx
     //!         The frame index for current picture
     //! \param  [in] refFrameList
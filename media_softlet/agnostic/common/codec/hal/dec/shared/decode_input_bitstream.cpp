@@ -93,6 +93,7 @@ MOS_STATUS DecodeInputBitstream::Begin()
     DECODE_CHK_STATUS(DecodeSubPipeline::Reset());
 
     m_segmentsTotalSize = 0;
+    m_segments.clear();
     return MOS_STATUS_SUCCESS;
 }
 
@@ -125,11 +126,8 @@ MOS_STATUS DecodeInputBitstream::Append(const CodechalDecodeParams &decodeParams
         bool isIncompleteBitstream = (segmentSize < m_requiredSize);
         if (isIncompleteBitstream)
         {
-            DECODE_CHK_STATUS(AllocateCatenatedBuffer());
-            m_basicFeature->m_resDataBuffer = *m_catenatedBuffer;
-            m_basicFeature->m_dataOffset = 0;
-            DECODE_CHK_STATUS(ActivatePacket(DecodePacketId(m_pipeline, hucCopyPacketId), true, 0, 0));
-            AddNewSegment(*(decodeParams.m_dataBuffer), decodeParams.m_dataOffset, decodeParams.m_dataSize);
+            DECODE_CHK_NULL(decodeParams.m_dataBuffer);
+            QueueSegment(*(decodeParams.m_dataBuffer), decodeParams.m_dataOffset, decodeParams.m_dataSize);
         }
     }
     else
@@ -139,12 +137,74 @@ MOS_STATUS DecodeInputBitstream::Append(const CodechalDecodeParams &decodeParams
             DECODE_ASSERTMESSAGE("Bitstream size exceeds allocated buffer size!");
             return MOS_STATUS_INVALID_PARAMETER;
         }
-        DECODE_CHK_STATUS(ActivatePacket(DecodePacketId(m_pipeline, hucCopyPacketId), true, 0, 0));
-        AddNewSegment(*(decodeParams.m_dataBuffer), decodeParams.m_dataOffset, decodeParams.m_dataSize);
+        DECODE_CHK_NULL(decodeParams.m_dataBuffer);
+        QueueSegment(*(decodeParams.m_dataBuffer), decodeParams.m_dataOffset, decodeParams.m_dataSize);
     }
 
     m_segmentsTotalSize += MOS_ALIGN_CEIL(segmentSize, MHW_CACHELINE_SIZE);
 
+    if (IsComplete() && !m_segments.empty())
+    {
+        DECODE_CHK_STATUS(FlushSegments());
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
+void DecodeInputBitstream::QueueSegment(const MOS_RESOURCE &resource, uint32_t offset, uint32_t size)
+{
+    if (!m_segments.empty())
+    {
+        // A segment continuing the previous one lands at the same place in the
+        // catenated bitstream as long as the previous one ends on a cacheline.
+        Segment &last = m_segments.back();
+        if (last.resource.pGmmResInfo != nullptr &&
+            last.resource.pGmmResInfo == resource.pGmmResInfo &&
+            last.offset + last.size == offset &&
+            MOS_IS_ALIGNED(last.size, MHW_CACHELINE_SIZE))
+        {
+            last.size += size;
+            return;
+        }
+    }
+
+    Segment segment;
+    segment.resource   = resource;
+    segment.offset     = offset;
+    segment.size       = size;
+    segment.destOffset = m_segmentsTotalSize;
+    m_segments.push_back(segment);
+}
+
+MOS_STATUS DecodeInputBitstream::FlushSegments()
+{
+    if (m_segments.size() == 1)
+    {
+        // The whole bitstream is contiguous in the source buffer, decode it in place
+        m_basicFeature->m_resDataBuffer = m_segments[0].resource;
+        m_basicFeature->m_dataOffset    = m_segments[0].offset;
+        m_segments.clear();
+        return MOS_STATUS_SUCCESS;
+    }
+
+    DECODE_CHK_STATUS(AllocateCatenatedBuffer());
+    m_basicFeature->m_resDataBuffer = *m_catenatedBuffer;
+    m_basicFeature->m_dataOffset    = 0;
+    DECODE_CHK_STATUS(ActivatePacket(DecodePacketId(m_pipeline, hucCopyPacketId), true, 0, 0));
+
+    // m_segments holds the source resources until Begin of the next frame,
+    // after the copy packet has consumed them.
+    for (auto &segment : m_segments)
+    {
+        HucCopyPktItf::HucCopyParams copyParams;
+        copyParams.srcBuffer  = &segment.resource;
+        copyParams.srcOffset  = segment.offset;
+        copyParams.destBuffer = &(m_catenatedBuffer->OsResource);
+        copyParams.destOffset = segment.destOffset;
+        copyParams.copyLength = segment.size;
+        DECODE_CHK_STATUS(m_concatPkt->PushCopyParams(copyParams));
+    }
+
     return MOS_STATUS_SUCCESS;
 }
 
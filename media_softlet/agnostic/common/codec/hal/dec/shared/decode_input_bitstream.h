@@ -46,8 +46,9 @@ public:
     struct Segment
     {
         MOS_RESOURCE resource;
-        uint32_t     offset = 0;
-        uint32_t     size   = 0;
+        uint32_t     offset     = 0;
+        uint32_t     size       = 0;
+        uint32_t     destOffset = 0;   //!< Offset of the segment in the catenated bitstream
     };
 
     //!
@@ -125,6 +126,30 @@ protected:
     //!
     void AddNewSegment(MOS_RESOURCE& resource, uint32_t offset, uint32_t size);
 
+    //!
+    //! \brief  Queue a segment of an incomplete bitstream
+    //! \details Segments which continue the previous one in the same buffer
+    //!         are merged with it, so they need a single copy or none at all.
+    //!         The source buffers must stay valid until the bitstream is complete.
+    //! \param  [in] resource
+    //!         Resource of current segment
+    //! \param  [in] offset
+    //!         Offset of current segment
+    //! \param  [in] size
+    //!         Size of current segment
+    //!
+    void QueueSegment(const MOS_RESOURCE &resource, uint32_t offset, uint32_t size);
+
+    //!
+    //! \brief  Resolve the queued segments once the bitstream is complete
+    //! \details Decodes straight from the source buffer when all segments
+    //!         merged into one, otherwise copies each merged segment into
+    //!         the catenated buffer with HuC.
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS FlushSegments();
+
     //!
     //! \brief  Initialize scalability parameters
     //!
@@ -145,6 +170,7 @@ protected:
     PMOS_BUFFER     m_catenatedBuffer   = nullptr;   //!< Catenated bitstream for decode
     uint32_t        m_requiredSize      = 0;         //!< Size of bitstream in bytes of current frame
     uint32_t        m_segmentsTotalSize = 0;         //!< Total size of segments in m_segments
+    std::vector<Segment> m_segments;                 //!< Segments of current frame not resolved yet
 
 MEDIA_CLASS_DEFINE_END(decode__DecodeInputBitstream)
 };
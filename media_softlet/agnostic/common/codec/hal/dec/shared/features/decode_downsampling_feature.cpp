@@ -51,7 +51,7 @@ DecodeDownSamplingFeature::~DecodeDownSamplingFeature()
         {
             continue;
         }
-        MOS_STATUS eStatus = m_allocator->Destroy(m_histogramBuffer);
+        MOS_STATUS eStatus = m_allocator->Destroy(m_histogramBufferList[i]);
         if (eStatus != MOS_STATUS_SUCCESS)
         {
             DECODE_ASSERTMESSAGE("Failed to free histogram internal buffer!");
@@ -78,6 +78,7 @@ MOS_STATUS DecodeDownSamplingFeature::Init(void *setting)
 #if (_DEBUG || _RELEASE_INTERNAL)
     m_histogramDebug = ReadUserFeature(m_userSettingPtr, "Decode Histogram Debug", MediaUserSetting::Group::Sequence).Get<bool>();
 #endif
+    m_histogramDirectEnabled = ReadUserFeature(m_userSettingPtr, "Decode Histogram Direct Output", MediaUserSetting::Group::Sequence).Get<bool>();
 
     return MOS_STATUS_SUCCESS;
 }
@@ -152,11 +153,26 @@ MOS_STATUS DecodeDownSamplingFeature::Update(void *params)
     }
 
     // Histogram
+    m_histogramOffset = 0;
+    m_histogramDirect = false;
     if (m_allocator->ResourceIsNull(&decodeParams->m_histogramSurface.OsResource) && !m_histogramDebug)
     {
         m_histogramDestSurf = nullptr;
         m_histogramBuffer   = nullptr;
     }
+    else if (m_histogramDirectEnabled &&
+             !m_allocator->ResourceIsNull(&decodeParams->m_histogramSurface.OsResource))
+    {
+        // SFC streams the histogram out in the same VDBOX pass as the scaled output,
+        // so writing it to the application surface saves the extra copy submission.
+        m_histogramDestSurf              = &decodeParams->m_histogramSurface;
+        m_histogramDestBuffer.OsResource = decodeParams->m_histogramSurface.OsResource;
+        m_histogramDestBuffer.size       = HISTOGRAM_BINCOUNT * m_histogramBinWidth;
+        m_histogramDestBuffer.name       = "Histogram output buffer";
+        m_histogramBuffer                = &m_histogramDestBuffer;
+        m_histogramOffset                = decodeParams->m_histogramSurface.dwOffset;
+        m_histogramDirect                = true;
+    }
     else
     {
         m_histogramDestSurf = &decodeParams->m_histogramSurface;
@@ -242,7 +258,8 @@ MOS_STATUS DecodeDownSamplingFeature::DumpSfcOutputs(CodechalDebugInterface* deb
                 &m_histogramBuffer->OsResource,
                 CodechalDbgAttr::attrSfcHistogram,
                 "_DEC",
-                HISTOGRAM_BINCOUNT * m_histogramBinWidth));)
+                HISTOGRAM_BINCOUNT * m_histogramBinWidth,
+                m_histogramOffset));)
     }
 
     // Dump SFC
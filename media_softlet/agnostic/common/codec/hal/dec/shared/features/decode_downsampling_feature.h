@@ -87,8 +87,10 @@ public:
     CODECHAL_SCALING_MODE  m_scalingMode = CODECHAL_SCALING_NEAREST;
 
     // Histogram
-    PMOS_BUFFER    m_histogramBuffer   = nullptr;  // SFC histogram internal buffer for current frame
+    PMOS_BUFFER    m_histogramBuffer   = nullptr;  // SFC histogram output buffer for current frame
+    uint32_t       m_histogramOffset   = 0;        // SFC histogram output offset in m_histogramBuffer
     PMOS_SURFACE   m_histogramDestSurf = nullptr;  // SFC histogram dest surface
+    bool           m_histogramDirect   = false;    // SFC writes histogram to dest surface, no copy required
     bool           m_histogramDebug    = false;
     const uint32_t m_histogramBinWidth = 4;
 
@@ -111,6 +113,8 @@ protected:
 
     InternalTargets      m_internalTargets; //!< Internal targets for downsampling input if application dosen't prepare
     PMOS_BUFFER          m_histogramBufferList[DecodeBasicFeature::m_maxFrameIndex] = {};  //! \brief Internal histogram output buffer list
+    MOS_BUFFER           m_histogramDestBuffer = {};          //! \brief Wrapper of application histogram surface for direct output
+    bool                 m_histogramDirectEnabled = true;     //! \brief Allow SFC to write histogram to application surface
 
 MEDIA_CLASS_DEFINE_END(decode__DecodeDownSamplingFeature)
 };
@@ -151,7 +151,8 @@ MOS_STATUS DecodeDownSamplingPkt::InitSfcParams(VDBOX_SFC_PARAMS &sfcParams)
     // If histogram is enabled
     if (m_downSampling->m_histogramDestSurf || m_downSampling->m_histogramDebug)
     {
-        sfcParams.output.histogramBuf = m_downSampling->m_histogramBuffer;
+        sfcParams.output.histogramBuf    = m_downSampling->m_histogramBuffer;
+        sfcParams.output.histogramOffset = m_downSampling->m_histogramOffset;
     }
 
     return MOS_STATUS_SUCCESS;
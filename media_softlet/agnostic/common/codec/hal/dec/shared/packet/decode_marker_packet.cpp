@@ -65,6 +65,8 @@ MOS_STATUS DecodeMarkerPkt::Execute(MOS_COMMAND_BUFFER& cmdBuffer)
         return MOS_STATUS_SUCCESS;
     }
 
+    PERF_UTILITY_AUTO(__FUNCTION__, PERF_DECODE, PERF_LEVEL_HAL);
+
     if (m_pipeline->GetMediaContext()->IsRenderEngineUsed())
     {
         // Send pipe_control to get the timestamp
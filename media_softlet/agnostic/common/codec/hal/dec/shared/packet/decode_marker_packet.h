@@ -65,6 +65,13 @@ public:
     //!
     virtual MOS_STATUS Prepare() override;
 
+    //!
+    //! \brief  Nothing to prepare per frame, commands only depend on the feature
+    //! \return bool
+    //!         Always false
+    //!
+    virtual bool IsPrepareRequired() override { return false; }
+
     //!
     //! \brief  Execute sub packet
     //! \return MOS_STATUS
@@ -65,6 +65,8 @@ MOS_STATUS DecodePredicationPkt::Execute(MOS_COMMAND_BUFFER& cmdBuffer)
         return MOS_STATUS_SUCCESS;
     }
 
+    PERF_UTILITY_AUTO(__FUNCTION__, PERF_DECODE, PERF_LEVEL_HAL);
+
     MHW_MI_CONDITIONAL_BATCH_BUFFER_END_PARAMS  condBBEndParams;
     MOS_ZeroMemory(&condBBEndParams, sizeof(condBBEndParams));
 
@@ -69,6 +69,21 @@ public:
     //!
     virtual MOS_STATUS Prepare() = 0;
 
+    //!
+    //! \brief  Indicate whether Prepare has per frame work, queried once after Init
+    //! \return bool
+    //!         false to skip this sub packet in per frame prepare
+    //!
+    virtual bool IsPrepareRequired() { return true; }
+
+    //!
+    //! \brief  Allocate per frame resources for the resolution hinted at creation
+    //! \details Invoked once after Init so the first Prepare does not allocate
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    virtual MOS_STATUS PreAllocate() { return MOS_STATUS_SUCCESS; }
+
     //! \brief  Calculate Command Size
     //!
     //! \param  [in, out] commandBufferSize
@@ -64,18 +64,32 @@ DecodeSubPacket* DecodeSubPacketManager::GetSubPacket(uint32_t packetId)
 
 MOS_STATUS DecodeSubPacketManager::Init()
 {
+    m_prepareList.clear();
     for (auto subPacket : m_subPacketList)
     {
         subPacket.second->Init();
+        if (subPacket.second->IsPrepareRequired())
+        {
+            m_prepareList.push_back(subPacket.second);
+        }
     }
     return MOS_STATUS_SUCCESS;
 }
 
 MOS_STATUS DecodeSubPacketManager::Prepare()
+{
+    for (auto subPacket : m_prepareList)
+    {
+        subPacket->Prepare();
+    }
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS DecodeSubPacketManager::PreAllocate()
 {
     for (auto subPacket : m_subPacketList)
     {
-        subPacket.second->Prepare();
+        DECODE_CHK_STATUS(subPacket.second->PreAllocate());
     }
     return MOS_STATUS_SUCCESS;
 }
@@ -30,6 +30,7 @@
 #define __DECODE_SUB_PACKET_MANAGER_H__
 
 #include "decode_sub_packet.h"
+#include <vector>
 
 namespace decode
 {
@@ -79,8 +80,16 @@ public:
     //!
     MOS_STATUS Prepare();
 
+    //!
+    //! \brief  Pre-allocate per frame resources of all decode sub packets
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS PreAllocate();
+
 protected:
     std::map<uint32_t, DecodeSubPacket *> m_subPacketList; //!< sub packet list
+    std::vector<DecodeSubPacket *>        m_prepareList;   //!< sub packets with per frame prepare
 
 MEDIA_CLASS_DEFINE_END(decode__DecodeSubPacketManager)
 };
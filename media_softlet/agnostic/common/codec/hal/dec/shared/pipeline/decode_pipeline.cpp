@@ -55,6 +55,12 @@ DecodePipeline::DecodePipeline(
 
     m_singleTaskPhaseSupported =
         ReadUserFeature(m_userSettingPtr, "Decode Single Task Phase Enable", MediaUserSetting::Group::Sequence).Get<bool>();
+    m_maxBatchedFrames =
+        ReadUserFeature(m_userSettingPtr, "Decode Batched Frames", MediaUserSetting::Group::Sequence).Get<uint32_t>();
+    m_preAllocEnabled =
+        ReadUserFeature(m_userSettingPtr, "Decode Pre Allocate Enable", MediaUserSetting::Group::Sequence).Get<bool>();
+    m_errorRecoveryEnabled =
+        ReadUserFeature(m_userSettingPtr, "Decode Error Recovery Enable", MediaUserSetting::Group::Sequence).Get<bool>();
 
     m_pCodechalOcaDumper = MOS_New(CodechalOcaDumper);
     if (!m_pCodechalOcaDumper)
@@ -143,6 +149,12 @@ MOS_STATUS DecodePipeline::CreateSubPacketManager(CodechalSetting* codecSettings
     DECODE_CHK_NULL(m_subPacketManager);
     DECODE_CHK_STATUS(CreateSubPackets(*m_subPacketManager, *codecSettings));
     DECODE_CHK_STATUS(m_subPacketManager->Init());
+
+    // Resolve the prolog sub packets once instead of per frame lookup and cast
+    m_predicationPkt = dynamic_cast<DecodePredicationPkt *>(
+        m_subPacketManager->GetSubPacket(DecodePacketId(this, predicationSubPacketId)));
+    m_markerPkt = dynamic_cast<DecodeMarkerPkt *>(
+        m_subPacketManager->GetSubPacket(DecodePacketId(this, markerSubPacketId)));
     return MOS_STATUS_SUCCESS;
 }
 
@@ -196,13 +208,45 @@ MOS_STATUS DecodePipeline::Initialize(void *settings)
     DECODE_CHK_STATUS(CreateSubPipeLineManager(codecSettings));
     DECODE_CHK_STATUS(CreateSubPacketManager(codecSettings));
 
+    m_initAllocCount = m_allocator->GetAllocationCount();
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS DecodePipeline::PreAllocate()
+{
+    DECODE_FUNC_CALL();
+
+    DECODE_CHK_NULL(m_allocator);
+    DECODE_CHK_NULL(m_subPacketManager);
+
+    if (m_preAllocEnabled)
+    {
+        DECODE_CHK_STATUS(m_subPacketManager->PreAllocate());
+    }
+
+    m_initAllocCount = m_allocator->GetAllocationCount();
+
     return MOS_STATUS_SUCCESS;
 }
 
+uint32_t DecodePipeline::GetExecuteAllocationCount()
+{
+    if (m_allocator == nullptr)
+    {
+        return 0;
+    }
+
+    return m_allocator->GetAllocationCount() - m_initAllocCount;
+}
+
 MOS_STATUS DecodePipeline::Uninitialize()
 {
     DECODE_FUNC_CALL();
 
+    // Batched frames must be submitted before waiting for them.
+    FlushBatchedFrames();
+
     // Wait all cmd completion before delete resource.
     m_osInterface->pfnWaitAllCmdCompletion(m_osInterface);
 
@@ -219,6 +263,13 @@ MOS_STATUS DecodePipeline::Uninitialize()
     MOS_Delete(m_postSubPipeline);
     MOS_Delete(m_subPacketManager);
 
+    // Allocations while executing frames show where pre-allocation is missing
+    ReportUserSetting(
+        m_userSettingPtr,
+        "Decode Execute Allocation Count",
+        GetExecuteAllocationCount(),
+        MediaUserSetting::Group::Sequence);
+
     MOS_Delete(m_allocator);
 
     return MOS_STATUS_SUCCESS;
@@ -271,6 +322,7 @@ MOS_STATUS DecodePipeline::Prepare(void *params)
 
     DECODE_CHK_STATUS(m_task->Clear());
     m_activePacketList.clear();
+    m_deferFrameSubmit = false;
 
     DECODE_CHK_NULL(m_featureManager);
     DECODE_CHK_STATUS(m_featureManager->CheckFeatures(decodeParams));
@@ -287,10 +339,27 @@ MOS_STATUS DecodePipeline::Prepare(void *params)
 }
 
 MOS_STATUS DecodePipeline::ExecuteActivePackets()
+{
+    DECODE_FUNC_CALL();
+
+    if (m_maxBatchedFrames <= 1)
+    {
+        return SubmitActivePackets();
+    }
+
+    m_batchMutex.Lock();
+    MOS_STATUS status = SubmitActivePackets();
+    m_batchMutex.Unlock();
+    return status;
+}
+
+MOS_STATUS DecodePipeline::SubmitActivePackets()
 {
     DECODE_FUNC_CALL();
     MOS_TraceEventExt(EVENT_PIPE_EXE, EVENT_TYPE_START, nullptr, 0, nullptr, 0);
 
+    bool deferSubmit = m_deferFrameSubmit;
+
     // Last element in m_activePacketList must be immediately submitted
     m_activePacketList.back().immediateSubmit = true;
 
@@ -304,15 +373,73 @@ MOS_STATUS DecodePipeline::ExecuteActivePackets()
         DECODE_CHK_STATUS(task->AddPacket(&prop));
         if (prop.immediateSubmit)
         {
-            DECODE_CHK_STATUS(task->Submit(true, m_scalability, m_debugInterface));
+            DECODE_CHK_STATUS(task->Submit(!deferSubmit, m_scalability, m_debugInterface));
         }
     }
 
     m_activePacketList.clear();
+    m_deferFrameSubmit = false;
+    // An immediate submission carries the frames batched before it on this context
+    m_batchedFrames = deferSubmit ? (m_batchedFrames + 1) : 0;
     MOS_TraceEventExt(EVENT_PIPE_EXE, EVENT_TYPE_END, nullptr, 0, nullptr, 0);
     return MOS_STATUS_SUCCESS;
 }
 
+void DecodePipeline::SetFrameBatching(bool batchable)
+{
+    m_deferFrameSubmit = batchable &&
+                         (m_maxBatchedFrames > 1) &&
+                         (m_scalability != nullptr) &&
+                         (m_scalability->GetPipeNumber() == 1) &&
+                         (m_batchedFrames + 1 < m_maxBatchedFrames);
+}
+
+MOS_STATUS DecodePipeline::FlushBatchedFrames()
+{
+    DECODE_FUNC_CALL();
+
+    if (m_maxBatchedFrames <= 1)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    m_batchMutex.Lock();
+    MOS_STATUS status = SubmitBatchedFrames();
+    m_batchMutex.Unlock();
+    return status;
+}
+
+MOS_STATUS DecodePipeline::SubmitBatchedFrames()
+{
+    DECODE_FUNC_CALL();
+
+    if (m_batchedFrames == 0)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+    m_batchedFrames = 0;
+
+    DECODE_CHK_NULL(m_scalability);
+    DECODE_CHK_NULL(m_hwInterface);
+
+    MOS_COMMAND_BUFFER cmdBuffer;
+    MOS_ZeroMemory(&cmdBuffer, sizeof(MOS_COMMAND_BUFFER));
+    DECODE_CHK_STATUS(m_scalability->GetCmdBuffer(&cmdBuffer));
+
+    // Batched frames leave the command buffer open, close it here
+    if (!m_osInterface->pfnIsMismatchOrderProgrammingSupported())
+    {
+        auto miItf = m_hwInterface->GetMiInterfaceNext();
+        DECODE_CHK_NULL(miItf);
+        DECODE_CHK_STATUS(miItf->AddMiBatchBufferEnd(&cmdBuffer, nullptr));
+    }
+
+    DECODE_CHK_STATUS(m_scalability->ReturnCmdBuffer(&cmdBuffer));
+    DECODE_CHK_STATUS(m_scalability->SubmitCmdBuffer(&cmdBuffer));
+
+    return MOS_STATUS_SUCCESS;
+}
+
 bool DecodePipeline::IsCompleteBitstream()
 {
     return (m_bitstream == nullptr) ? false : m_bitstream->IsComplete();
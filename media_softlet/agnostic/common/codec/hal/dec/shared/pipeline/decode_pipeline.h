@@ -78,6 +78,8 @@ struct DecodePipelineParams
 
 class DecodeSubPacket;
 class DecodeSubPacketManager;
+class DecodePredicationPkt;
+class DecodeMarkerPkt;
 
 class DecodePipeline : public MediaPipeline
 {
@@ -121,6 +123,20 @@ public:
     //!
     DecodeSubPacket* GetSubPacket(uint32_t subPacketId);
 
+    //!
+    //! \brief    Get predication sub packet, resolved once at creation
+    //!
+    //! \return   Predication sub packet if registered, else nullptr
+    //!
+    DecodePredicationPkt *GetPredicationPkt() { return m_predicationPkt; }
+
+    //!
+    //! \brief    Get marker sub packet, resolved once at creation
+    //!
+    //! \return   Marker sub packet if registered, else nullptr
+    //!
+    DecodeMarkerPkt *GetMarkerPkt() { return m_markerPkt; }
+
     //!
     //! \brief  Get if SingleTaskPhaseSupported
     //! \return bool
@@ -128,6 +144,48 @@ public:
     //!
     bool IsSingleTaskPhaseSupported() { return m_singleTaskPhaseSupported; };
 
+    //!
+    //! \brief  Submit the frames recorded by frame batching
+    //! \details Must be called before the output of a batched frame is used
+    //!         outside this pipeline. Does nothing if no frame is pending.
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS FlushBatchedFrames();
+
+    //!
+    //! \brief  Get if current frame is recorded without submission
+    //! \details Packets must not end the command buffer for such a frame
+    //! \return bool
+    //!         true if the frame is batched with the following frames
+    //!
+    bool IsFrameSubmissionDeferred() { return m_deferFrameSubmit; };
+
+    //!
+    //! \brief  Get if error recovery is enabled
+    //! \details Missing references are concealed with the nearest valid reference
+    //!         instead of failing the frame, so decode continues without reset
+    //! \return bool
+    //!         true if error recovery is enabled
+    //!
+    bool IsErrorRecoveryEnabled() { return m_errorRecoveryEnabled; };
+
+    //!
+    //! \brief  Pre-allocate per frame resources for the resolution hinted at creation
+    //! \details Invoked once from Init after all packets are created, so the
+    //!          first frame does not allocate in Prepare
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS PreAllocate();
+
+    //!
+    //! \brief  Get the number of resources allocated after initialization
+    //! \return uint32_t
+    //!         Allocations done while executing frames
+    //!
+    uint32_t GetExecuteAllocationCount();
+
     //!
     //! \brief  Get the resource allocator for decode
     //! \return DecodeAllocator *
@@ -382,6 +440,32 @@ protected:
     //!
     MOS_STATUS ExecuteActivePackets() override;
 
+    //!
+    //! \brief  Request current frame to be batched with the following frames
+    //! \details Only takes effect if "Decode Batched Frames" is above one and
+    //!         the pipeline runs on a single pipe. Every frame is recorded into
+    //!         the same command buffer with its own status report entry, which
+    //!         is submitted once the batch is full or FlushBatchedFrames is called.
+    //!         Must be invoked before ExecuteActivePackets of the frame.
+    //! \param  [in] batchable
+    //!         Whether the codec allows current frame to be batched
+    //!
+    void SetFrameBatching(bool batchable);
+
+    //!
+    //! \brief  Submit the batched frames, m_batchMutex must be held
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS SubmitBatchedFrames();
+
+    //!
+    //! \brief  Add the active packets to their tasks and submit, m_batchMutex must be held
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS SubmitActivePackets();
+
     //!
     //! \brief  Create pre sub pipelines
     //! \param  [in] subPipelineManager
@@ -506,6 +590,8 @@ protected:
     DecodeSubPipelineManager* m_preSubPipeline = nullptr; //!< PreExecution sub pipeline
     DecodeSubPipelineManager *m_postSubPipeline = nullptr;  //!< PostExecution sub pipeline
     DecodeSubPacketManager*   m_subPacketManager = nullptr; //!< Sub packet manager
+    DecodePredicationPkt*     m_predicationPkt = nullptr;   //!< Predication sub packet
+    DecodeMarkerPkt*          m_markerPkt = nullptr;        //!< Marker sub packet
 
     DecodePipeMode          m_pipeMode = decodePipeModeBegin; //!< pipe mode
 
@@ -519,6 +605,15 @@ protected:
 
     bool                    m_singleTaskPhaseSupported = true; //!< Indicates whether sumbit packets in single phase
 
+    uint32_t                m_maxBatchedFrames = 0;     //!< Frames recorded into one command buffer, 0 or 1 disables batching
+    uint32_t                m_batchedFrames    = 0;     //!< Frames recorded but not submitted yet
+    bool                    m_deferFrameSubmit = false; //!< Current frame is recorded without submission
+    MosMutex                m_batchMutex;               //!< Serializes recording with flushes from other threads
+
+    bool                    m_preAllocEnabled = true;   //!< Pre-allocate per frame resources at creation
+    bool                    m_errorRecoveryEnabled = false; //!< Conceal missing references instead of failing the frame
+    uint32_t                m_initAllocCount  = 0;      //!< Allocations done before the first frame
+
     MOS_GPU_CONTEXT         m_decodeContext = MOS_GPU_CONTEXT_INVALID_HANDLE;    //!< decode context inuse
     GPU_CONTEXT_HANDLE      m_decodeContextHandle = MOS_GPU_CONTEXT_INVALID_HANDLE;    //!< handle of decode context inuse
 
@@ -67,6 +67,8 @@ public:
     virtual MOS_GPU_CONTEXT GetDecodeContext() = 0;
     virtual GPU_CONTEXT_HANDLE GetDecodeContextHandle() = 0;
     virtual MOS_STATUS SetDecodeFormat(bool isShortFormat ){ return MOS_STATUS_UNIMPLEMENTED; };
+    //! \brief  Submit frames the pipeline has batched but not submitted yet
+    virtual MOS_STATUS FlushBatchedFrames() { return MOS_STATUS_SUCCESS; };
 
 MEDIA_CLASS_DEFINE_END(DecodePipelineAdapter)
 };
@@ -74,6 +74,9 @@ MOS_STATUS DecodeSubPipelineManager::ExecuteSubPipeline(DecodeSubPipeline &subPi
         return MOS_STATUS_SUCCESS;
     }
 
+    // Batched frames must reach the GPU before work on another context
+    DECODE_CHK_STATUS(m_decodePipeline->FlushBatchedFrames());
+
     MediaContext *mediaContext = m_decodePipeline->GetMediaContext();
     DECODE_CHK_NULL(mediaContext);
 
@@ -146,6 +146,36 @@ MOS_STATUS DecodePipeline::InitUserSetting(MediaUserSettingSharedPtr userSetting
         MediaUserSetting::Group::Sequence,
         int32_t(1),
         false);
+    DeclareUserSettingKey(
+        userSettingPtr,
+        "Decode Batched Frames",
+        MediaUserSetting::Group::Sequence,
+        uint32_t(0),
+        false);
+    DeclareUserSettingKey(
+        userSettingPtr,
+        "Decode Pre Allocate Enable",
+        MediaUserSetting::Group::Sequence,
+        int32_t(1),
+        false);
+    DeclareUserSettingKey(
+        userSettingPtr,
+        "Decode Execute Allocation Count",
+        MediaUserSetting::Group::Sequence,
+        uint32_t(0),
+        true);
+    DeclareUserSettingKey(
+        userSettingPtr,
+        "Decode Histogram Direct Output",
+        MediaUserSetting::Group::Sequence,
+        int32_t(1),
+        false);
+    DeclareUserSettingKey(
+        userSettingPtr,
+        "Decode Error Recovery Enable",
+        MediaUserSetting::Group::Sequence,
+        int32_t(0),
+        false);
     DeclareUserSettingKey(
         userSettingPtr,
         "Decode RT Compressible",
@@ -58,6 +58,11 @@ public:
 
     //!
     //! \brief  Set scalability option
+    //! \details The decision is a pure function of the stream parameters (size,
+    //!          format, tile columns, VDBOX count), so it only changes when those do.
+    //!          A change does not rebuild anything: MediaContext::SearchContext
+    //!          reuses the GPU context and scalability state already created for
+    //!          the matching option.
     //! \param  [in] params
     //!         Pointer to the input parameters to set scalability option
     //! \return MOS_STATUS
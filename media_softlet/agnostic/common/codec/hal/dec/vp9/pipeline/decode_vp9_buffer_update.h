@@ -102,6 +102,16 @@ protected:
     //!
     MOS_STATUS AllocateSegmentInitBuffer(uint32_t allocSize);
 
+    //!
+    //! \brief  Update the probability buffer of the current frame context on CPU
+    //! \details Used when CP heavy mode is off (otherwise HuC updates it). The
+    //!          buffer is CODEC_VP9_PROB_MAX_NUM_ELEM bytes and the partial path
+    //!          only locks it when a save/reset/restore/seg prob copy is pending.
+    //!          Segment id resets do not touch the CPU: they are a HuC copy from
+    //!          the zeroed m_segmentInitBuffer.
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
     MOS_STATUS ProbBufFullUpdatewithDrv();
     MOS_STATUS ProbBufferPartialUpdatewithDrv();
     MOS_STATUS ContextBufferInit(uint8_t *ctxBuffer, bool setToKey);
@@ -40,6 +40,7 @@ namespace encode
         }
 
         MOS_SafeFreeMemory(m_streamInTemp);
+        MOS_SafeFreeMemory(m_streamInBase);
     }
 
     static void SetCommonParams(uint8_t tu, CommonStreamInParams& params)
@@ -103,12 +104,17 @@ namespace encode
                                   (MOS_ALIGN_CEIL(CurFrameHeight, 64) / m_streamInBlockSize) * CODECHAL_CACHELINE_SIZE;
 
             m_streamInSize = allocParams.dwBytes;
+            MOS_SafeFreeMemory(m_streamInTemp);
             m_streamInTemp = (uint8_t *)MOS_AllocAndZeroMemory(m_streamInSize);
             ENCODE_CHK_NULL_RETURN(m_streamInTemp);
+            MOS_SafeFreeMemory(m_streamInBase);
+            m_streamInBase = (uint8_t *)MOS_AllocAndZeroMemory(m_streamInSize);
+            ENCODE_CHK_NULL_RETURN(m_streamInBase);
+            m_streamInBaseValid = false;
 
             allocParams.pBufName = "Av1 StreamIn Data Buffer";
             allocParams.ResUsageType = MOS_HW_RESOURCE_USAGE_ENCODE_INTERNAL_WRITE;
-            m_basicFeature->m_recycleBuf->RegisterResource(RecycleResId::StreamInBuffer, allocParams);
+            m_basicFeature->m_recycleBuf->RegisterAdaptiveResource(RecycleResId::StreamInBuffer, allocParams);
 
             m_widthInLCU  = MOS_ALIGN_CEIL(CurFrameWidth, 64) / 64;
             m_heightInLCU = MOS_ALIGN_CEIL(CurFrameHeight, 64) / 64;
@@ -136,9 +142,24 @@ namespace encode
         if (!m_enabled)
         {
             ENCODE_CHK_NULL_RETURN(m_streamInTemp);
-            MOS_ZeroMemory(m_streamInTemp, m_streamInSize);
+            ENCODE_CHK_NULL_RETURN(m_streamInBase);
+
+            // The initial state of every block only depends on TU and the key frame WA,
+            // build it once and restore it with a plain copy for the following frames
+            bool keyFrameWa = UseKeyFrameStreamInWa();
+            if (!m_streamInBaseValid ||
+                m_streamInBaseKeyFrameWa != keyFrameWa ||
+                m_streamInBaseTu != m_basicFeature->m_targetUsage)
+            {
+                MOS_ZeroMemory(m_streamInBase, m_streamInSize);
+                ENCODE_CHK_STATUS_RETURN(StreamInInit(m_streamInBase));
+
+                m_streamInBaseKeyFrameWa = keyFrameWa;
+                m_streamInBaseTu         = m_basicFeature->m_targetUsage;
+                m_streamInBaseValid      = true;
+            }
 
-            ENCODE_CHK_STATUS_RETURN(StreamInInit(m_streamInTemp));
+            MOS_SecureMemcpy(m_streamInTemp, m_streamInSize, m_streamInBase, m_streamInSize);
 
             m_enabled = true;
         }
@@ -264,14 +285,30 @@ namespace encode
         return MOS_STATUS_SUCCESS;
     }
 
+    bool Av1StreamIn::UseKeyFrameStreamInWa() const
+    {
+        if (m_osInterface == nullptr || m_basicFeature == nullptr || m_basicFeature->m_av1PicParams == nullptr)
+        {
+            return false;
+        }
+
+        Av1FrameType frame_type = static_cast<Av1FrameType>(m_basicFeature->m_av1PicParams->PicFlags.fields.frame_type);
+        MEDIA_WA_TABLE *pWaTable   = m_osInterface->pfnGetWaTable(m_osInterface);
+        if (pWaTable == nullptr)
+        {
+            return false;
+        }
+
+        return MEDIA_IS_WA(pWaTable, Wa_22011549751) && frame_type == keyFrame && !m_osInterface->bSimIsActive && !Mos_Solo_Extension((MOS_CONTEXT_HANDLE)m_osInterface->pOsContext);
+    }
+
     MOS_STATUS Av1StreamIn::StreamInInit(uint8_t *streamInBuffer)
     {
         ENCODE_CHK_NULL_RETURN(m_osInterface);
+        ENCODE_CHK_NULL_RETURN(m_osInterface->pfnGetWaTable(m_osInterface));
         uint16_t numLCUs = m_widthInLCU * m_heightInLCU;
         memset(streamInBuffer, 0, numLCUs * m_num32x32BlocksInLCU * sizeof(VdencStreamInState));
-        Av1FrameType frame_type = static_cast<Av1FrameType>(m_basicFeature->m_av1PicParams->PicFlags.fields.frame_type);
-        MEDIA_WA_TABLE *pWaTable   = m_osInterface->pfnGetWaTable(m_osInterface);
-        ENCODE_CHK_NULL_RETURN(pWaTable);
+        bool keyFrameWa = UseKeyFrameStreamInWa();
 
         for (uint16_t LcuAddr = 0; LcuAddr < numLCUs; LcuAddr++)
         {
@@ -279,7 +316,7 @@ namespace encode
             {
                 VdencStreamInState* pStreamIn32x32 = (VdencStreamInState *)(streamInBuffer) + LcuAddr * m_num32x32BlocksInLCU + CuAddr;
 
-                if (MEDIA_IS_WA(pWaTable, Wa_22011549751) && frame_type == keyFrame && !m_osInterface->bSimIsActive && !Mos_Solo_Extension((MOS_CONTEXT_HANDLE)m_osInterface->pOsContext))
+                if (keyFrameWa)
                 {
                     pStreamIn32x32->DW0.MaxCuSize                = 3;
                     pStreamIn32x32->DW0.MaxTuSize                = 3;
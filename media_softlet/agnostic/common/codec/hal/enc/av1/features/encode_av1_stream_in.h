@@ -300,6 +300,13 @@ protected:
     //!
     MOS_STATUS StreamInInit(uint8_t *streamInBuffer);
 
+    //!
+    //! \brief  Check whether the key frame stream in WA applies to current frame
+    //! \return bool
+    //!         true if the WA block settings are used
+    //!
+    bool UseKeyFrameStreamInWa() const;
+
     Av1BasicFeature *m_basicFeature = nullptr;        //!< AV1 paramter
     EncodeAllocator *m_allocator = nullptr;           //!< Encode allocator
     PMOS_INTERFACE   m_osInterface    = nullptr;      //!< Pointer to OS interface
@@ -319,6 +326,11 @@ protected:
     uint8_t *m_streamInTemp = nullptr;
     uint32_t m_streamInSize = 0;
 
+    uint8_t *m_streamInBase           = nullptr;  //!< Initialized stream in blocks, copied to m_streamInTemp per frame
+    bool     m_streamInBaseValid      = false;    //!< m_streamInBase matches the settings below
+    bool     m_streamInBaseKeyFrameWa = false;    //!< Key frame WA used to build m_streamInBase
+    uint8_t  m_streamInBaseTu         = 0;        //!< Target usage used to build m_streamInBase
+
 MEDIA_CLASS_DEFINE_END(encode__Av1StreamIn)
 };
 
@@ -109,24 +109,42 @@ namespace encode
         // Make this structure recycled
         ENCODE_CHK_STATUS_RETURN(SetTileGroupReportParams());
 
+        ENCODE_CHK_STATUS_RETURN(SetTileGroupIndex());
+
         return MOS_STATUS_SUCCESS;
     }
 
-    MOS_STATUS Av1EncodeTile::IsFirstTileInGroup(bool &firstTileInGroup, uint32_t &tileGroupIdx) const
+    MOS_STATUS Av1EncodeTile::SetTileGroupIndex()
     {
         ENCODE_FUNC_CALL();
 
-        auto tmpTileGroupParams = m_av1TileGroupParams;
-        for (uint16_t tileGrupCnt = 0; tileGrupCnt < m_numTileGroups; tileGrupCnt++)
+        // Tile level SETPARs query the tile group of the current tile several times per tile,
+        // look it up once per frame instead of walking all tile groups on every query.
+        m_tileGroupIdx.assign(m_numTiles, static_cast<uint16_t>(m_invalidTileGroupIdx));
+
+        for (uint32_t i = 0; i < m_numTileGroups; i++)
         {
-            if (tmpTileGroupParams->TileGroupStart <= m_tileIdx &&
-                tmpTileGroupParams->TileGroupEnd >= m_tileIdx)
+            uint32_t tileGroupEnd = MOS_MIN((uint32_t)m_av1TileGroupParams[i].TileGroupEnd + 1, m_numTiles);
+            for (uint32_t tileIdx = m_av1TileGroupParams[i].TileGroupStart; tileIdx < tileGroupEnd; tileIdx++)
             {
-                firstTileInGroup = (tmpTileGroupParams->TileGroupStart == m_tileIdx);
-                tileGroupIdx     = tileGrupCnt;
-                break;
+                if (m_tileGroupIdx[tileIdx] == m_invalidTileGroupIdx)
+                {
+                    m_tileGroupIdx[tileIdx] = static_cast<uint16_t>(i);
+                }
             }
-            tmpTileGroupParams++;
+        }
+
+        return MOS_STATUS_SUCCESS;
+    }
+
+    MOS_STATUS Av1EncodeTile::IsFirstTileInGroup(bool &firstTileInGroup, uint32_t &tileGroupIdx) const
+    {
+        ENCODE_FUNC_CALL();
+
+        if (m_tileIdx < m_tileGroupIdx.size() && m_tileGroupIdx[m_tileIdx] != m_invalidTileGroupIdx)
+        {
+            tileGroupIdx     = m_tileGroupIdx[m_tileIdx];
+            firstTileInGroup = (m_av1TileGroupParams[tileGroupIdx].TileGroupStart == m_tileIdx);
         }
 
         return MOS_STATUS_SUCCESS;
@@ -792,7 +810,7 @@ namespace encode
 
         av1TileInfo->tileId = static_cast<uint16_t>(m_tileIdx);  // Tile number in a frame
 
-        const auto currTileData = m_tileData[m_tileIdx];
+        const auto &currTileData = m_tileData[m_tileIdx];
 
         av1TileInfo->tileColPositionInSb = static_cast<uint16_t>(currTileData.tileStartXInSb);
         av1TileInfo->tileRowPositionInSb = static_cast<uint16_t>(currTileData.tileStartYInSb);
@@ -810,19 +828,15 @@ namespace encode
         av1TileInfo->tileEndXInLCU   = currTileData.tileEndXInLCU;
         av1TileInfo->tileEndYInLCU   = currTileData.tileEndYInLCU;
 
-        auto tmpTileGroupParams = m_av1TileGroupParams;
-        for (uint16_t tileGrupCnt = 0; tileGrupCnt < m_numTileGroups; tileGrupCnt++)
+        if (m_tileIdx < m_tileGroupIdx.size() && m_tileGroupIdx[m_tileIdx] != m_invalidTileGroupIdx)
         {
-            if (tmpTileGroupParams->TileGroupStart <= m_tileIdx &&
-                tmpTileGroupParams->TileGroupEnd >= m_tileIdx)
-            {
-                av1TileInfo->firstTileOfTileGroup = (tmpTileGroupParams->TileGroupStart == m_tileIdx);
-                av1TileInfo->lastTileOfTileGroup  = (tmpTileGroupParams->TileGroupEnd == m_tileIdx);
-                av1TileInfo->tileNum              = m_tileIdx - tmpTileGroupParams->TileGroupStart;
-                av1TileInfo->tileGroupId          = tileGrupCnt;
-                break;
-            }
-            tmpTileGroupParams++;
+            uint16_t tileGroupIdx   = m_tileGroupIdx[m_tileIdx];
+            auto tmpTileGroupParams = &m_av1TileGroupParams[tileGroupIdx];
+
+            av1TileInfo->firstTileOfTileGroup = (tmpTileGroupParams->TileGroupStart == m_tileIdx);
+            av1TileInfo->lastTileOfTileGroup  = (tmpTileGroupParams->TileGroupEnd == m_tileIdx);
+            av1TileInfo->tileNum              = m_tileIdx - tmpTileGroupParams->TileGroupStart;
+            av1TileInfo->tileGroupId          = tileGroupIdx;
         }
 
         return MOS_STATUS_SUCCESS;
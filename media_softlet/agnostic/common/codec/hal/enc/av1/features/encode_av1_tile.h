@@ -694,11 +694,20 @@ protected:
 
     MOS_STATUS SetTileGroupReportParams();
 
+    //!
+    //! \brief  Map each tile of current frame to the tile group containing it
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS SetTileGroupIndex();
+
     PCODEC_AV1_ENCODE_TILE_GROUP_PARAMS m_av1TileGroupParams = nullptr;   //!< Pointer to slice parameter
 
     Av1ReportTileGroupParams *m_reportTileGroupParams[EncodeBasicFeature::m_uncompressedSurfaceNum] = {};
 
     uint32_t              m_numTileGroups    = 0;        //!< Total number of tile groups in current frame
+    std::vector<uint16_t> m_tileGroupIdx     = {};       //!< Tile group index of each tile in current frame
+    static const uint16_t m_invalidTileGroupIdx = 0xFFFF; //!< Tile is not covered by any tile group
     uint32_t              m_numSbInPic       = 0;        //!< Total number of Sb in pic cal by each tile
 
     Av1TileStatusInfo m_av1TileStatsOffset  = {};   //!< Page aligned offsets used to program AVP / VDEnc pipe and HuC PAK Integration kernel input
@@ -336,6 +336,7 @@ namespace encode{
             if (tileRecord[i].Length == 0)
             {
                 statusReportData->codecStatus = CODECHAL_STATUS_INCOMPLETE;
+                m_allocator->UnLock(tileRecordBuffer);
                 return MOS_STATUS_SUCCESS;
             }
 
@@ -362,7 +363,8 @@ namespace encode{
         if (frameWidthInSb != 0 && frameHeightInSb != 0)
         {
             ENCODE_CHK_NULL_RETURN(m_basicFeature->m_av1SeqParams);
-            statusReportData->qpY = (uint8_t)(((uint32_t)encodeStatusMfx->qpStatusCount.avpCumulativeQP) / (frameWidthInSb * frameHeightInSb));
+            statusReportData->qpY = statusReportData->averageQP =
+                (uint8_t)(((uint32_t)encodeStatusMfx->qpStatusCount.avpCumulativeQP) / (frameWidthInSb * frameHeightInSb));
         }
 
         CODECHAL_DEBUG_TOOL(
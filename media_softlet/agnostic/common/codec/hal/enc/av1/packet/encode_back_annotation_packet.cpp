@@ -48,6 +48,15 @@ namespace encode {
     {
         ENCODE_CHK_STATUS_RETURN(EncodeHucPkt::AllocateResources());
 
+        // Back annotation is patched on CPU in Completed(), the HuC pass and its buffers are never used
+        ENCODE_CHK_NULL_RETURN(m_featureManager);
+        auto basicFeature = dynamic_cast<Av1BasicFeature *>(m_featureManager->GetFeature(Av1FeatureIDs::basicFeature));
+        ENCODE_CHK_NULL_RETURN(basicFeature);
+        if (basicFeature->m_enableSWBackAnnotation)
+        {
+            return MOS_STATUS_SUCCESS;
+        }
+
         MOS_ALLOC_GFXRES_PARAMS allocParamsForBufferLinear;
         MOS_ZeroMemory(&allocParamsForBufferLinear, sizeof(MOS_ALLOC_GFXRES_PARAMS));
         allocParamsForBufferLinear.Type = MOS_GFXRES_BUFFER;
@@ -241,7 +250,11 @@ namespace encode {
         ENCODE_CHK_NULL_RETURN(currRefList);
         uint8_t *bitstream = (uint8_t *)m_allocator->LockResourceForWrite(
             &currRefList->resBitstreamBuffer);
-        ENCODE_CHK_NULL_RETURN(bitstream);
+        if (bitstream == nullptr)
+        {
+            m_allocator->UnLock(tileSizeStatusBuffer);
+            ENCODE_CHK_NULL_RETURN(bitstream);
+        }
 
         uint32_t payLoadSize = 0;
         uint8_t buffer[m_numBytesOfOBUSize] = {};
@@ -253,6 +266,8 @@ namespace encode {
                 if (tileRecord[j].Length == 0)
                 {
                     statusReportData->codecStatus = CODECHAL_STATUS_INCOMPLETE;
+                    m_allocator->UnLock(&currRefList->resBitstreamBuffer);
+                    m_allocator->UnLock(tileSizeStatusBuffer);
                     return MOS_STATUS_SUCCESS;
                 }
                 if (j == tileGroupParams->TileGroupStart)
@@ -156,7 +156,9 @@ MOS_STATUS Av1VdencPipeline::SwitchContext(uint8_t outputChromaFormat, uint16_t
     m_scalPars->enableVDEnc = true;
     m_scalPars->enableVE = MOS_VE_SUPPORTED(m_osInterface);
 
-    //force to disable scalability for AV1 VDENC
+    // Force to disable scalability for AV1 VDENC. Unlike HEVC there is no per pipe tile
+    // column assignment, cross pipe sync or PAK integration for AV1 tile records yet,
+    // so all tiles are coded on one VDBOX.
     m_scalPars->numVdbox = 1;
     m_scalPars->forceMultiPipe = false;
 
@@ -92,7 +92,7 @@ MOS_STATUS AvcVdencStreamInFeature::Update(void* setting)
         allocParams.dwBytes = m_widthInMb * m_heightInMb * AvcVdencStreamInState::byteSize;
         allocParams.pBufName = "AVC VDEnc StreamIn Data Buffer";
 
-        ENCODE_CHK_STATUS_RETURN(m_basicFeature->m_recycleBuf->RegisterResource(RecycleResId::StreamInBuffer, allocParams));
+        ENCODE_CHK_STATUS_RETURN(m_basicFeature->m_recycleBuf->RegisterAdaptiveResource(RecycleResId::StreamInBuffer, allocParams));
     }
 
     m_streamInBuffer = m_basicFeature->m_recycleBuf->GetBuffer(RecycleResId::StreamInBuffer, m_basicFeature->m_frameNum);
@@ -208,6 +208,11 @@ MOS_STATUS AvcVdencPipeline::ActivateVdencVideoPackets()
     ENCODE_CHK_NULL_RETURN(brcFeature);
     bool immediateSubmit = !m_singleTaskPhaseSupported;
 
+    // Pre-encode stays on the video context in front of the full encode: its
+    // output is read by the full encode of the same frame (AvcVdencFullEnc), and
+    // frames only arrive one at a time, so there is no later frame for a
+    // separate context to run ahead on. With single task phase both share one
+    // submission and no extra CPU/GPU sync is added.
     if (m_preEncEnabled)
     {
         ENCODE_CHK_STATUS_RETURN(ActivatePacket(encodePreEncPacket, immediateSubmit, 0, 0));
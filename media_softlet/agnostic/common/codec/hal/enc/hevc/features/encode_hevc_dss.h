@@ -39,6 +39,15 @@
 
 namespace encode
 {
+    //!
+    //! \brief  HEVC VDENC dynamic slice size (DSS) feature
+    //! \details VDENC/PAK close slices on the fly against the requested slice size
+    //!          (pakDynamicSliceModeEnable), so the first pass normally meets the
+    //!          target. DSS reserves a second pass, but it is guarded by
+    //!          MI_CONDITIONAL_BATCH_BUFFER_END on the HuC BRC semaphore and only
+    //!          runs when HuC flags a violation. The executed pass count is reported
+    //!          per frame through numberPasses in the encode status report.
+    //!
     class HevcEncodeDss : public MediaFeature
     {
     public:
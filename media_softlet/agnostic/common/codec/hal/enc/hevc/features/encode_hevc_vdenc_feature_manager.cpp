@@ -289,7 +289,8 @@ MOS_STATUS EncodeHevcVdencFeatureManager::ValidatePassNum(
     }
 #endif
 
-    // dynamic slice size control and brc to be added later here
+    // The second pass is conditional (see HevcVdencPkt::AddCondBBEndForLastPass),
+    // so DSS/BRC only pay for a re-encode when HuC requests one
     if (((hevcPicParams->weighted_pred_flag ||
         hevcPicParams->weighted_bipred_flag) &&
         hevcPicParams->bEnableGPUWeightedPrediction == true) ||
@@ -121,7 +121,8 @@ namespace encode
         MOS_RESOURCE                m_vdencRecNotFilteredBuffer = {};
 
         bool                        m_enableLBCOnly = false;               //!< Enable LBC only for IBC
-        bool                        m_enableSCC = false;                   //!< Flag to indicate if HEVC SCC is enabled.
+        bool                        m_supportSCC = false;                  //!< SCC requested at codec creation, SCC resources allocated
+        bool                        m_enableSCC = false;                   //!< Flag to indicate if HEVC SCC is enabled for current frame.
         unsigned char               m_slotForRecNotFiltered = 0;           //!< Slot for not filtered reconstructed surface
 
         EncodeBasicFeature          *m_basicFeature = nullptr;             //!< EncodeBasicFeature
@@ -54,10 +54,8 @@ namespace encode
         m_hevcSliceParams = static_cast<PCODEC_HEVC_ENCODE_SLICE_PARAMS>(encodeParams->pSliceParams);
         ENCODE_CHK_NULL_RETURN(m_hevcSliceParams);
 
-        if (hevcPicParams->weighted_pred_flag || hevcPicParams->weighted_bipred_flag)
-        {
-            m_enabled = true;
-        }
+        // Follow the PPS of every frame, HCP_PIC_STATE derives the WP denominators the same way
+        m_enabled = hevcPicParams->weighted_pred_flag || hevcPicParams->weighted_bipred_flag;
 
         m_bEnableGPUWeightedPrediction = m_enabled && hevcPicParams->bEnableGPUWeightedPrediction;
 
@@ -51,16 +51,10 @@ HevcVdencRoi::HevcVdencRoi(
 }
 MOS_STATUS HevcVdencRoi::ClearStreaminBuffer(uint32_t lucNumber)
 {
-    // Clear streamin
+    // Clear streamin, the whole staging copy is written to m_streamIn by WriteStreaminData
     ENCODE_CHK_NULL_RETURN(m_streamInTemp);
 
-    uint8_t *data = (uint8_t *)m_allocator->LockResourceForWrite(m_streamIn);
-    ENCODE_CHK_NULL_RETURN(data);
-
-    MOS_ZeroMemory(m_streamInTemp, lucNumber * 64);
-    MOS_SecureMemcpy(data, m_streamInSize, m_streamInTemp, m_streamInSize);
-
-    ENCODE_CHK_STATUS_RETURN(m_allocator->UnLock(m_streamIn));
+    MOS_ZeroMemory(m_streamInTemp, m_streamInSize);
 
     return MOS_STATUS_SUCCESS;
 }
@@ -100,6 +94,31 @@ MOS_STATUS HevcVdencRoi::Init(void *setting)
     return MOS_STATUS_SUCCESS;
 }
 
+bool HevcVdencRoi::IsFrameFullyDirty(PicParams *hevcPicParams) const
+{
+    if (hevcPicParams == nullptr || hevcPicParams->pDirtyRect == nullptr)
+    {
+        return false;
+    }
+
+    // Dirty rectangles are in 32x32 stream-in block units, inclusive
+    uint32_t widthInBlocks  = MOS_ALIGN_CEIL(m_basicFeature->m_frameWidth, 32) / 32;
+    uint32_t heightInBlocks = MOS_ALIGN_CEIL(m_basicFeature->m_frameHeight, 32) / 32;
+
+    for (uint8_t i = 0; i < hevcPicParams->NumDirtyRects; i++)
+    {
+        const CODEC_ROI &rect = hevcPicParams->pDirtyRect[i];
+        if (rect.Left == 0 && rect.Top == 0 &&
+            (uint32_t)rect.Right + 1 >= widthInBlocks &&
+            (uint32_t)rect.Bottom + 1 >= heightInBlocks)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 MOS_STATUS HevcVdencRoi::Update(void *params)
 {
     ENCODE_FUNC_CALL();
@@ -121,7 +140,7 @@ MOS_STATUS HevcVdencRoi::Update(void *params)
 
     bool pririotyDirtyROI = true;
 
-    m_dirtyRoiEnabled = hevcPicParams->NumDirtyRects && (B_TYPE == hevcPicParams->CodingType);
+    m_dirtyRoiEnabled = hevcPicParams->NumDirtyRects && (B_TYPE == hevcPicParams->CodingType) && !IsFrameFullyDirty(hevcPicParams);
     m_mbQpDataEnabled = m_basicFeature->m_mbQpDataEnabled;
     // Adaptive region boost is enabled for TCBRC only
     m_isArbRoi        = hevcPicParams->TargetFrameSize != 0 && (hevcSeqParams->LookaheadDepth == 0) && m_isArbRoiSupported;
@@ -159,7 +178,10 @@ MOS_STATUS HevcVdencRoi::Update(void *params)
 
     if (!m_isArbRoi || (hevcPicParams->CodingType == I_TYPE && !IFrameIsSet) || ((hevcPicParams->CodingType == P_TYPE || hevcPicParams->CodingType == B_TYPE) && !PBFrameIsSet))
     {
-        m_streamInTemp = (uint8_t *)MOS_AllocMemory(m_streamInSize);
+        if (m_streamInTemp == nullptr)
+        {
+            m_streamInTemp = (uint8_t *)MOS_AllocMemory(m_streamInSize);
+        }
         ENCODE_CHK_NULL_RETURN(m_streamInTemp);
 
         uint32_t lcuNumber = GetLCUNumber();
@@ -186,8 +208,6 @@ MOS_STATUS HevcVdencRoi::Update(void *params)
 
         ENCODE_CHK_STATUS_RETURN(WriteStreaminData());
 
-        MOS_SafeFreeMemory(m_streamInTemp);
-
 #if (_DEBUG || _RELEASE_INTERNAL)
         ENCODE_CHK_NULL_RETURN(m_hwInterface);
         ENCODE_CHK_NULL_RETURN(m_hwInterface->GetOsInterface());
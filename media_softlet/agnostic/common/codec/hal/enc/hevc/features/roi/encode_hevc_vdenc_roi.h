@@ -60,7 +60,7 @@ public:
         CodechalHwInterfaceNext *hwInterface,
         void *constSettings);
 
-    virtual ~HevcVdencRoi() {}
+    virtual ~HevcVdencRoi() { MOS_SafeFreeMemory(m_streamInTemp); }
 
     //!
     //! \brief  Init encode parameter
@@ -181,6 +181,17 @@ protected:
         SlcParams *hevcSlcParams);
 
 
+    //!
+    //! \brief    Check whether one dirty rectangle covers the whole frame
+    //! \details  In that case every LCU is encoded normally and the dirty ROI
+    //!           stream-in would carry no information
+    //!
+    //! \param    [in] hevcPicParams
+    //!           pointer of picture parameters
+    //! \return   bool
+    //!           true if the whole frame is dirty, otherwise false
+    //!
+    bool IsFrameFullyDirty(PicParams *hevcPicParams) const;
 
     //!
     //! \brief    Write the Streamin data according to the overlap settings.
@@ -110,6 +110,15 @@ MOS_STATUS RoiOverlap::WriteStreaminData(
     ENCODE_CHK_NULL_RETURN(streaminBuffer);
     ENCODE_CHK_NULL_RETURN(m_overlapMap);
 
+    if (roi)
+    {
+        ENCODE_CHK_STATUS_RETURN(roi->BeginWriteStreaminData());
+    }
+    if (dirtyRoi && dirtyRoi != roi)
+    {
+        ENCODE_CHK_STATUS_RETURN(dirtyRoi->BeginWriteStreaminData());
+    }
+
     for (uint32_t i = 0; i < m_lcuNumber; i++)
     {
         OverlapMarker marker = GetMarker(m_overlapMap[i]);
@@ -130,6 +139,15 @@ MOS_STATUS RoiOverlap::WriteStreaminData(
                 i, marker, roiRegionIndex, streaminBuffer);
         }
     }
+
+    if (roi)
+    {
+        ENCODE_CHK_STATUS_RETURN(roi->EndWriteStreaminData());
+    }
+    if (dirtyRoi && dirtyRoi != roi)
+    {
+        ENCODE_CHK_STATUS_RETURN(dirtyRoi->EndWriteStreaminData());
+    }
     return MOS_STATUS_SUCCESS;
 }
 
@@ -90,7 +90,8 @@ namespace encode
 
         StreamInParams streaminDataParams;
         MOS_ZeroMemory(&streaminDataParams, sizeof(streaminDataParams));
-        uint8_t *QpData = (uint8_t *)m_allocator->LockResourceForRead(&(m_basicFeature->m_mbQpDataSurface.OsResource));
+        // Locked once per frame in BeginWriteStreaminData
+        uint8_t *QpData = m_qpData;
         ENCODE_CHK_NULL_RETURN(QpData);
 
         uint32_t w_in16 = m_basicFeature->m_mbQpDataSurface.dwWidth;
@@ -100,7 +101,6 @@ namespace encode
         SetRoiCtrlMode(lcuIndex, streaminDataParams, w_in16, h_in16, Pitch, QpData);
         SetQpRoiCtrlPerLcu(&streaminDataParams, (HevcVdencStreamInState *)(rawStreamIn + (lcuIndex * 64)));
 
-        m_allocator->UnLock(&(m_basicFeature->m_mbQpDataSurface.OsResource));
         HevcVdencStreamInState *data = (HevcVdencStreamInState *)(rawStreamIn + (lcuIndex * 64));
 
         if (lcuIndex % 4 == 3)
@@ -121,4 +121,26 @@ namespace encode
         return MOS_STATUS_SUCCESS;
     }
 
+    MOS_STATUS QPMapROI::BeginWriteStreaminData()
+    {
+        ENCODE_CHK_NULL_RETURN(m_allocator);
+        ENCODE_CHK_NULL_RETURN(m_basicFeature);
+
+        m_qpData = (uint8_t *)m_allocator->LockResourceForRead(&(m_basicFeature->m_mbQpDataSurface.OsResource));
+        ENCODE_CHK_NULL_RETURN(m_qpData);
+
+        return MOS_STATUS_SUCCESS;
+    }
+
+    MOS_STATUS QPMapROI::EndWriteStreaminData()
+    {
+        if (m_qpData == nullptr)
+        {
+            return MOS_STATUS_SUCCESS;
+        }
+
+        m_qpData = nullptr;
+        return m_allocator->UnLock(&(m_basicFeature->m_mbQpDataSurface.OsResource));
+    }
+
 }  // namespace encode
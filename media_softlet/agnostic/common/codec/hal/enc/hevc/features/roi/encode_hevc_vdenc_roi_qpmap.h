@@ -104,7 +104,22 @@ namespace encode
             uint32_t                  roiRegionIndex,
             uint8_t *                 rawStreamIn) override;
 
+        //!
+        //! \brief    Lock the QP map surface once for the whole frame
+        //! \return   MOS_STATUS
+        //!           MOS_STATUS_SUCCESS if success, else fail reason
+        //!
+        virtual MOS_STATUS BeginWriteStreaminData() override;
+
+        //!
+        //! \brief    Unlock the QP map surface
+        //! \return   MOS_STATUS
+        //!           MOS_STATUS_SUCCESS if success, else fail reason
+        //!
+        virtual MOS_STATUS EndWriteStreaminData() override;
+
     private:
+        uint8_t *m_qpData = nullptr;  //!< QP map surface data, locked between Begin/EndWriteStreaminData
 
 
     MEDIA_CLASS_DEFINE_END(encode__QPMapROI)
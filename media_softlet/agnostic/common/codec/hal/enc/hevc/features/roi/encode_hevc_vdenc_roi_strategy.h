@@ -275,6 +275,21 @@ public:
         uint32_t roiRegionIndex,
         uint8_t *streamInBuffer);
 
+    //!
+    //! \brief    Prepare for the per LCU WriteStreaminData calls of one frame,
+    //!           e.g. map input surfaces once instead of once per LCU.
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    virtual MOS_STATUS BeginWriteStreaminData() { return MOS_STATUS_SUCCESS; }
+
+    //!
+    //! \brief    Release what BeginWriteStreaminData acquired.
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    virtual MOS_STATUS EndWriteStreaminData() { return MOS_STATUS_SUCCESS; }
+
     //!
     //! \brief    Set VDENC_PIPE_BUF_ADDR parameters
     //!
@@ -563,6 +563,15 @@ namespace encode
 
         MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
 
+        // Picture state only depends on frame and pass, so the batch built for the
+        // first pipe or tile row can be reused by the others.
+        if (m_3rdLevelBatchValid &&
+            m_3rdLevelBatchFrameNum == m_basicFeature->m_frameNum &&
+            m_3rdLevelBatchPass == m_pipeline->GetCurrentPass())
+        {
+            return eStatus;
+        }
+
         // Begin patching 3rd level batch cmds
         MOS_COMMAND_BUFFER constructedCmdBuf;
         RUN_FEATURE_INTERFACE_RETURN(HevcEncodeTile, HevcFeatureIDs::encodeTile, BeginPatch3rdLevelBatch, constructedCmdBuf);
@@ -579,6 +588,10 @@ namespace encode
         // End patching 3rd level batch cmds
         RUN_FEATURE_INTERFACE_RETURN(HevcEncodeTile, HevcFeatureIDs::encodeTile, EndPatch3rdLevelBatch);
 
+        m_3rdLevelBatchFrameNum = m_basicFeature->m_frameNum;
+        m_3rdLevelBatchPass     = m_pipeline->GetCurrentPass();
+        m_3rdLevelBatchValid    = true;
+
         return eStatus;
     }
 
@@ -606,6 +606,10 @@ namespace encode
 
         bool m_useBatchBufferForPakSlices = false;
 
+        uint32_t m_3rdLevelBatchFrameNum = 0;      //!< Frame number the 3rd level batch was constructed for
+        uint16_t m_3rdLevelBatchPass     = 0;      //!< Pass the 3rd level batch was constructed for
+        bool     m_3rdLevelBatchValid    = false;  //!< Whether the 3rd level batch holds picture state
+
         int32_t  m_batchBufferForPakSlicesStartOffset    = 0;
         uint32_t m_sizeOfSseSrcPixelRowStoreBufferPerLcu = 0;  //!< Size of SSE row store buffer per LCU
 
@@ -519,16 +519,60 @@ namespace encode
         auto hucVdencBrcUpdateDmem =
             (VdencHevcHucBrcUpdateDmem *)m_allocator->LockResourceForWrite(const_cast<MOS_RESOURCE*>(&m_vdencBrcUpdateDmemBuffer[m_pipeline->m_currRecycledBufIdx][m_pipeline->GetCurrentPass()]));
         ENCODE_CHK_NULL_RETURN(hucVdencBrcUpdateDmem);
-        MOS_ZeroMemory(hucVdencBrcUpdateDmem, sizeof(VdencHevcHucBrcUpdateDmem));
 
-        const_cast<HucBrcUpdatePkt* const>(this)->SetCommonDmemBuffer(hucVdencBrcUpdateDmem);
-        SetExtDmemBuffer(hucVdencBrcUpdateDmem);
+        if (!m_pipeline->IsFirstPass() && m_dmemTemplateValid && m_dmemTemplateFrameNum == m_basicFeature->m_frameNum)
+        {
+            // Frame level inputs do not change between passes, so reuse the DMEM built
+            // by the first pass and only refresh the pass dependent fields.
+            MOS_SecureMemcpy(hucVdencBrcUpdateDmem, sizeof(VdencHevcHucBrcUpdateDmem), &m_dmemTemplate, sizeof(VdencHevcHucBrcUpdateDmem));
+            ENCODE_CHK_STATUS_RETURN(PatchPassDmemBuffer(hucVdencBrcUpdateDmem));
+        }
+        else
+        {
+            MOS_ZeroMemory(hucVdencBrcUpdateDmem, sizeof(VdencHevcHucBrcUpdateDmem));
+
+            const_cast<HucBrcUpdatePkt* const>(this)->SetCommonDmemBuffer(hucVdencBrcUpdateDmem);
+            SetExtDmemBuffer(hucVdencBrcUpdateDmem);
+
+            MOS_SecureMemcpy(&m_dmemTemplate, sizeof(VdencHevcHucBrcUpdateDmem), hucVdencBrcUpdateDmem, sizeof(VdencHevcHucBrcUpdateDmem));
+            m_dmemTemplateFrameNum = m_basicFeature->m_frameNum;
+            m_dmemTemplateValid    = true;
+        }
 
         m_allocator->UnLock(const_cast<MOS_RESOURCE*>(&m_vdencBrcUpdateDmemBuffer[m_pipeline->m_currRecycledBufIdx][m_pipeline->GetCurrentPass()]));
 
         return MOS_STATUS_SUCCESS;
     }
 
+    MOS_STATUS HucBrcUpdatePkt::PatchPassDmemBuffer(VdencHevcHucBrcUpdateDmem *hucVdencBrcUpdateDmem) const
+    {
+        ENCODE_FUNC_CALL();
+        ENCODE_CHK_NULL_RETURN(hucVdencBrcUpdateDmem);
+
+        hucVdencBrcUpdateDmem->CurrentPass_U8 = (uint8_t)m_pipeline->GetCurrentPass();
+
+        bool enableTileReplay = false;
+        RUN_FEATURE_INTERFACE_RETURN(HevcEncodeTile, HevcFeatureIDs::encodeTile, IsTileReplayEnabled, enableTileReplay);
+        if (!enableTileReplay)
+        {
+            RUN_FEATURE_INTERFACE_RETURN(
+                HevcVdencWeightedPred,
+                HevcFeatureIDs::hevcVdencWpFeature,
+                SetHucBrcUpdateDmemBuffer,
+                m_pipeline->IsFirstPass(),
+                *hucVdencBrcUpdateDmem);
+        }
+
+        RUN_FEATURE_INTERFACE_RETURN(
+            HEVCVdencLplaEnc,
+            HevcFeatureIDs::hevcVdencLplaEncFeature,
+            SetHucBrcUpdateExtBuffer,
+            hucVdencBrcUpdateDmem,
+            m_pipeline->IsLastPass());
+
+        return MOS_STATUS_SUCCESS;
+    }
+
     MOS_STATUS HucBrcUpdatePkt::SetConstLambdaHucBrcUpdate(void *params) const 
     {
         ENCODE_FUNC_CALL();
@@ -232,6 +232,15 @@ namespace encode
         virtual MOS_STATUS SetCommonDmemBuffer(VdencHevcHucBrcUpdateDmem *hucVdencBrcUpdateDmem);
         virtual MOS_STATUS SetDmemBuffer() const;
 
+        //!
+        //! \brief  Refresh the pass dependent fields of a DMEM copied from the first pass
+        //! \param  [in,out] hucVdencBrcUpdateDmem
+        //!         Pointer to BRC update DMEM
+        //! \return MOS_STATUS
+        //!         MOS_STATUS_SUCCESS if success, else fail reason
+        //!
+        virtual MOS_STATUS PatchPassDmemBuffer(VdencHevcHucBrcUpdateDmem *hucVdencBrcUpdateDmem) const;
+
         virtual MOS_STATUS SetConstLambdaHucBrcUpdate(void *params) const;
         virtual MOS_STATUS SetConstDataHuCBrcUpdate() const;
 
@@ -275,6 +284,9 @@ namespace encode
         uint32_t                                m_vdencBrcConstDataBufferSize = sizeof(VdencHevcHucBrcConstantData);                 //!< Offset of BRC const data buffer
         uint32_t                                m_slbDataSizeInBytes = 0;                          //!< Size of SLB Data
         uint8_t                                 m_tcbrcQualityBoost = 0;
+        mutable VdencHevcHucBrcUpdateDmem       m_dmemTemplate = {};                               //!< BRC update DMEM built by the first pass of current frame
+        mutable uint32_t                        m_dmemTemplateFrameNum = 0;                        //!< Frame number m_dmemTemplate was built for
+        mutable bool                            m_dmemTemplateValid = false;                       //!< Whether m_dmemTemplate holds a DMEM
 
         MOS_RESOURCE m_vdencBrcInitDmemBuffer[CODECHAL_ENCODE_RECYCLED_BUFFER_NUM] = {}; //!< VDEnc BrcInit DMEM buffer
 
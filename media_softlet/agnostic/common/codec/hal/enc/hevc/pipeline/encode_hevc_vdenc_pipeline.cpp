@@ -234,6 +234,14 @@ MOS_STATUS HevcVdencPipeline::SwitchContext(uint8_t outputChromaFormat, uint16_t
     m_scalPars->enableVE    = MOS_VE_SUPPORTED(m_osInterface);
     m_scalPars->numVdbox    = m_numVdbox;
 
+    // Lookahead analysis only produces statistics, keep it on one VDBOX so that
+    // the encode pass of the stream can run on the other VDBOXes concurrently
+    auto laAnalysisFeature = dynamic_cast<VdencLplaAnalysis *>(m_featureManager->GetFeature(HevcFeatureIDs::vdencLplaAnalysisFeature));
+    if (laAnalysisFeature && laAnalysisFeature->IsLaAnalysisRequired())
+    {
+        m_scalPars->numVdbox = 1;
+    }
+
     m_scalPars->forceMultiPipe     = true;
     m_scalPars->outputChromaFormat = outputChromaFormat;
 
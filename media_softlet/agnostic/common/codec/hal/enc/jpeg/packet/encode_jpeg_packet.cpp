@@ -760,20 +760,15 @@ namespace encode {
             appDataChunkSize = 1020;
         }
 
-        uint8_t *appDataChunk = (uint8_t *)MOS_AllocAndZeroMemory(appDataChunkSize);
-        ENCODE_CHK_NULL_RETURN(appDataChunk)
+        ENCODE_CHK_NULL_RETURN(m_applicationData);
 
+        // Chunks are inserted straight from the application buffer, the command
+        // buffer copy is the only copy needed
         for (uint32_t i = 0; i < numAppDataCmdsNeeded; i++)
         {
-            uint8_t *copyAddress = (uint8_t *)(m_applicationData) + (i * appDataChunkSize);
+            uint8_t *chunkAddress = (uint8_t *)(m_applicationData) + (i * appDataChunkSize);
 
-            MOS_SecureMemcpy(appDataChunk, appDataChunkSize, copyAddress, appDataChunkSize);
-            eStatus = m_jpgPkrFeature->PackApplicationData(&bsBuffer, appDataChunk, appDataChunkSize);
-            if (eStatus != MOS_STATUS_SUCCESS)
-            {
-                MOS_SafeFreeMemory(appDataChunk);
-                ENCODE_CHK_STATUS_RETURN(eStatus);
-            }
+            ENCODE_CHK_STATUS_RETURN(m_jpgPkrFeature->PackApplicationData(&bsBuffer, chunkAddress, appDataChunkSize));
 
             uint32_t byteSize = (bsBuffer.BufferSize + 7) >> 3;
             uint32_t dataBitsInLastDw = bsBuffer.BufferSize % 32;
@@ -802,12 +797,7 @@ namespace encode {
 
             // Add actual data
             uint8_t* data = (uint8_t*)(bsBuffer.pBase);
-            eStatus = Mhw_AddCommandCmdOrBB(m_osInterface, cmdBuffer, nullptr, data, byteSize);
-            if (eStatus != MOS_STATUS_SUCCESS)
-            {
-                MOS_SafeFreeMemory(appDataChunk);
-                ENCODE_CHK_STATUS_RETURN(eStatus);
-            }
+            ENCODE_CHK_STATUS_RETURN(Mhw_AddCommandCmdOrBB(m_osInterface, cmdBuffer, nullptr, data, byteSize));
         }
 
         if (appDataCmdSizeResidue != 0)
@@ -815,14 +805,7 @@ namespace encode {
             uint8_t *lastAddress = (uint8_t *)(m_applicationData) + (numAppDataCmdsNeeded * appDataChunkSize);
             appDataChunkSize     = appDataCmdSizeResidue;
 
-            MOS_SecureMemcpy(appDataChunk, appDataChunkSize, lastAddress, appDataChunkSize);
-
-            eStatus = m_jpgPkrFeature->PackApplicationData(&bsBuffer, appDataChunk, appDataChunkSize);
-            if (eStatus != MOS_STATUS_SUCCESS)
-            {
-                MOS_SafeFreeMemory(appDataChunk);
-                ENCODE_CHK_STATUS_RETURN(eStatus);
-            }
+            ENCODE_CHK_STATUS_RETURN(m_jpgPkrFeature->PackApplicationData(&bsBuffer, lastAddress, appDataChunkSize));
 
             uint32_t byteSize = (bsBuffer.BufferSize + 7) >> 3;
             uint32_t dataBitsInLastDw = bsBuffer.BufferSize % 32;
@@ -851,16 +834,9 @@ namespace encode {
 
             // Add actual data
             uint8_t* data = (uint8_t*)(bsBuffer.pBase);
-            eStatus = Mhw_AddCommandCmdOrBB(m_osInterface, cmdBuffer, nullptr, data, byteSize);
-            if (eStatus != MOS_STATUS_SUCCESS)
-            {
-                MOS_SafeFreeMemory(appDataChunk);
-                ENCODE_CHK_STATUS_RETURN(eStatus);
-            }
+            ENCODE_CHK_STATUS_RETURN(Mhw_AddCommandCmdOrBB(m_osInterface, cmdBuffer, nullptr, data, byteSize));
         }
 
-        MOS_FreeMemory(appDataChunk);
-
         return eStatus;
     }
 
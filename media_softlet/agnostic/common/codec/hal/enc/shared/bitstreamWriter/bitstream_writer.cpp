@@ -67,9 +67,33 @@ void BitstreamWriter::Reset(mfxU8 *bs, mfxU32 size, mfxU8 bitOffset)
 void BitstreamWriter::PutBitsBuffer(mfxU32 n, void *bb, mfxU32 o)
 {}
 
+const mfxU8 BitstreamWriter::m_bitLengthTbl[256] =
+{
+    0, 1, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8
+};
+
 void BitstreamWriter::PutBits(mfxU32 n, mfxU32 b)
 {
     assert(n <= sizeof(b) * 8);
+    if (!n)
+    {
+        return;
+    }
     while (n > 24)
     {
         n -= 16;
@@ -128,16 +152,33 @@ void BitstreamWriter::PutGolomb(mfxU32 b)
     if (!b)
     {
         PutBit(1);
+        return;
     }
-    else
-    {
-        mfxU32 n = 1;
 
-        b++;
+    b++;
 
-        while (b >> n)
-            n++;
+    // Bit length of b, leading zeros of the code word are one less
+    mfxU32 n = 0;
+    mfxU32 v = b;
+    if (v >> 16)
+    {
+        n += 16;
+        v >>= 16;
+    }
+    if (v >> 8)
+    {
+        n += 8;
+        v >>= 8;
+    }
+    n += m_bitLengthTbl[v];
 
+    if (2 * n - 1 <= 32)
+    {
+        // Short code words (b < 65536) go out in one write, the zero prefix is implied
+        PutBits(2 * n - 1, b);
+    }
+    else
+    {
         PutBits(n - 1, 0);
         PutBits(n, b);
     }
@@ -134,7 +134,11 @@ public:
 MEDIA_CLASS_DEFINE_END(IBsWriter)
 };
 
-class BitstreamWriter
+//!
+//! \brief  Bit writer for slice headers, declared final so calls through
+//!         BitstreamWriter references are resolved without virtual dispatch
+//!
+class BitstreamWriter final
     : public IBsWriter
 {
 public:
@@ -175,6 +179,8 @@ public:
     }
 
 private:
+    static const mfxU8 m_bitLengthTbl[256];  //!< Number of significant bits of a byte value
+
     void   RenormE();
     mfxU8 *m_bsStart;
     mfxU8 *m_bsEnd;
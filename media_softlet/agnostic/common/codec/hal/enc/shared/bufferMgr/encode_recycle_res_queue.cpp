@@ -26,6 +26,7 @@
 //!
 
 #include "encode_recycle_res_queue.h"
+#include <iterator>
 #include "encode_allocator.h"
 #include "encode_utils.h"
 #include "mos_os_specific.h"
@@ -45,6 +46,8 @@ RecycleQueue::RecycleQueue(const MOS_ALLOC_GFXRES_PARAMS &param,
         sizeof(MOS_ALLOC_GFXRES_PARAMS),
         &param,
         sizeof(MOS_ALLOC_GFXRES_PARAMS));
+
+    m_depth = m_maxLimit;
 }
 
 RecycleQueue::~RecycleQueue()
@@ -59,33 +62,112 @@ void *RecycleQueue::GetResource(uint32_t frameIndex, ResourceType type)
         return nullptr;
     }
 
+    m_type = type;
+
+    if (m_adaptive)
+    {
+        return GetAdaptiveResource(frameIndex);
+    }
+
     uint32_t currIndex = frameIndex % m_maxLimit;
 
     while (currIndex >= m_resources.size())
     {
-        m_type = type;
+        void *resource = AllocateResource();
+        if (resource == nullptr)
+        {
+            return nullptr;
+        }
 
-        void *resource = nullptr;
+        m_resources.push_back(resource);
+    }
+
+    void *res = m_resources[currIndex];
+
+    return res;
+}
 
-        if (m_type == ResourceType::SURFACE)
+void *RecycleQueue::AllocateResource()
+{
+    if (m_type == ResourceType::SURFACE)
+    {
+        return m_allocator->AllocateSurface(m_param, true);
+    }
+    else if (m_type == ResourceType::BUFFER)
+    {
+        return m_allocator->AllocateResource(m_param, true);
+    }
+
+    return nullptr;
+}
+
+void *RecycleQueue::GetAdaptiveResource(uint32_t frameIndex)
+{
+    auto it = m_frameResources.find(frameIndex);
+    if (it != m_frameResources.end())
+    {
+        return it->second;
+    }
+
+    // m_resources is kept in least recently used order, the front one belongs
+    // to the oldest frame and is reused once the queue holds m_depth resources
+    void *resource = nullptr;
+    if (m_resources.size() < m_depth)
+    {
+        resource = AllocateResource();
+        if (resource == nullptr)
         {
-            resource = m_allocator->AllocateSurface(m_param, true);
+            return nullptr;
         }
-        else if (m_type == ResourceType::BUFFER)
+    }
+    else
+    {
+        resource = m_resources.front();
+        m_resources.erase(m_resources.begin());
+    }
+    m_resources.push_back(resource);
+
+    m_frameResources[frameIndex] = resource;
+    while (m_frameResources.size() > m_maxLimit)
+    {
+        m_frameResources.erase(m_frameResources.begin());
+    }
+
+    return resource;
+}
+
+MOS_STATUS RecycleQueue::SetDepth(uint32_t depth)
+{
+    ENCODE_CHK_NULL_RETURN(m_allocator);
+
+    if (!m_adaptive)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    m_depth = MOS_CLAMP_MIN_MAX(depth, 1, m_maxLimit);
+
+    while (m_resources.size() > m_depth)
+    {
+        void *res = m_resources.front();
+        m_resources.erase(m_resources.begin());
+
+        for (auto it = m_frameResources.begin(); it != m_frameResources.end();)
         {
-            resource = m_allocator->AllocateResource(m_param, true);
+            it = (it->second == res) ? m_frameResources.erase(it) : std::next(it);
         }
-        else
+
+        if (m_type == SURFACE)
         {
-            return nullptr;
+            ENCODE_CHK_STATUS_RETURN(m_allocator->DestroySurface((MOS_SURFACE *)res));
+        }
+        else if (m_type == BUFFER)
+        {
+            ENCODE_CHK_STATUS_RETURN(m_allocator->DestroyResource((MOS_RESOURCE *)res));
         }
-        
-        m_resources.push_back(resource);
     }
 
-    void *res = m_resources[currIndex];
-
-    return res;
+    return MOS_STATUS_SUCCESS;
 }
 
 MOS_STATUS RecycleQueue::DestroyAllResources(EncodeAllocator *allocator)
@@ -110,6 +192,7 @@ MOS_STATUS RecycleQueue::DestroyAllResources(EncodeAllocator *allocator)
     }
 
     m_resources.clear();
+    m_frameResources.clear();
 
     return MOS_STATUS_SUCCESS;
 }
@@ -31,6 +31,7 @@
 #include "mos_defs.h"
 #include "mos_os.h"
 #include <stdint.h>
+#include <map>
 #include <vector>
 
 namespace encode
@@ -77,6 +78,30 @@ public:
     //!
     MOS_STATUS DestroyAllResources(EncodeAllocator *allocator);
 
+    //!
+    //! \brief  Hand out resources in least recently used order instead of by frame index
+    //!         modulo max limit, so the number of resources can follow SetDepth
+    //!
+    void SetAdaptive() { m_adaptive = true; }
+
+    //!
+    //! \brief  Whether the queue depth follows the in flight frame count
+    //! \return bool
+    //!         true if adaptive, else false
+    //!
+    bool IsAdaptive() const { return m_adaptive; }
+
+    //!
+    //! \brief  Set the number of resources kept by an adaptive queue
+    //! \details Growing takes effect on next allocation, shrinking destroys the
+    //!          least recently used resources right away
+    //! \param  [in] depth
+    //!         Resource count, clamped to [1, max limit], must cover in flight frames
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS SetDepth(uint32_t depth);
+
     //!
     //! \brief  Whether the m_type match with the given type
     //! \return bool
@@ -93,11 +118,18 @@ public:
         return m_type == type;
     }
 private:
+    void *AllocateResource();
+
+    void *GetAdaptiveResource(uint32_t frameIndex);
+
     uint32_t                m_maxLimit = 0;
     ResourceType            m_type = INVALID;
     MOS_ALLOC_GFXRES_PARAMS m_param = {};
     EncodeAllocator         *m_allocator = nullptr;  //!< encoder allocator
     std::vector<void *>     m_resources;      //<! All resources
+    bool                    m_adaptive = false;           //<! Resources are handed out in least recently used order
+    uint32_t                m_depth    = 0;               //<! Resource count of adaptive queue
+    std::map<uint32_t, void *> m_frameResources;          //<! Resource of recent frames in adaptive queue
 
 MEDIA_CLASS_DEFINE_END(encode__RecycleQueue)
 };
@@ -89,6 +89,67 @@ MOS_STATUS RecycleResource::RegisterResource(
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS RecycleResource::RegisterAdaptiveResource(
+    RecycleResId id,
+    MOS_ALLOC_GFXRES_PARAMS param,
+    uint32_t maxLimit)
+{
+    MOS_STATUS status = RegisterResource(id, param, maxLimit);
+    if (status != MOS_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    RecycleQueue *que = GetResQueue(id);
+    CHK_NULL_RETURN_STATUS(que);
+    que->SetAdaptive();
+
+    return que->SetDepth(m_adaptiveDepth);
+}
+
+MOS_STATUS RecycleResource::UpdateInFlightCount(uint32_t inFlightCount)
+{
+    // One more resource than frames in flight for the frame being prepared
+    uint32_t depth = m_adaptiveDepth;
+    if (inFlightCount + 1 > depth)
+    {
+        depth = inFlightCount + 1;
+    }
+
+    m_inFlightPeak = MOS_MAX(m_inFlightPeak, inFlightCount);
+    if (++m_inFlightSamples >= m_inFlightWindow)
+    {
+        if (m_inFlightPeak + 1 < depth)
+        {
+            depth = m_inFlightPeak + 1;
+        }
+        m_inFlightPeak    = 0;
+        m_inFlightSamples = 0;
+    }
+
+    depth = MOS_MIN(depth, (uint32_t)m_maxRecycleNum);
+    if (depth == m_adaptiveDepth)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+    m_adaptiveDepth = depth;
+
+    for (auto pair : m_resourceQueues)
+    {
+        auto que = pair.second;
+        if (que != nullptr && que->IsAdaptive())
+        {
+            MOS_STATUS status = que->SetDepth(m_adaptiveDepth);
+            if (status != MOS_STATUS_SUCCESS)
+            {
+                return status;
+            }
+        }
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
 MOS_SURFACE *RecycleResource::GetSurface(RecycleResId id, uint32_t frameIndex)
 {
     CHK_NULL_RETURN(m_allocator);
@@ -97,6 +97,32 @@ public:
     //!
     MOS_STATUS RegisterResource(RecycleResId id, MOS_ALLOC_GFXRES_PARAMS param, uint32_t maxLimit = m_maxRecycleNum);
 
+    //!
+    //! \brief  Register resource whose count follows the number of frames in flight
+    //! \details Only for resources written and consumed within one frame, the resource
+    //!          handed out for a frame index is not stable across frames
+    //! \param  [in] id
+    //!         The ID of resource which defined in RecycleResId
+    //! \param  [in] param
+    //!         MOS_ALLOC_GFXRES_PARAMS
+    //! \param  [in] maxLimit
+    //!         The limitation of number of the resource
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS RegisterAdaptiveResource(RecycleResId id, MOS_ALLOC_GFXRES_PARAMS param, uint32_t maxLimit = m_maxRecycleNum);
+
+    //!
+    //! \brief  Resize adaptive resource queues to the frames currently in flight
+    //! \details Called once per frame before any resource is requested. Depth grows
+    //!          at once and shrinks to the peak of the last m_inFlightWindow frames.
+    //! \param  [in] inFlightCount
+    //!         Submitted frames not completed yet
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS UpdateInFlightCount(uint32_t inFlightCount);
+
     //!
     //! \brief  Get Surface
     //! \param  [in] id
@@ -140,8 +166,13 @@ protected:
     }
 
     static const uint8_t m_maxRecycleNum = 6;
+    static const uint32_t m_inFlightWindow = 64;  //!< Frames observed before adaptive queues shrink
     EncodeAllocator *m_allocator     = nullptr;  //!< encoder allocator
 
+    uint32_t m_adaptiveDepth   = m_maxRecycleNum;  //!< Current depth of adaptive queues
+    uint32_t m_inFlightPeak    = 0;                //!< Max frames in flight in current window
+    uint32_t m_inFlightSamples = 0;                //!< Frames observed in current window
+
     std::map<RecycleResId, RecycleQueue *> m_resourceQueues{};  //!< resource queues
 
 MEDIA_CLASS_DEFINE_END(encode__RecycleResource)
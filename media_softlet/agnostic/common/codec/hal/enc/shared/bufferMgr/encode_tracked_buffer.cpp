@@ -68,15 +68,50 @@ MOS_STATUS TrackedBuffer::RegisterParam(BufferType type, MOS_ALLOC_GFXRES_PARAMS
     {
         m_allocParams.insert(std::make_pair(type, param));
     }
-    else
+    else if (!IsParamReusable(iter->second, param))
     {
-        // erase the older param and insert new one when resultion change happens
-        m_allocParams.erase(iter);
-        m_allocParams.insert(std::make_pair(type, param));
+        // replace the older param when resolution change happens, and retire
+        // the queue allocated with it so new slots get buffers of the new size
+        iter->second = param;
+
+        auto queue = m_bufferQueue.find(type);
+        if (queue != m_bufferQueue.end())
+        {
+            m_oldQueue.insert(std::move(*queue));
+            m_bufferQueue.erase(queue);
+        }
     }
     return MOS_STATUS_SUCCESS;
 }
 
+bool TrackedBuffer::IsParamReusable(const MOS_ALLOC_GFXRES_PARAMS &oldParam, const MOS_ALLOC_GFXRES_PARAMS &newParam)
+{
+    if (oldParam.Type != newParam.Type ||
+        oldParam.Format != newParam.Format ||
+        oldParam.TileType != newParam.TileType ||
+        oldParam.m_tileModeByForce != newParam.m_tileModeByForce ||
+        oldParam.ResUsageType != newParam.ResUsageType ||
+        oldParam.bIsCompressible != newParam.bIsCompressible ||
+        oldParam.CompressionMode != newParam.CompressionMode ||
+        oldParam.Flags.bNotLockable != newParam.Flags.bNotLockable)
+    {
+        return false;
+    }
+
+    // Linear buffers hold per frame data that HW addresses by the frame size,
+    // so a larger one serves a smaller frame, e.g. on an ABR down switch.
+    // Surfaces are programmed with their own dimensions and must match.
+    if (oldParam.Type == MOS_GFXRES_BUFFER)
+    {
+        return newParam.dwBytes <= oldParam.dwBytes;
+    }
+
+    return oldParam.dwWidth == newParam.dwWidth &&
+           oldParam.dwHeight == newParam.dwHeight &&
+           oldParam.dwDepth == newParam.dwDepth &&
+           oldParam.dwArraySize == newParam.dwArraySize;
+}
+
 MOS_STATUS TrackedBuffer::ReleaseUnusedSlots(
     CODEC_REF_LIST* refList,
     bool lazyRelease)
@@ -219,11 +254,14 @@ MOS_STATUS TrackedBuffer::Release(CODEC_REF_LIST* refList)
 
 MOS_STATUS TrackedBuffer::OnSizeChange()
 {
-    for (auto iter = m_bufferQueue.begin(); iter != m_bufferQueue.end();)
+    // Queues are retired per buffer type by RegisterParam once the new
+    // parameters no longer fit, buffers that still fit are kept across the
+    // change. Only drop the queues retired earlier which are idle by now.
+    for (auto iter = m_oldQueue.begin(); iter != m_oldQueue.end();)
     {
         if (iter->second->SafeToDestory())
         {
-            iter = m_bufferQueue.erase(iter);
+            iter = m_oldQueue.erase(iter);
         }
         else
         {
@@ -231,11 +269,18 @@ MOS_STATUS TrackedBuffer::OnSizeChange()
         }
     }
 
-    if (!m_bufferQueue.empty())
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS TrackedBuffer::PreAllocate(uint32_t count)
+{
+    AutoLock lock(m_mutex);
+
+    for (auto &param : m_allocParams)
     {
-        m_oldQueue.insert(std::make_move_iterator(m_bufferQueue.begin()),
-            std::make_move_iterator(m_bufferQueue.end()));
-        m_bufferQueue.clear();
+        std::shared_ptr<BufferQueue> queue = GetBufferQueue(param.first);
+        ENCODE_CHK_NULL_RETURN(queue);
+        ENCODE_CHK_STATUS_RETURN(queue->PreAllocate(MOS_MIN(count, (uint32_t)m_maxSlotCnt)));
     }
 
     return MOS_STATUS_SUCCESS;
@@ -150,6 +150,16 @@ public:
     //!
     MOS_STATUS OnSizeChange();
 
+    //!
+    //! \brief  Allocate resources of every registered buffer type up front,
+    //!         so slots acquired later don't allocate in the frame path
+    //! \param  [in] count
+    //!         Resource count per buffer type, clamped to the slot count
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS PreAllocate(uint32_t count);
+
     //!
     //! \brief  Get Surface from given slot
     //! \param  [in]type
@@ -201,6 +211,16 @@ protected:
     //!         MOS_STATUS_SUCCESS if success, else fail reason
     MOS_STATUS ReleaseUnusedSlots(CODEC_REF_LIST* refList, bool lazyRelease);
 
+    //!
+    //! \brief  Check whether buffers allocated with oldParam can serve newParam
+    //! \param  [in]oldParam
+    //!         parameters the existing buffers were allocated with
+    //! \param  [in]newParam
+    //!         newly registered parameters
+    //! \return bool
+    //!         true if the existing buffers can be kept
+    static bool IsParamReusable(const MOS_ALLOC_GFXRES_PARAMS &oldParam, const MOS_ALLOC_GFXRES_PARAMS &newParam);
+
     friend class BufferSlot;
     //!
     //! \brief  Get the tracked buffer queue according to the buffer type
@@ -245,7 +265,7 @@ protected:
 
     std::map<BufferType, MOS_ALLOC_GFXRES_PARAMS>       m_allocParams = {};  //!< allocate parameters
     std::map<BufferType, std::shared_ptr<BufferQueue> > m_bufferQueue = {};  //!< buffer queues
-    std::map<BufferType, std::shared_ptr<BufferQueue> > m_oldQueue = {};     //!< old queues for resolution change
+    std::multimap<BufferType, std::shared_ptr<BufferQueue> > m_oldQueue = {};  //!< old queues for resolution change
 
 MEDIA_CLASS_DEFINE_END(encode__TrackedBuffer)
 };
@@ -111,6 +111,24 @@ bool BufferQueue::SafeToDestory()
 }
 
 
+MOS_STATUS BufferQueue::PreAllocate(uint32_t count)
+{
+    AutoLock lock(m_mutex);
+
+    count = MOS_MIN(count, m_maxCount);
+    while (m_allocCount < count)
+    {
+        void *resource = AllocateResource();
+        ENCODE_CHK_NULL_RETURN(resource);
+
+        m_allocCount++;
+        m_resources.push_back(resource);
+        m_resourcePool.push_back(resource);
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
 void *BufferQueue::AllocateResource()
 {
     if (m_allocator)
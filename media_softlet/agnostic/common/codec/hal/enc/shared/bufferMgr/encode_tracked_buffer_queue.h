@@ -87,6 +87,15 @@ public:
     //!
     bool SafeToDestory();
 
+    //!
+    //! \brief  Fill the pool until count resources have been allocated
+    //! \param  [in] count
+    //!         Resource count to reach, clamped to the max count
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS PreAllocate(uint32_t count);
+
     void SetResourceType(ResourceType resType) { m_resourceType = resType; }
 
 protected:
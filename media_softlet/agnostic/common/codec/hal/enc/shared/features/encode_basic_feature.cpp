@@ -87,6 +87,13 @@ MOS_STATUS EncodeBasicFeature::Init(void *setting)
         MediaUserSetting::Group::Sequence);
     m_panicEnable = outValue.Get<bool>();
 
+    ReadUserSetting(
+        m_userSettingPtr,
+        outValue,
+        "Encode Tracked Buffer Pre Allocate Count",
+        MediaUserSetting::Group::Sequence);
+    m_trackedBufPreAllocCount = outValue.Get<uint32_t>();
+
     ReadUserSetting(
         m_userSettingPtr,
         outValue,
@@ -312,6 +319,11 @@ MOS_STATUS EncodeBasicFeature::UpdateTrackedBufferParameters()
         ENCODE_CHK_STATUS_RETURN(m_trackedBuf->RegisterParam(encode::BufferType::ds8xSurface, allocParamsForBuffer2D));
     }
 
+    if (m_trackedBufPreAllocCount > 0)
+    {
+        ENCODE_CHK_STATUS_RETURN(m_trackedBuf->PreAllocate(m_trackedBufPreAllocCount));
+    }
+
     return MOS_STATUS_SUCCESS;
 }
 
@@ -119,6 +119,7 @@ public:
     uint32_t                     m_NumNalUnits = 0;           //!< Number of NAL units in ppNALUnitParams.
 
     bool                        m_panicEnable = false;        //!< Indicate if panic is enabled
+    uint32_t                    m_trackedBufPreAllocCount = 0; //!< Tracked buffers allocated per type up front, 0 to allocate on first use
 
     bool                        m_newSeqHeader = false;       //!< New sequence header flag
     bool                        m_newPpsHeader = false;       //!< New PPS header flag
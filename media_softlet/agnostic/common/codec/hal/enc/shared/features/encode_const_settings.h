@@ -35,6 +35,14 @@
 #include "encode_utils.h"
 #include "mhw_vdbox_vdenc_cmdpar.h"
 
+//!
+//! \brief  Per encoder instance VDENC settings
+//! \details Built once in PrepareConstSettings when the feature manager is created,
+//!          then only read per frame. The setting lambdas capture the owning
+//!          const settings object by reference (see VDENC_CMD1_LAMBDA) and read its
+//!          current seq/pic params, so they are per instance and cannot be shared
+//!          between encoder sessions.
+//!
 struct VdencFeatureSettings: MediaFeatureSettings
 {
     virtual ~VdencFeatureSettings(){};
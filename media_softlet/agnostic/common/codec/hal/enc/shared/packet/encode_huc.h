@@ -113,6 +113,10 @@ namespace encode
 
         //!
         //! \brief  Add HUC_IMEM_STATE command
+        //! \details Selects the firmware kernel run by the following HUC_START. HuC
+        //!          kernels (BRC init/update, S2L, ...) share the engine, so this is
+        //!          sent per HuC workload; firmware loading and authentication are
+        //!          done once by the kernel driver, not per context.
         //! \param  [in] cmdBuffer
         //!         Pointer to command buffer
         //! \return MOS_STATUS
@@ -124,6 +128,8 @@ namespace encode
 
         //!
         //! \brief  Store HuCStatus2
+        //! \details GPU side only: the IMEM loaded bit is written and compared on the
+        //!          GPU, the CPU never waits on it.
         //! \param  [in] cmdBuffer
         //!         Pointer to command buffer
         //! \param  [in] storeHucStatus2Needed
@@ -220,6 +220,14 @@ MOS_STATUS EncodePipeline::Prepare(void *params)
     ENCODE_CHK_NULL_RETURN(m_hwInterface);
 
     ENCODE_CHK_NULL_RETURN(m_featureManager);
+
+    if (m_recycleBuf != nullptr && m_statusReport != nullptr)
+    {
+        uint32_t submitted = m_statusReport->GetSubmittedCount();
+        uint32_t completed = m_statusReport->GetCompletedCount();
+        ENCODE_CHK_STATUS_RETURN(m_recycleBuf->UpdateInFlightCount(submitted > completed ? submitted - completed : 0));
+    }
+
     ENCODE_CHK_STATUS_RETURN(m_featureManager->CheckFeatures(params));
     ENCODE_CHK_STATUS_RETURN(m_featureManager->Update(params));
     m_encodecp->UpdateParams(true);
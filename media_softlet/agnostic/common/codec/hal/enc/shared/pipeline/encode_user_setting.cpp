@@ -86,6 +86,13 @@ MOS_STATUS EncodePipeline::InitUserSetting(MediaUserSettingSharedPtr userSetting
         int32_t(1),
         false);
 
+    DeclareUserSettingKey(
+        userSettingPtr,
+        "Encode Tracked Buffer Pre Allocate Count",
+        MediaUserSetting::Group::Sequence,
+        uint32_t(0),
+        false);
+
     DeclareUserSettingKey(
         userSettingPtr,
         "HEVC Encode Enable HW Stitch",
@@ -122,6 +122,11 @@ MOS_STATUS Vp9EncodeHpu::Update(void *params)
     }
 
     // Initialize huc prob dmem buffers in the first pass.
+    // Probability contexts already stay resident in m_resProbBuffer and the
+    // forward update runs in HuC, only the DMEM is written by CPU. All three
+    // are reset here rather than per pass because the VDENC pass writes
+    // FrameSize into the next pass' DMEM on GPU, which a later CPU re-init
+    // would overwrite.
     for (auto i = 0; i < 3; ++i)
     {
         auto dmem = (HucProbDmem *)m_allocator->LockResourceForWrite(
@@ -72,6 +72,26 @@ bool FrameTrackerToken::IsExpired()
     return true;
 }
 
+MOS_STATUS FrameTrackerToken::Wait(uint32_t timeoutUs)
+{
+    if (m_producer == nullptr)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    uint64_t start = MosUtilities::MosGetCurTime();
+    for (auto ite = m_holdTrackers.begin(); ite != m_holdTrackers.end(); ite ++)
+    {
+        uint64_t elapsed   = MosUtilities::MosGetCurTime() - start;
+        uint32_t remaining = elapsed >= timeoutUs ? 0 : (uint32_t)(timeoutUs - elapsed);
+        if (!MosUtilities::MosWaitForCounter(m_producer->GetLatestTrackerAddress(ite->first), ite->second, remaining))
+        {
+            return MOS_STATUS_STILL_DRAWING;
+        }
+    }
+    return MOS_STATUS_SUCCESS;
+}
+
 void FrameTrackerToken::Merge(const FrameTrackerToken *token)
 {
     m_producer = token->m_producer;
@@ -221,6 +221,11 @@ MOS_STATUS MemoryBlockManager::RefreshBlockStates(bool &blocksUpdated)
 
             blocksUpdated = true;
         }
+        else if (!m_useProducer)
+        {
+            // The list is in tracker ID order, everything after this block is still in flight
+            break;
+        }
         block = nextSubmitted;
     }
 
@@ -689,8 +694,39 @@ MOS_STATUS MemoryBlockManager::AddBlockToSortedList(
             m_sortedBlockListSizes[state] += block->GetSize();
             break;
         }
-        case MemoryBlockInternal::State::allocated:
         case MemoryBlockInternal::State::submitted:
+        {
+            // Tracker IDs are handed out in increasing order, so the insertion point
+            // is normally the tail and the walk below ends immediately.
+            auto prev = m_submittedBlockListTail;
+            while (!m_useProducer && prev != nullptr && prev->GetTrackerId() > block->GetTrackerId())
+            {
+                prev = prev->m_statePrev;
+            }
+            block->m_statePrev = prev;
+            block->m_stateNext = prev ? prev->m_stateNext : m_sortedBlockList[state];
+            if (block->m_stateNext)
+            {
+                block->m_stateNext->m_statePrev = block;
+            }
+            else
+            {
+                m_submittedBlockListTail = block;
+            }
+            if (prev)
+            {
+                prev->m_stateNext = block;
+            }
+            else
+            {
+                m_sortedBlockList[state] = block;
+            }
+            block->m_stateListType = state;
+            m_sortedBlockListNumEntries[state]++;
+            m_sortedBlockListSizes[state] += block->GetSize();
+            break;
+        }
+        case MemoryBlockInternal::State::allocated:
         case MemoryBlockInternal::State::deleted:
             block->m_stateNext = curr;
             if (curr)
@@ -748,6 +784,10 @@ MOS_STATUS MemoryBlockManager::RemoveBlockFromSortedList(
             {
                 block->m_stateNext->m_statePrev = block->m_statePrev;
             }
+            else if (state == MemoryBlockInternal::State::submitted)
+            {
+                m_submittedBlockListTail = block->m_statePrev;
+            }
             block->m_statePrev = block->m_stateNext = nullptr;
             block->m_stateListType = MemoryBlockInternal::State::stateCount;
             m_sortedBlockListNumEntries[state]--;
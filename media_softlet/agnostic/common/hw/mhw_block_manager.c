@@ -1040,8 +1040,8 @@ MOS_STATUS MHW_BLOCK_MANAGER::MergeBlocksInternal(
         if (pBlockL->BlockState != MHW_BLOCK_STATE_FREE)
         {
             pBlockL->dwDataSize         += pBlockH->dwBlockSize;
-            pBlockL->pStateHeap->dwFree -= pBlockL->dwBlockSize;
-            pBlockL->pStateHeap->dwUsed += pBlockL->dwBlockSize;
+            pBlockL->pStateHeap->dwFree -= pBlockH->dwBlockSize;
+            pBlockL->pStateHeap->dwUsed += pBlockH->dwBlockSize;
         }
 
         // Add size to the target block list
@@ -1351,6 +1351,12 @@ PMHW_STATE_HEAP_MEMORY_BLOCK MHW_BLOCK_MANAGER::AllocateBlock(
     // Enforce min block size
     dwAllocSize = MOS_MAX(m_Params.dwHeapBlockMinSize, dwAllocSize);
 
+    // No single free block can fit if all of them together cannot - skip the search
+    if (pFree->dwSize < dwAllocSize)
+    {
+        return nullptr;
+    }
+
     // Search list of free blocks for the first match
     for (pBlock = pFree->pHead; pBlock != nullptr; pBlock = pBlock->pNext)
     {
@@ -237,6 +237,13 @@ protected:
         this->m_currentBatchBuf = batchBuf;
 
         // set MHW cmd
+        // The par/cmd pair of each command is allocated once per interface and
+        // reused across frames, but the binary is rebuilt on every call: SETCMD
+        // also adds the resource patch/residency entries of the current command
+        // buffer, so replaying the previous frame's dwords would drop them.
+        // The reset itself is cheap: the generated command constructors store
+        // the default binary as whole DWORD constants, and SETCMD only writes
+        // the fields that depend on params.
         cmd = {};
         MHW_CHK_STATUS_RETURN(setting());
 
@@ -433,6 +433,9 @@ public:
     {
         _MHW_SETCMD_CALLBASE(MI_LOAD_REGISTER_IMM);
 
+        // One register per command: the MMIO remap / CS relative offset bits
+        // live in DW0 and are chosen per register by the platform override,
+        // so adjacent LRIs cannot share one header in general.
         cmd.DW1.RegisterOffset = params.dwRegister >> 2;
         cmd.DW2.DataDword      = params.dwData;
 
@@ -590,7 +593,10 @@ public:
             &resourceParams));
 
         cmd.DW0.UseGlobalGtt = IsGlobalGttInUse();
-        // Force single DW write, driver never writes a QW
+        // Force single DW write, driver never writes a QW: the runs of stores
+        // issued by status report and perf profiler are not qword aligned
+        // (e.g. PerfEntry::beginCpuTime sits at 4 mod 8), so there is nothing
+        // to pair into a QW store.
         cmd.DW0.StoreQword = 0;
         cmd.DW0.DwordLength--;
 
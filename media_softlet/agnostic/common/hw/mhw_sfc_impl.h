@@ -322,6 +322,11 @@ public:
         int32_t * piYCoefsX, *piYCoefsY;
         int32_t * piUVCoefsX, *piUVCoefsY;
         MHW_PLANE Plane;
+        // Ratio and tap count of the polyphase tables built for X in this call, so that a
+        // vertical table with the same inputs can be copied instead of calculated again.
+        float     fYPolyphaseScaleX  = -1.0F;
+        float     fUVPolyphaseScaleX = -1.0F;
+        float     fUVPolyphaseTapsX  = 0.0F;
 
         MHW_CHK_NULL_RETURN(pLumaTable);
         MHW_CHK_NULL_RETURN(pChromaTable);
@@ -420,6 +425,7 @@ public:
                         bUse8x8Filter,
                         NUM_HW_POLYPHASE_TABLES,
                         0));
+                    fYPolyphaseScaleX = fScaleX;
                 }
 
                 // The 8-tap adaptive is enabled for all channel if RGB format input, then UV/RB use the same coefficient as Y/G
@@ -434,6 +440,7 @@ public:
                             piUVCoefsX,
                             2.0F,
                             fScaleX));
+                        fUVPolyphaseTapsX = 2.0F;
                     }
                     else
                     {
@@ -442,7 +449,9 @@ public:
                             piUVCoefsX,
                             3.0F,
                             fScaleX));
+                        fUVPolyphaseTapsX = 3.0F;
                     }
+                    fUVPolyphaseScaleX = fScaleX;
                 }
             }
         }
@@ -493,15 +502,27 @@ public:
                     // Clamp the Scaling Factor if > 1.0x
                     fScaleY = MOS_MIN(1.0F, fScaleY);
 
-                    MHW_CHK_STATUS_RETURN(Mhw_CalcPolyphaseTablesY(
-                        piYCoefsY,
-                        fScaleY,
-                        Plane,
-                        srcFormat,
-                        fHPStrength,
-                        bUse8x8Filter,
-                        NUM_HW_POLYPHASE_TABLES,
-                        0));
+                    if (fYPolyphaseScaleX == fScaleY)
+                    {
+                        // Same ratio as X, e.g. aspect ratio preserving scaling
+                        MHW_CHK_STATUS_RETURN(MOS_SecureMemcpy(
+                            piYCoefsY,
+                            8 * 32 * sizeof(int32_t),
+                            piYCoefsX,
+                            8 * 32 * sizeof(int32_t)));
+                    }
+                    else
+                    {
+                        MHW_CHK_STATUS_RETURN(Mhw_CalcPolyphaseTablesY(
+                            piYCoefsY,
+                            fScaleY,
+                            Plane,
+                            srcFormat,
+                            fHPStrength,
+                            bUse8x8Filter,
+                            NUM_HW_POLYPHASE_TABLES,
+                            0));
+                    }
                 }
 
                 // The 8-tap adaptive is enabled for all channel if RGB format input, then UV/RB use the same coefficient as Y/G
@@ -509,20 +530,22 @@ public:
                 if (!(IS_RGB32_FORMAT(srcFormat) && bUse8x8Filter))
                 {
                     // If Chroma Siting info is present
-                    if (dwChromaSiting & MHW_CHROMA_SITING_VERT_TOP)
+                    float fUVTaps = (dwChromaSiting & MHW_CHROMA_SITING_VERT_TOP) ? 2.0F : 3.0F;
+
+                    if (fUVPolyphaseScaleX == fScaleY && fUVPolyphaseTapsX == fUVTaps)
                     {
-                        // No Chroma Siting
-                        MHW_CHK_STATUS_RETURN(Mhw_CalcPolyphaseTablesUV(
+                        MHW_CHK_STATUS_RETURN(MOS_SecureMemcpy(
                             piUVCoefsY,
-                            2.0F,
-                            fScaleY));
+                            4 * 32 * sizeof(int32_t),
+                            piUVCoefsX,
+                            4 * 32 * sizeof(int32_t)));
                     }
                     else
                     {
-                        // Chroma siting offset will be add in the HW cmd
+                        // 2 taps if no chroma siting, otherwise chroma siting offset will be add in the HW cmd
                         MHW_CHK_STATUS_RETURN(Mhw_CalcPolyphaseTablesUV(
                             piUVCoefsY,
-                            3.0F,
+                            fUVTaps,
                             fScaleY));
                     }
                 }
@@ -21,6 +21,10 @@
 */
 //!
 //! \file     media_bin_mgr.h
+//! \details  Without MEDIA_BIN_SUPPORT the kernel binaries are const arrays in the
+//!           read-only data of the driver library. They are only demand paged from
+//!           the mapped file when a feature copies its kernels into a state heap, so
+//!           kernels of features a process never creates cost no memory or load time.
 //!
 
 #ifndef MEDIA_BIN_MGR_H__
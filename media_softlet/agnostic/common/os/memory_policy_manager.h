@@ -60,6 +60,10 @@ public:
     //! \brief   Updates resource memory policy
     //!
     //! \details Update memory policy to decide which type of memory is allocated (device memory, system memory or default setting).
+    //!          Tiled surfaces, i.e. reference frames and render targets, default to video memory and
+    //!          only 1D linear buffers default to system memory; callers override with preferredMemType.
+    //!          The i915 backend creates video memory BOs with the device region alone, so a surface
+    //!          only reaches system memory through KMD eviction, which has no per BO priority in uapi.
     //! \param   [in] memPolicyPar
     //!          The pointer to MemoryPolicyParameter
     //!
@@ -81,6 +81,8 @@ MOS_STATUS CmdBufMgrNext::Initialize(OsContextNext *osContext, uint32_t cmdBufSi
                 return MOS_STATUS_INVALID_HANDLE;
             }
 
+            cmdBuf->SetLastUsedTime(MosUtilities::MosGetCurTime());
+
             MosUtilities::MosLockMutex(m_availablePoolMutex);
             m_availableCmdBufPool.push_back(cmdBuf);
             MosUtilities::MosUnlockMutex(m_availablePoolMutex);
@@ -206,7 +208,7 @@ void CmdBufMgrNext::CleanUp()
     m_availablePoolMutex = nullptr;
 }
 
-CommandBufferNext *CmdBufMgrNext::PickupOneCmdBuf(uint32_t size)
+CommandBufferNext *CmdBufMgrNext::PickupOneCmdBuf(uint32_t size, uint32_t sizeHint)
 {
     MOS_OS_FUNCTION_ENTER;
 
@@ -222,54 +224,56 @@ CommandBufferNext *CmdBufMgrNext::PickupOneCmdBuf(uint32_t size)
 
     CommandBufferNext* cmdBuf = nullptr;
     CommandBufferNext* retbuf  = nullptr;
-    MOS_STATUS     eStatus = MOS_STATUS_SUCCESS;
+    uint32_t       allocSize = GetSizeClass(size > sizeHint ? size : sizeHint);
 
     if (!m_availableCmdBufPool.empty())
     {
-        cmdBuf = *(m_availableCmdBufPool.begin());
-        if (cmdBuf == nullptr)
-        {
-            MOS_OS_ASSERTMESSAGE("available command buf pool is null.");
-            MosUtilities::MosUnlockMutex(m_inUsePoolMutex);
-            MosUtilities::MosUnlockMutex(m_availablePoolMutex);
-            return nullptr;
-        }
-
-        // find available buf
-        if (size <= cmdBuf->GetCmdBufSize() && !cmdBuf->IsUsedByHw() && !cmdBuf->IsInCmdList())
+        // available pool is sorted by decent order, so walk up from the
+        // smallest buffer and take the first idle one large enough
+        uint32_t probed = 0;
+        for (auto iter = m_availableCmdBufPool.rbegin(); iter != m_availableCmdBufPool.rend(); iter++)
         {
-            m_inUseCmdBufPool.push_back(cmdBuf);
-
-            m_availableCmdBufPool.erase(m_availableCmdBufPool.begin());
+            cmdBuf = *iter;
+            if (cmdBuf == nullptr)
+            {
+                MOS_OS_ASSERTMESSAGE("available command buf pool is null.");
+                MosUtilities::MosUnlockMutex(m_inUsePoolMutex);
+                MosUtilities::MosUnlockMutex(m_availablePoolMutex);
+                return nullptr;
+            }
+            if (size > cmdBuf->GetCmdBufSize())
+            {
+                continue;
+            }
+            if (!cmdBuf->IsUsedByHw() && !cmdBuf->IsInCmdList())
+            {
+                m_inUseCmdBufPool.push_back(cmdBuf);
+                m_availableCmdBufPool.erase(std::next(iter).base());
+                retbuf = cmdBuf;
 
-            MOS_OS_VERBOSEMESSAGE("successfully get available buf from pool");
+                MOS_OS_VERBOSEMESSAGE("successfully get available buf from pool");
+                break;
+            }
+            if (++probed >= m_maxPickupProbe)
+            {
+                break;
+            }
         }
+
         // available buf  is not large enough, need reallocate
-        else
+        if (retbuf == nullptr)
         {
             MOS_OS_VERBOSEMESSAGE("find available buf, but is not large enough or it is still used by HW");
 
-            cmdBuf = CommandBufferNext::CreateCmdBuf(this);
-            if (cmdBuf == nullptr)
-            {
-                MOS_OS_ASSERTMESSAGE("input nullptr returned by CommandBuffer::CreateCmdBuf.");
-            }
-            else
+            cmdBuf = CreateAndAllocateCmdBuf(allocSize);
+            if (cmdBuf != nullptr)
             {
-                eStatus = cmdBuf->Allocate(m_osContext, size);
-                if (eStatus != MOS_STATUS_SUCCESS)
-                {
-                    MOS_OS_ASSERTMESSAGE("Allocate CmdBuf failed");
-                }
-
                 // directly push into inuse pool
                 m_inUseCmdBufPool.push_back(cmdBuf);
                 m_cmdBufTotalNum++;
-
             }
+            retbuf = cmdBuf;
         }
-
-        retbuf = cmdBuf;
     }
     // no available buf in the pool, will allocate in batch
     else
@@ -281,23 +285,13 @@ CommandBufferNext *CmdBufMgrNext::PickupOneCmdBuf(uint32_t size)
             MOS_OS_VERBOSEMESSAGE("Increase the cmd buf pool size by %d", m_bufIncStepSize);
             for (uint32_t i = 0; i < m_bufIncStepSize; i++)
             {
-                cmdBuf = CommandBufferNext::CreateCmdBuf(this);
+                cmdBuf = CreateAndAllocateCmdBuf(allocSize);
                 if (cmdBuf == nullptr)
                 {
-                    MOS_OS_ASSERTMESSAGE("input nullptr returned by CommandBuffer::CreateCmdBuf.");
-                    continue;
-                }
-
-                eStatus = cmdBuf->Allocate(m_osContext, size);
-                if (eStatus != MOS_STATUS_SUCCESS)
-                {
-                    MOS_OS_ASSERTMESSAGE("Allocate CmdBuf#%d failed", i);
-                    cmdBuf->Free();
-                    MOS_Delete(cmdBuf);
                     continue;
                 }
 
-                if (i == 0)
+                if (retbuf == nullptr)
                 {
                     // directly push into inuse pool
                     m_inUseCmdBufPool.push_back(cmdBuf);
@@ -327,6 +321,149 @@ CommandBufferNext *CmdBufMgrNext::PickupOneCmdBuf(uint32_t size)
     return retbuf;
 }
 
+MOS_STATUS CmdBufMgrNext::PrewarmCmdBufs(uint32_t size, uint32_t count)
+{
+    MOS_OS_FUNCTION_ENTER;
+
+    if (!m_initialized)
+    {
+        MOS_OS_ASSERTMESSAGE("cmd buf pool need be initialized before buffer prewarm!");
+        return MOS_STATUS_UNKNOWN;
+    }
+
+    uint32_t allocSize = GetSizeClass(size);
+    uint32_t ready     = 0;
+
+    MosUtilities::MosLockMutex(m_availablePoolMutex);
+
+    for (auto &cmdBuf : m_availableCmdBufPool)
+    {
+        if (cmdBuf != nullptr && cmdBuf->GetCmdBufSize() >= allocSize)
+        {
+            ready++;
+        }
+    }
+
+    for (; ready < count && m_cmdBufTotalNum < m_maxPoolSize; ready++)
+    {
+        auto cmdBuf = CreateAndAllocateCmdBuf(allocSize);
+        if (cmdBuf == nullptr)
+        {
+            MosUtilities::MosUnlockMutex(m_availablePoolMutex);
+            return MOS_STATUS_NO_SPACE;
+        }
+        UpperInsert(cmdBuf);
+        m_cmdBufTotalNum++;
+    }
+
+    MosUtilities::MosUnlockMutex(m_availablePoolMutex);
+
+    return MOS_STATUS_SUCCESS;
+}
+
+void CmdBufMgrNext::UpdateHighWaterMark(MOS_GPU_NODE node, uint32_t size)
+{
+    if ((uint32_t)node >= MOS_GPU_NODE_MAX)
+    {
+        return;
+    }
+
+    MosUtilities::MosLockMutex(m_availablePoolMutex);
+    if (size > m_highWaterMark[node])
+    {
+        m_highWaterMark[node] = size;
+    }
+    MosUtilities::MosUnlockMutex(m_availablePoolMutex);
+}
+
+uint32_t CmdBufMgrNext::GetHighWaterMark(MOS_GPU_NODE node)
+{
+    if ((uint32_t)node >= MOS_GPU_NODE_MAX)
+    {
+        return 0;
+    }
+
+    MosUtilities::MosLockMutex(m_availablePoolMutex);
+    uint32_t size = m_highWaterMark[node];
+    MosUtilities::MosUnlockMutex(m_availablePoolMutex);
+
+    return size;
+}
+
+uint32_t CmdBufMgrNext::GetSizeClass(uint32_t size)
+{
+    if (size <= m_minSizeClass)
+    {
+        return m_minSizeClass;
+    }
+
+    uint32_t pow2 = m_minSizeClass;
+    while (pow2 <= (size - 1) / 2)
+    {
+        pow2 <<= 1;
+    }
+
+    // pow2 is the largest power of two below size, round up in quarters of it
+    uint32_t step = pow2 / 4;
+    return MOS_ALIGN_CEIL(size, step);
+}
+
+CommandBufferNext *CmdBufMgrNext::CreateAndAllocateCmdBuf(uint32_t size)
+{
+    auto cmdBuf = CommandBufferNext::CreateCmdBuf(this);
+    if (cmdBuf == nullptr)
+    {
+        MOS_OS_ASSERTMESSAGE("input nullptr returned by CommandBuffer::CreateCmdBuf.");
+        return nullptr;
+    }
+
+    if (cmdBuf->Allocate(m_osContext, size) != MOS_STATUS_SUCCESS)
+    {
+        MOS_OS_ASSERTMESSAGE("Allocate CmdBuf failed");
+        cmdBuf->Free();
+        MOS_Delete(cmdBuf);
+        return nullptr;
+    }
+
+    cmdBuf->SetLastUsedTime(MosUtilities::MosGetCurTime());
+    return cmdBuf;
+}
+
+void CmdBufMgrNext::TrimIdleCmdBufs(uint64_t now)
+{
+    if (now - m_lastTrimTime < m_trimIntervalUs)
+    {
+        return;
+    }
+    m_lastTrimTime = now;
+
+    auto gpuContextMgr = m_osContext->GetGpuContextMgr();
+    auto iter          = m_availableCmdBufPool.begin();
+    while (iter != m_availableCmdBufPool.end() && m_availableCmdBufPool.size() > m_minIdleBufNum)
+    {
+        auto cmdBuf = *iter;
+        if (cmdBuf == nullptr ||
+            now - cmdBuf->GetLastUsedTime() < m_idleTimeoutUs ||
+            cmdBuf->IsUsedByHw() || cmdBuf->IsInCmdList())
+        {
+            iter++;
+            continue;
+        }
+
+        auto gpuContext       = cmdBuf->GetLastNativeGpuContext();
+        auto gpuContextHandle = cmdBuf->GetLastNativeGpuContextHandle();
+        if (gpuContext != nullptr && gpuContextMgr && gpuContext == gpuContextMgr->GetGpuContext(gpuContextHandle))
+        {
+            cmdBuf->UnBindToGpuContext(true);
+        }
+        cmdBuf->Free();
+        MOS_Delete(cmdBuf);
+
+        iter = m_availableCmdBufPool.erase(iter);
+        m_cmdBufTotalNum--;
+    }
+}
+
 void CmdBufMgrNext::UpperInsert(CommandBufferNext *cmdBuf)
 {
     auto it = std::find_if(m_availableCmdBufPool.begin(), m_availableCmdBufPool.end(), [=](CommandBufferNext * p1){return p1->GetCmdBufSize() < cmdBuf->GetCmdBufSize();});
@@ -369,7 +506,10 @@ MOS_STATUS CmdBufMgrNext::ReleaseCmdBuf(CommandBufferNext *cmdBuf)
     }
     else
     {
+        uint64_t now = MosUtilities::MosGetCurTime();
+        cmdBuf->SetLastUsedTime(now);
         UpperInsert(cmdBuf);
+        TrimIdleCmdBufs(now);
     }
 
     // unlock after release buffer
@@ -85,12 +85,59 @@ public:
     //!              buffers, buffer number base on m_initBufNum, buffer size
     //!              base on input required size. After re-allocate, put first buf
     //!              into inuse pool, remains push to available pool.
+    //!           The smallest idle buffer of the available pool that fits is
+    //!           taken, new buffers are allocated with the size class of the
+    //!           larger of size and sizeHint.
     //! \param    [in] size
     //!           Required command buffer size
+    //! \param    [in] sizeHint
+    //!           Size the caller expects to need later, e.g. its high-water mark
     //! \return   CommandBuffer*
     //!           Proper comamnd bufffer pointer if success, other wise nullptr
     //!
-    CommandBufferNext *PickupOneCmdBuf(uint32_t size);
+    CommandBufferNext *PickupOneCmdBuf(uint32_t size, uint32_t sizeHint = 0);
+
+    //!
+    //! \brief    Make sure idle command buffers are available for a new context
+    //! \details  Allocates buffers until the available pool holds at least
+    //!           count buffers of the size class of size.
+    //! \param    [in] size
+    //!           Required command buffer size
+    //! \param    [in] count
+    //!           Number of buffers to keep ready
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if success, other wise fail reason
+    //!
+    MOS_STATUS PrewarmCmdBufs(uint32_t size, uint32_t count);
+
+    //!
+    //! \brief    Record the command buffer size used by a workload on a node
+    //! \param    [in] node
+    //!           Gpu node of the workload
+    //! \param    [in] size
+    //!           Command buffer size required by the workload
+    //!
+    void UpdateHighWaterMark(MOS_GPU_NODE node, uint32_t size);
+
+    //!
+    //! \brief    Get the largest command buffer size used on a node
+    //! \param    [in] node
+    //!           Gpu node
+    //! \return   uint32_t
+    //!           High-water mark, 0 if nothing was recorded
+    //!
+    uint32_t GetHighWaterMark(MOS_GPU_NODE node);
+
+    //!
+    //! \brief    Round a command buffer size up to its size class
+    //! \details  Classes are 4 steps per power of two, so buffers are
+    //!           interchangeable between close sizes and waste at most 25%.
+    //! \param    [in] size
+    //!           Required command buffer size
+    //! \return   uint32_t
+    //!           Size class
+    //!
+    static uint32_t GetSizeClass(uint32_t size);
 
     //!
     //! \brief    insert the command buffer into available pool in proper location.
@@ -180,6 +227,24 @@ public:
     //!
     static bool GreaterSizeSort(CommandBufferNext *a, CommandBufferNext *b);
 
+    //!
+    //! \brief    Create a command buffer and allocate its resource
+    //! \param    [in] size
+    //!           Command buffer size
+    //! \return   CommandBufferNext*
+    //!           Command buffer if success, otherwise nullptr
+    //!
+    CommandBufferNext *CreateAndAllocateCmdBuf(uint32_t size);
+
+    //!
+    //! \brief    Free available command buffers which have been idle too long
+    //! \details  Caller must hold m_availablePoolMutex. Runs at most once per
+    //!           m_trimIntervalUs and keeps m_minIdleBufNum buffers.
+    //! \param    [in] now
+    //!           Current time in us
+    //!
+    void TrimIdleCmdBufs(uint64_t now);
+
     //! \brief   Max comamnd buffer number for per manager, including all
     //!          command buffer in availble pool and in-use pool
     constexpr static uint32_t m_maxPoolSize = 1098304;
@@ -193,6 +258,27 @@ public:
     //! \brief   Initial command buffer number
     constexpr static uint32_t m_initBufNum = 32;
 
+    //! \brief   Smallest command buffer size class
+    constexpr static uint32_t m_minSizeClass = 4096;
+
+    //! \brief   Max idle buffers checked for HW use when picking up one
+    constexpr static uint32_t m_maxPickupProbe = 8;
+
+    //! \brief   Available buffers kept however long they are idle
+    constexpr static uint32_t m_minIdleBufNum = m_bufIncStepSize;
+
+    //! \brief   Time in us after which an idle available buffer is freed
+    constexpr static uint64_t m_idleTimeoutUs = 10000000;
+
+    //! \brief   Min time in us between two idle buffer trims
+    constexpr static uint64_t m_trimIntervalUs = 1000000;
+
+    //! \brief   Time in us of the last idle buffer trim
+    uint64_t m_lastTrimTime = 0;
+
+    //! \brief   Largest command buffer size requested per gpu node
+    uint32_t m_highWaterMark[MOS_GPU_NODE_MAX] = {};
+
     //! \brief   Sorted List of available command buffer pool
     std::vector<CommandBufferNext *> m_availableCmdBufPool;
 
@@ -218,6 +218,20 @@ public:
         return m_cmdBufMgr;
     }
 
+    //!
+    //! \brief    Get the time the command buffer was last returned to its manager
+    //! \return   uint64_t
+    //!           Time in us
+    //!
+    uint64_t GetLastUsedTime() { return m_lastUsedTime; }
+
+    //!
+    //! \brief    Set the time the command buffer was last returned to its manager
+    //! \param    [in] time
+    //!           Time in us
+    //!
+    void SetLastUsedTime(uint64_t time) { m_lastUsedTime = time; }
+
 protected:
     //!
     //! \brief    Set ready to use
@@ -254,6 +268,9 @@ protected:
 
     //! \brief    Command buffer size
     uint32_t          m_size             = 0;
+
+    //! \brief    Time in us the buffer was last released to the manager
+    uint64_t          m_lastUsedTime     = 0;
 MEDIA_CLASS_DEFINE_END(CommandBufferNext)
 };
 #endif // __MOS_COMMANDBUFFERNext_NEXT_H__
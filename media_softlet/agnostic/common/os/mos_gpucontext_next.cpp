@@ -40,3 +40,26 @@ GpuContextNext *GpuContextNext::Create(
     return gpuContextNext;
 }
 
+bool GpuContextNext::IsTagReached(uint32_t tag)
+{
+    if (m_statusBufferResource == nullptr || m_statusBufferResource->pData == nullptr)
+    {
+        return false;
+    }
+
+    volatile uint32_t completedTag = ((volatile MOS_GPU_STATUS_DATA *)m_statusBufferResource->pData)->GPUTag;
+    return (int32_t)(completedTag - tag) >= 0;
+}
+
+MOS_STATUS GpuContextNext::WaitForTag(uint32_t tag, uint32_t timeoutUs)
+{
+    MOS_OS_CHK_NULL_RETURN(m_statusBufferResource);
+    MOS_OS_CHK_NULL_RETURN(m_statusBufferResource->pData);
+
+    auto statusData = (volatile MOS_GPU_STATUS_DATA *)m_statusBufferResource->pData;
+    if (!MosUtilities::MosWaitForCounter(&statusData->GPUTag, tag, timeoutUs))
+    {
+        return MOS_STATUS_STILL_DRAWING;
+    }
+    return MOS_STATUS_SUCCESS;
+}
@@ -150,6 +150,23 @@ public:
         PMOS_COMMAND_BUFFER cmdBuffer,
         bool                nullRendering) = 0;
 
+    //!
+    //! \brief    Begin a submission batch
+    //! \details  Until EndSubmissionBatch is called, the context may chain
+    //!           compatible command buffers and submit them together
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    virtual MOS_STATUS BeginSubmissionBatch() { return MOS_STATUS_SUCCESS; }
+
+    //!
+    //! \brief    End a submission batch
+    //! \details  Submit all command buffers still pending in the batch
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    virtual MOS_STATUS EndSubmissionBatch() { return MOS_STATUS_SUCCESS; }
+
     //!
     //! \brief    Resizes the buffer to be used for rendering GPU commands
     //! \param    [in] requestedCommandBufferSize
@@ -233,6 +250,27 @@ public:
         return m_statusBufferResource;
     }
 
+    //!
+    //! \brief    Check whether GPU has reached the status tag
+    //! \details  Reads the persistently mapped status buffer, no lock needed
+    //! \param    [in] tag
+    //!           Status tag to check
+    //! \return   bool
+    //!           true if the tag is completed
+    //!
+    bool IsTagReached(uint32_t tag);
+
+    //!
+    //! \brief    Wait until GPU reaches the status tag
+    //! \param    [in] tag
+    //!           Status tag to wait for
+    //! \param    [in] timeoutUs
+    //!           Timeout in us
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if reached, MOS_STATUS_STILL_DRAWING on timeout
+    //!
+    MOS_STATUS WaitForTag(uint32_t tag, uint32_t timeoutUs);
+
     //!
     //! \brief    Get VE attribute buffer for current gpu context
     //! \return   MOS_CMD_BUF_ATTRI_VE*
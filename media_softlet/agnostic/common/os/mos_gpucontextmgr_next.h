@@ -117,7 +117,11 @@ public:
 
     //!
     //! \brief    Determine whether gpu context reuse is needed
-    //! \detail   Implementation to be added after reuse scheme is nailed down
+    //! \detail   Implementation to be added after reuse scheme is nailed down.
+    //!           On Linux a gpu context owns its i915 context(s) with engine map,
+    //!           protection and VM params, its status buffer and per-context sync
+    //!           state, so a reused context would need all of them reset to match
+    //!           the new stream; until then every new context is created fresh.
     //! \return   bool
     //!           True if needed, otherwise false
     //!
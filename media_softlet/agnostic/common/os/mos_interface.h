@@ -577,6 +577,37 @@ public:
         COMMAND_BUFFER_HANDLE cmdBuffer,
         bool nullRendering = false);
 
+    //!
+    //! \brief    Begin Submission Batch
+    //! \details  [Cmd Buffer Interface] Let current GPU context chain the following submissions.
+    //! \details  Caller: HAL only
+    //! \details  Single pipe cmd buffers submitted to current GPU context until EndSubmissionBatch
+    //!           may be chained and executed by one KMD submission. Each cmd buffer keeps its own status report.
+    //! \details  Resources written by a batched cmd buffer must not be synced on before EndSubmissionBatch.
+    //!
+    //! \param    [in] streamState
+    //!           Handle of Os Stream State
+    //!
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    static MOS_STATUS BeginSubmissionBatch(
+        MOS_STREAM_HANDLE streamState);
+
+    //!
+    //! \brief    End Submission Batch
+    //! \details  [Cmd Buffer Interface] Submit cmd buffers chained in current GPU context.
+    //! \details  Caller: HAL only
+    //!
+    //! \param    [in] streamState
+    //!           Handle of Os Stream State
+    //!
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    static MOS_STATUS EndSubmissionBatch(
+        MOS_STREAM_HANDLE streamState);
+
     //!
     //! \brief    Reset Command Buffer
     //! \details  [Cmd Buffer Interface] Reset cmd buffer to the initialized state.
@@ -1672,6 +1703,45 @@ public:
         MOS_STREAM_HANDLE streamState,
         MOS_RESOURCE_HANDLE &resource,
         GPU_CONTEXT_HANDLE gpuContext);
+
+    //!
+    //! \brief   Check whether the GPU status tag has been reached
+    //!
+    //! \param    [in] streamState
+    //!           Handle of Os Stream State
+    //! \param    [in] gpuContext
+    //!           MOS GPU Context handle
+    //! \param    [in] tag
+    //!           Status tag to check
+    //!
+    //! \return   bool
+    //!           true if the GPU has completed the tag
+    //!
+    static bool IsGpuStatusTagReached(
+        MOS_STREAM_HANDLE  streamState,
+        GPU_CONTEXT_HANDLE gpuContext,
+        uint32_t           tag);
+
+    //!
+    //! \brief   Wait for the GPU status tag without locking the status buffer
+    //!
+    //! \param    [in] streamState
+    //!           Handle of Os Stream State
+    //! \param    [in] gpuContext
+    //!           MOS GPU Context handle
+    //! \param    [in] tag
+    //!           Status tag to wait for
+    //! \param    [in] timeoutUs
+    //!           Timeout in us
+    //!
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if reached, MOS_STATUS_STILL_DRAWING on timeout
+    //!
+    static MOS_STATUS WaitForGpuStatusTag(
+        MOS_STREAM_HANDLE  streamState,
+        GPU_CONTEXT_HANDLE gpuContext,
+        uint32_t           tag,
+        uint32_t           timeoutUs);
     
     //!
     //! \brief   Get CP Interface
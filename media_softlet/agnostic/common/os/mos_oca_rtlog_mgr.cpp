@@ -87,8 +87,9 @@ MOS_STATUS MosOcaRtLogSectionMgr::InsertData(MOS_OCA_RTLOG_HEADER header, const
         {
             return MOS_STATUS_NO_SPACE;
         }
-        int32_t heapHandle = AllocHeapHandle()%m_EntryCount;
-        if (heapHandle < m_EntryCount)
+        // Handle wraps past INT32_MAX on long runs, take the modulo unsigned to stay in range.
+        int32_t heapHandle = (int32_t)((uint32_t)AllocHeapHandle() % (uint32_t)m_EntryCount);
+        if (heapHandle >= 0 && heapHandle < m_EntryCount)
         {
             uint8_t *copyAddr = (uint8_t *)m_LockedHeap + m_Offset + heapHandle * MOS_OCA_RTLOG_ENTRY_SIZE;
             MOS_OS_CHK_STATUS_RETURN(MOS_SecureMemcpy(copyAddr, sizeof(MOS_OCA_RTLOG_HEADER), &header, sizeof(MOS_OCA_RTLOG_HEADER)));
@@ -181,14 +182,15 @@ MOS_STATUS MosOcaRTLogMgr::RegisterRes(OsContextNext *osDriverContext, MOS_OCA_R
 void MosOcaRTLogMgr::UnregisterRes(OsContextNext *osDriverContext)
 {
     MOS_OCA_RTLOG_RES_AND_INTERFACE resInterface = {};
+    s_ocaMutex.Lock();
     auto iter = m_resMap.find(osDriverContext);
     if (iter == m_resMap.end())
     {
+        s_ocaMutex.Unlock();
         return;
     }
     resInterface = iter->second;
-    s_ocaMutex.Lock();
-    m_resMap.erase(osDriverContext);
+    m_resMap.erase(iter);
     s_ocaMutex.Unlock();
     resInterface.osInterface->pfnFreeResource(resInterface.osInterface, resInterface.ocaRTLogResource);
     MOS_SafeFreeMemory(resInterface.ocaRTLogResource);
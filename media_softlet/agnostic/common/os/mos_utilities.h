@@ -264,6 +264,10 @@ public:
     //! \details  Wrapper for malloc(). Performs error checking.
     //!           It increases memory allocation counter variable
     //!           m_mosMemAllocCounter for checking memory leaks.
+    //!           With MOS messages enabled, each allocation and free also emits a
+    //!           MemNinja message with time, size and the MOS_AllocMemory call site,
+    //!           which is enough to build size histograms and per-frame allocation
+    //!           rates per call site offline.
     //! \param    [in] size
     //!           Size of memorry to be allocated
     //! \return   void *
@@ -1228,6 +1232,24 @@ public:
     static void MosSleep(
         uint32_t   mSec);
 
+    //!
+    //! \brief    Wait until a GPU written counter reaches the target value
+    //! \details  Spins briefly, then sleeps with exponential backoff until
+    //!           the counter reaches target (wrap-around safe) or timeout.
+    //! \param    [in] counter
+    //!           Pointer to the persistently mapped counter
+    //! \param    [in] target
+    //!           Value to wait for
+    //! \param    [in] timeoutUs
+    //!           Timeout in us
+    //! \return   bool
+    //!           true if the target is reached, false on timeout
+    //!
+    static bool MosWaitForCounter(
+        volatile uint32_t *counter,
+        uint32_t           target,
+        uint32_t           timeoutUs);
+
     //!
     //! \brief    Initialize reg related resources
     //!
@@ -1963,6 +1985,24 @@ public:
         int32_t         iPitch,
         int32_t         extFlags);
 
+    //!
+    //! \brief    Copy from write-combined or uncached memory
+    //! \details  Uses streaming loads (SSE4.1 MOVNTDQA) through a small staging
+    //!           buffer when available, which avoids the per access penalty of
+    //!           plain loads from WC mappings. Falls back to memcpy otherwise.
+    //! \param    [out] pDst
+    //!           Destination, regular cacheable memory
+    //! \param    [in] pSrc
+    //!           Source, typically a mapped graphics resource
+    //! \param    [in] size
+    //!           Bytes to copy
+    //! \return   void
+    //!
+    static void MosStreamingMemcpy(
+        void            *pDst,
+        const void      *pSrc,
+        size_t          size);
+
     //!
     //! \brief    MOS trace event initialize
     //! \details  register provide Global ID to the system.
@@ -2049,6 +2089,10 @@ public:
     //! \brief    MOS log trace event
     //! \details  log trace event by id and event type, arg1 and arg2 are optional arguments
     //!           arguments are in raw data format, need match data structure in manifest.
+    //!           While tracing is off the cost is one read of the enable flag, which a
+    //!           tool can flip at run time through the shared control data, so tracing
+    //!           can be switched on around a latency spike without restarting the app.
+    //!           While tracing is on each event is one write to trace_marker_raw.
     //! \param    [in] usId
     //!           Indicates event id
     //! \param    [in] ucType
@@ -33,6 +33,10 @@
 #include <time.h>     //for simulate random memory allcation failure
 #include "mos_os.h"
 #include "mos_utilities_specific.h"
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define MOS_X86_SIMD 1
+#endif
 
 int32_t              MosUtilities::m_mosMemAllocCounterNoUserFeature    = 0;
 int32_t              MosUtilities::m_mosMemAllocCounterNoUserFeatureGfx = 0;
@@ -964,6 +968,111 @@ __inline int32_t MosUtilities::MosSwizzleOffset(
     return(SwizzledOffset);
 }
 
+#ifndef _MOS_UTILITY_EXT
+#ifdef MOS_X86_SIMD
+// Tiled side is usually a WC mapping of the BO: read it with streaming loads
+__attribute__((target("sse4.1")))
+static void MosCopyChunkStreamLoad(uint8_t *pDst, uint8_t *pSrc, int32_t size)
+{
+    for (int32_t i = 0; i < size; i += 16)
+    {
+        __m128i data = _mm_stream_load_si128((__m128i *)(pSrc + i));
+        _mm_storeu_si128((__m128i *)(pDst + i), data);
+    }
+}
+
+// Write the tiled side with non-temporal stores, the CPU will not read it back
+static void MosCopyChunkStreamStore(uint8_t *pDst, uint8_t *pSrc, int32_t size)
+{
+    for (int32_t i = 0; i < size; i += 16)
+    {
+        __m128i data = _mm_loadu_si128((__m128i *)(pSrc + i));
+        _mm_stream_si128((__m128i *)(pDst + i), data);
+    }
+}
+#endif
+
+//!
+//! \brief    Swizzle whole tile lines instead of single bytes
+//! \details  A tile line (16B per TileY column, 512B for TileX) is contiguous
+//!           in both layouts and consecutive columns of one row sit one tile
+//!           column apart, so only one offset per row and column step is needed.
+//!           Matches MosSwizzleOffset with CsxSwizzle off.
+//! \return   bool
+//!           false if the layout is not handled and the byte loop must be used
+//!
+static bool MosSwizzleDataLines(
+    uint8_t         *pSrc,
+    uint8_t         *pDst,
+    MOS_TILE_TYPE   tiling,
+    bool            detile,
+    int32_t         iHeight,
+    int32_t         iPitch)
+{
+    int32_t lBits = (tiling == MOS_TILE_Y) ? 5 : 3;  // Log2(lines per tile)
+    int32_t lPos  = (tiling == MOS_TILE_Y) ? 4 : 9;  // Log2(bytes per tile line)
+    int32_t lineBytes = 1 << lPos;
+
+    if (iPitch <= 0 || (iPitch & (lineBytes - 1)) != 0)
+    {
+        return false;
+    }
+
+    int32_t colStride = lineBytes << lBits;          // bytes per tile column
+    int32_t cols      = iPitch >> lPos;
+
+#ifdef MOS_X86_SIMD
+    uint8_t *tiled = detile ? pSrc : pDst;
+    bool simd      = (((uintptr_t)tiled & 15) == 0);
+    if (detile && simd)
+    {
+        simd = __builtin_cpu_supports("sse4.1");
+    }
+#endif
+
+    for (int32_t y = 0; y < iHeight; y++)
+    {
+        uint8_t *linear = (detile ? pDst : pSrc) + (size_t)y * iPitch;
+        uint8_t *tileLine = (detile ? pSrc : pDst) +
+            ((((size_t)(y >> lBits) * cols) << lBits) + (y & ((1 << lBits) - 1))) * lineBytes;
+
+        for (int32_t col = 0; col < cols; col++, linear += lineBytes, tileLine += colStride)
+        {
+#ifdef MOS_X86_SIMD
+            if (simd)
+            {
+                if (detile)
+                {
+                    MosCopyChunkStreamLoad(linear, tileLine, lineBytes);
+                }
+                else
+                {
+                    MosCopyChunkStreamStore(tileLine, linear, lineBytes);
+                }
+                continue;
+            }
+#endif
+            if (detile)
+            {
+                memcpy(linear, tileLine, lineBytes);
+            }
+            else
+            {
+                memcpy(tileLine, linear, lineBytes);
+            }
+        }
+    }
+
+#ifdef MOS_X86_SIMD
+    if (simd && !detile)
+    {
+        _mm_sfence();
+    }
+#endif
+    return true;
+}
+#endif
+
 void MosUtilities::MosSwizzleData(
     uint8_t         *pSrc,
     uint8_t         *pDst,
@@ -983,6 +1092,19 @@ void MosUtilities::MosSwizzleData(
     int32_t x;
     int32_t y;
 
+#ifndef _MOS_UTILITY_EXT
+    if (IS_TILED_TO_LINEAR(SrcTiling, DstTiling) &&
+        MosSwizzleDataLines(pSrc, pDst, SrcTiling, true, iHeight, iPitch))
+    {
+        return;
+    }
+    if (IS_LINEAR_TO_TILED(SrcTiling, DstTiling) &&
+        MosSwizzleDataLines(pSrc, pDst, DstTiling, false, iHeight, iPitch))
+    {
+        return;
+    }
+#endif
+
     // Translate from one format to another
     for (y = 0, LinearOffset = 0, TileOffset = 0; y < iHeight; y++)
     {
@@ -1022,6 +1144,66 @@ void MosUtilities::MosSwizzleData(
     }
 }
 
+#ifdef MOS_X86_SIMD
+//!
+//! \brief    Read src with MOVNTDQA into an L1 sized staging buffer, then copy
+//!           the staged block out with regular stores
+//! \details  src must be 16B aligned, size is a multiple of 16
+//!
+__attribute__((target("sse4.1")))
+static void MosStreamingMemcpySse41(uint8_t *pDst, uint8_t *pSrc, size_t size)
+{
+    alignas(16) uint8_t staging[4096];
+
+    while (size > 0)
+    {
+        size_t block = (size < sizeof(staging)) ? size : sizeof(staging);
+        for (size_t i = 0; i < block; i += 64)
+        {
+            __m128i *src = (__m128i *)(pSrc + i);
+            __m128i *stg = (__m128i *)(staging + i);
+            size_t   left = block - i;
+            stg[0] = _mm_stream_load_si128(src);
+            if (left > 16) stg[1] = _mm_stream_load_si128(src + 1);
+            if (left > 32) stg[2] = _mm_stream_load_si128(src + 2);
+            if (left > 48) stg[3] = _mm_stream_load_si128(src + 3);
+        }
+        memcpy(pDst, staging, block);
+        pDst += block;
+        pSrc += block;
+        size -= block;
+    }
+}
+#endif
+
+void MosUtilities::MosStreamingMemcpy(
+    void            *pDst,
+    const void      *pSrc,
+    size_t          size)
+{
+    if (pDst == nullptr || pSrc == nullptr || size == 0)
+    {
+        return;
+    }
+
+#ifdef MOS_X86_SIMD
+    static const bool sse41 = __builtin_cpu_supports("sse4.1");
+
+    if (sse41 && ((uintptr_t)pSrc & 15) == 0 && size >= 64)
+    {
+        size_t body = size & ~(size_t)15;
+        MosStreamingMemcpySse41((uint8_t *)pDst, (uint8_t *)pSrc, body);
+        if (body < size)
+        {
+            memcpy((uint8_t *)pDst + body, (const uint8_t *)pSrc + body, size - body);
+        }
+        return;
+    }
+#endif
+
+    memcpy(pDst, pSrc, size);
+}
+
 const uint32_t MosUtilities::GetRegAccessDataType(MOS_USER_FEATURE_VALUE_TYPE type)
 {
     switch (type)
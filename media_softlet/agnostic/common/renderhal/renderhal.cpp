@@ -6360,7 +6360,10 @@ MOS_STATUS RenderHal_SetSamplerStates(
 
 //!
 //! \brief    Setup Surface State
-//! \details  Setup Surface States
+//! \details  Setup Surface States. Surface states are rebuilt in the SSH for every
+//!           dispatch and reached through the binding table; the gen kernels (FC, CM,
+//!           kernel free VP) address surfaces by binding table index, so there is no
+//!           bindless path with persistent surface state slots here.
 //! \param    PRENDERHAL_INTERFACE pRenderHal
 //!           [in] Pointer to Hardware Interface Structure
 //! \param    PRENDERHAL_SURFACE pRenderHalSurface
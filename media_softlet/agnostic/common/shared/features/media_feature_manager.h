@@ -34,6 +34,7 @@
 #include <map>
 #include <memory>
 #include <utility>
+#include <typeindex>
 #include "media_user_setting.h"
 #include "media_utils.h"
 #include "mos_defs.h"
@@ -108,6 +109,40 @@ enum class LIST_TYPE
     ALLOW_LIST,
 };
 
+//!
+//! \brief  Per setting interface list of the features implementing it, built
+//!         on first use so SETPAR does not dynamic_cast every feature for
+//!         every command.
+//!
+class MediaFeatureSettingCache
+{
+public:
+    template <typename T, typename Container>
+    const std::vector<const T *> &Get(const Container &features)
+    {
+        auto &entry = m_settings[std::type_index(typeid(T))];
+        if (entry == nullptr)
+        {
+            auto list = std::make_shared<std::vector<const T *>>();
+            for (const auto &e : features)
+            {
+                auto p = dynamic_cast<const T *>(e.second);
+                if (p)
+                {
+                    list->push_back(p);
+                }
+            }
+            entry = list;
+        }
+        return *std::static_pointer_cast<std::vector<const T *>>(entry);
+    }
+
+    void Clear() { m_settings.clear(); }
+
+private:
+    std::map<std::type_index, std::shared_ptr<void>> m_settings;
+};
+
 class MediaFeatureManager  // for pipe line use
 {
 protected:
@@ -143,8 +178,18 @@ public:
             return iter->second;
         }
 
+        //!
+        //! \brief  Get the features implementing setting interface T, in feature ID order
+        //!
+        template <typename T>
+        const std::vector<const T *> &GetSettingFeatures()
+        {
+            return m_settingCache.template Get<T>(m_features);
+        }
+
     private:
-        container_t m_features;
+        container_t              m_features;
+        MediaFeatureSettingCache m_settingCache;
     };
 
 public:
@@ -250,6 +295,16 @@ public:
     //! \return uint8_t
     //!         actual pass number after feature check
     //!
+
+    //!
+    //! \brief  Get the features implementing setting interface T, in feature ID order
+    //!
+    template <typename T>
+    const std::vector<const T *> &GetSettingFeatures()
+    {
+        return m_settingCache.template Get<T>(m_features);
+    }
+
     uint8_t GetNumPass() { return m_passNum; };
     MediaFeatureConstSettings *GetFeatureSettings() { return m_featureConstSettings; };
     //!
@@ -287,6 +342,7 @@ protected:
     uint8_t GetTargetUsage(){return m_targetUsage;}
 
     container_t m_features;
+    MediaFeatureSettingCache m_settingCache;
     std::map<int, std::vector<int>> m_packetIdList;  // map feature ID to a vector of packet ID
     std::map<int, LIST_TYPE> m_packetIdListTypes;  // map feature ID to a flag, indicates whether packet ID vector is a block list or an allow list
     MediaFeatureConstSettings *m_featureConstSettings = nullptr;
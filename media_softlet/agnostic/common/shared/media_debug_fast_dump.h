@@ -36,6 +36,10 @@
 #include "media_debug_serializer.h"
 #include "media_copy.h"
 
+// Dump() only queues a GPU copy (MediaCopy) of the resource into a pooled staging
+// resource and returns; locking and file/trace writing run on the scheduler thread.
+// With allowDataLoss, a dump is discarded rather than waited on when no staging
+// resource is free, so the submitting thread is not throttled by dump I/O.
 class MediaDebugFastDump
 {
 public:
@@ -140,6 +140,7 @@ struct VDBOX_SFC_PARAMS
     {
         PMOS_SURFACE                surface;
         PMOS_BUFFER                 histogramBuf;       //!< Histogram output buffer
+        uint32_t                    histogramOffset;    //!< Histogram output offset in histogramBuf
         MEDIA_CSPACE                colorSpace;         //!< Color Space
         uint32_t                    chromaSiting;       //!< ChromaSiting
         RECT                        rcDst;              //!< rectangle on output surface after scaling.
@@ -189,7 +189,7 @@ MOS_STATUS MediaVdboxSfcRender::SetRotMirParams(VDBOX_SFC_PARAMS &sfcParam, VP_E
 
 MOS_STATUS MediaVdboxSfcRender::SetHistogramParams(VDBOX_SFC_PARAMS& sfcParam)
 {
-    return m_sfcRender->SetHistogramBuf(sfcParam.output.histogramBuf);
+    return m_sfcRender->SetHistogramBuf(sfcParam.output.histogramBuf, sfcParam.output.histogramOffset);
 }
 
 MOS_STATUS MediaVdboxSfcRender::AddSfcStates(MOS_COMMAND_BUFFER *cmdBuffer, VDBOX_SFC_PARAMS &sfcParam)
@@ -79,6 +79,11 @@ public:
 
     //!
     //! \brief  Interface to pipeline to switch media context and get corresponding scalabilityState for programming
+    //! \details Switching only selects the GPU context; it inserts no waits or semaphores.
+    //!          On Linux, ordering between engines comes from kernel implicit fencing on the
+    //!          BOs each packet registers (MosInterface::ResourceSyncCallback is a no-op), so
+    //!          packets on different engines only serialize when they share a resource and
+    //!          one of them writes it. Work from independent streams already overlaps.
     //! \param  [in] func
     //!         Indicate the media function of the context to switch
     //! \param  [in] requirement
@@ -254,6 +254,10 @@ MOS_STATUS MediaCopyBaseState::SurfaceCopy(PMOS_RESOURCE src, PMOS_RESOURCE dst,
 
     CopyEnigneSelect(preferMethod, mcpyEngine, mcpyEngineCaps);
 
+    MT_LOG3(MT_MEDIA_COPY, MT_NORMAL, MT_MEDIA_COPY_METHOD, preferMethod, MT_MEDIA_COPY_CAPS,
+        (mcpyEngineCaps.engineVebox | (mcpyEngineCaps.engineBlt << 1) | (mcpyEngineCaps.engineRender << 2)),
+        MT_MEDIA_COPY_ENGINE, mcpyEngine);
+
     MCPY_CHK_STATUS_RETURN(TaskDispatch(mcpySrc, mcpyDst, mcpyEngine));
 
     return eStatus;
@@ -121,7 +121,10 @@ public:
 
     //!
     //! \brief    Media memory decompression
-    //! \details  Entry point to decompress media memory
+    //! \details  Entry point to decompress media memory. The in place resolve always
+    //!           covers the whole surface: VEBOX tile convert takes the full surface
+    //!           state, and a partly resolved surface would leave the aux state of
+    //!           the resource inconsistent for later GPU reads.
     //! \param    [in] targetResource
     //!            The surface will be decompressed
     //!
@@ -56,13 +56,9 @@ namespace mhw{namespace mi{class Itf;}}  // namespace mhw
     }                                                                                   \
     if (m_featureManager)                                                               \
     {                                                                                   \
-        for (auto feature : *m_featureManager)                                          \
+        for (auto feature : m_featureManager->template GetSettingFeatures<setting_t>()) \
         {                                                                               \
-            p = dynamic_cast<const setting_t *>(feature);                               \
-            if (p)                                                                      \
-            {                                                                           \
-                MHW_CHK_STATUS_RETURN(p->MHW_SETPAR_F(CMD)(par));                       \
-            }                                                                           \
+            MHW_CHK_STATUS_RETURN(feature->MHW_SETPAR_F(CMD)(par));                     \
         }                                                                               \
     }
 
@@ -210,6 +206,11 @@ protected:
 
     //!
     //! \brief  Start Status Report - Refactor Version
+    //! \details With profiling and markers off, the per frame status cost is this start
+    //!          SDI, the end tag written by EndStatusReportNext() and the codec's own
+    //!          MMIO status reads (error, CRC, MB count), which back the decode error
+    //!          and CRC values reported through the DDI; MediaPerfProfiler and
+    //!          DecodeMarkerPkt emit nothing unless enabled.
     //! \param  [in] srType
     //!         status report type for send cmds
     //! \param  [in, out] cmdBuffer
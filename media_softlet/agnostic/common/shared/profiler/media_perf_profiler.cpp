@@ -270,6 +270,13 @@ MOS_STATUS MediaPerfProfiler::Initialize(void* context, MOS_INTERFACE *osInterfa
         return status;
     }
 
+    // Read whether to also write a Chrome trace JSON next to the binary dump
+    ReadUserSetting(
+            userSettingPtr,
+            m_outputTraceJson,
+            __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_OUTPUT_TRACE_JSON,
+            MediaUserSetting::Group::Device);
+
     // Read buffer size
     ReadUserSetting(
             userSettingPtr,
@@ -658,21 +665,27 @@ MOS_STATUS MediaPerfProfiler::SavePerfData(MOS_INTERFACE *osInterface)
 
         CHK_NULL_RETURN(pData);
 
+        char outputFileName[MOS_MAX_PATH_LENGTH + 1];
+
         if (m_multiprocess)
         {
             int32_t pid = MosUtilities::MosGetPid();
             tm      localtime = { 0 };
             MosUtilities::MosGetLocalTime(&localtime);
-            char outputFileName[MOS_MAX_PATH_LENGTH + 1];
 
             MOS_SecureStringPrint(outputFileName, MOS_MAX_PATH_LENGTH + 1, MOS_MAX_PATH_LENGTH + 1, "%s-pid%d-context%p-%04d%02d%02d%02d%02d%02d.bin",
                 m_outputFileName.c_str(), pid, pOsContext, localtime.tm_year + 1900, localtime.tm_mon + 1, localtime.tm_mday, localtime.tm_hour, localtime.tm_min, localtime.tm_sec);
-
-            MosUtilities::MosWriteFileFromPtr(outputFileName, pData, BASE_OF_NODE(m_perfDataIndexMap[pOsContext]));
         }
         else
         {
-            MosUtilities::MosWriteFileFromPtr(m_outputFileName.c_str(), pData, BASE_OF_NODE(m_perfDataIndexMap[pOsContext]));
+            MOS_SecureStringPrint(outputFileName, MOS_MAX_PATH_LENGTH + 1, MOS_MAX_PATH_LENGTH + 1, "%s", m_outputFileName.c_str());
+        }
+
+        MosUtilities::MosWriteFileFromPtr(outputFileName, pData, BASE_OF_NODE(m_perfDataIndexMap[pOsContext]));
+
+        if (m_outputTraceJson)
+        {
+            SavePerfDataAsTraceJson(pData, m_perfDataIndexMap[pOsContext], outputFileName);
         }
 
         osInterface->pfnUnlockResource(
@@ -683,6 +696,74 @@ MOS_STATUS MediaPerfProfiler::SavePerfData(MOS_INTERFACE *osInterface)
     return status;
 }
 
+MOS_STATUS MediaPerfProfiler::SavePerfDataAsTraceJson(uint8_t *pData, uint32_t nodeCount, const char *binFileName)
+{
+    CHK_NULL_RETURN(pData);
+    CHK_NULL_RETURN(binFileName);
+
+    if (m_timerBase == 0)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    // Chrome trace event format, one complete ("X") event per perf node on a
+    // GPU timestamp timeline, one track per engine.
+    std::string trace = "{\"traceEvents\":[";
+    char        event[LOCAL_STRING_SIZE * 8];
+    bool        first = true;
+
+    for (uint32_t i = 0; i < nodeCount; i++)
+    {
+        PerfEntry *entry = (PerfEntry *)(pData + BASE_OF_NODE(i));
+        if (entry->endTimeClockValue <= entry->beginTimeClockValue)
+        {
+            // Node not completed by HW
+            continue;
+        }
+
+        double   beginUs    = (double)entry->beginTimeClockValue * 1000000.0 / m_timerBase;
+        double   durationUs = (double)(entry->endTimeClockValue - entry->beginTimeClockValue) * 1000000.0 / m_timerBase;
+        uint64_t cpuTimeUs  = ((uint64_t)entry->beginCpuTime[1] << 32) | entry->beginCpuTime[0];
+
+        MOS_SecureStringPrint(event, sizeof(event), sizeof(event),
+            "%s{\"name\":\"0x%04x\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%u,\"tid\":%u,"
+            "\"args\":{\"perfTag\":%u,\"frame\":%u,\"cpuSubmitUs\":%llu",
+            first ? "" : ",",
+            entry->perfTag & 0xffff,
+            beginUs,
+            durationUs,
+            entry->processId,
+            entry->engineTag,
+            entry->perfTag & 0xffff,
+            entry->perfTag >> 16,
+            (unsigned long long)cpuTimeUs);
+        trace += event;
+
+        // Delta of each configured register (e.g. a busy or bandwidth
+        // counter) across the packet
+        for (int8_t regIndex = 0; regIndex < 8; regIndex++)
+        {
+            if (m_registers[regIndex] != 0)
+            {
+                MOS_SecureStringPrint(event, sizeof(event), sizeof(event),
+                    ",\"reg0x%x\":%u",
+                    m_registers[regIndex],
+                    entry->endRegisterValue[regIndex] - entry->beginRegisterValue[regIndex]);
+                trace += event;
+            }
+        }
+
+        trace += "}}";
+        first = false;
+    }
+    trace += "]}";
+
+    char jsonFileName[MOS_MAX_PATH_LENGTH + 1];
+    MOS_SecureStringPrint(jsonFileName, MOS_MAX_PATH_LENGTH + 1, MOS_MAX_PATH_LENGTH + 1, "%s.json", binFileName);
+
+    return MosUtilities::MosWriteFileFromPtr(jsonFileName, (void *)trace.c_str(), (uint32_t)trace.size());
+}
+
 PerfGPUNode MediaPerfProfiler::GpuContextToGpuNode(MOS_GPU_CONTEXT context)
 {
     PerfGPUNode node = PERF_GPU_NODE_UNKNOW;
@@ -251,6 +251,26 @@ private:
     //!
     MOS_STATUS SavePerfData(MOS_INTERFACE *osInterface);
 
+    //!
+    //! \brief    Write the perf nodes as a Chrome trace event JSON file
+    //! \details  Events are placed on the GPU timestamp timeline converted with
+    //!           the timestamp frequency, one track per engine, so the overlap of
+    //!           engines and streams can be viewed in chrome://tracing or Perfetto.
+    //!           The begin/end delta of each configured register is added to the
+    //!           event args, attributing those counters to the packet.
+    //!
+    //! \param    [in] pData
+    //!           Locked perf store buffer
+    //! \param    [in] nodeCount
+    //!           Number of perf nodes in the buffer
+    //! \param    [in] binFileName
+    //!           Name of the binary dump, ".json" is appended
+    //!
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS SavePerfDataAsTraceJson(uint8_t *pData, uint32_t nodeCount, const char *binFileName);
+
     //!
     //! \brief    Convert GPU context to GPU node
     //!
@@ -516,6 +536,7 @@ private:
     uint32_t                      m_bufferSize = 10000000; //!< The size of perf data buffer
     uint32_t                      m_timerBase  = 0;        //!< time frequency
     int32_t                       m_multiprocess = 0;      //!< multi process support
+    int32_t                       m_outputTraceJson = 0;   //!< also dump Chrome trace JSON
     uint32_t                      m_registers[8] = { 0 };  //!< registers of Memory information
     const std::string             m_registersKey[8] = {__MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_REGISTER_KEY_1,
                                                        __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_REGISTER_KEY_2,
@@ -27,6 +27,7 @@
 //!
 #include <algorithm>
 #include "media_status_report.h"
+#include "mos_utilities.h"
 
 MOS_STATUS MediaStatusReport::GetAddress(uint32_t statusReportType, PMOS_RESOURCE &osResource, uint32_t &offset)
 {
@@ -89,6 +90,21 @@ MOS_STATUS MediaStatusReport::GetReport(uint16_t requireNum, void *status)
     return eStatus;
 }
 
+MOS_STATUS MediaStatusReport::WaitForCompletedCount(uint32_t count, uint32_t timeoutUs)
+{
+    if (m_completedCount == nullptr)
+    {
+        return MOS_STATUS_NULL_POINTER;
+    }
+
+    if (!MosUtilities::MosWaitForCounter(m_completedCount, count, timeoutUs))
+    {
+        return MOS_STATUS_STILL_DRAWING;
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
 MOS_STATUS MediaStatusReport::RegistObserver(MediaStatusReportObserver *observer)
 {
     MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
@@ -127,6 +127,18 @@ public:
         return (*m_completedCount); 
     }
 
+    //!
+    //! \brief  Wait until completed count reaches the specified count.
+    //! \details Polls the mapped completed count buffer, no lock needed.
+    //! \param  [in] count
+    //!         Completed count to wait for
+    //! \param  [in] timeoutUs
+    //!         Timeout in us
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if reached, MOS_STATUS_STILL_DRAWING on timeout
+    //!
+    MOS_STATUS WaitForCompletedCount(uint32_t count, uint32_t timeoutUs);
+
     //!
     //! \brief  Get reported count of status report.
     //! \return m_reportedCount
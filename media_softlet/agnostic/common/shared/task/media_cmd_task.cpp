@@ -107,6 +107,10 @@ MOS_STATUS CmdTask::Submit(bool immediateSubmit, MediaScalability *scalability,
         uint8_t packetPhase = MediaPacket::otherPacket;
         MEDIA_CHK_NULL_RETURN(packet);
 
+        // Prepare has to stay in this loop. ActivatePacket queues the same packet
+        // object once per pass/pipe, and Prepare reads the pass/pipe state just set
+        // by UpdateState and rewrites the packet's members, so running the calls
+        // ahead of time or concurrently would make them race on that object.
         MEDIA_CHK_STATUS_RETURN(packet->Prepare());
 
         MEDIA_CHK_STATUS_RETURN(scalability->GetCmdBuffer(&cmdBuffer, prop.frameTrackingRequested));
@@ -129,6 +133,14 @@ MOS_STATUS CmdTask::Submit(bool immediateSubmit, MediaScalability *scalability,
         MEDIA_CHK_STATUS_RETURN(scalability->ReturnCmdBuffer(&cmdBuffer));
     }
 
+    if (!immediateSubmit)
+    {
+        // Commands stay in the current command buffer and go out with the next
+        // immediate submission on this context.
+        m_packets.clear();
+        return MOS_STATUS_SUCCESS;
+    }
+
 #if (_DEBUG || _RELEASE_INTERNAL) && !EMUL
     MEDIA_CHK_STATUS_RETURN(DumpCmdBufferAllPipes(&cmdBuffer, debugInterface, scalability));
 #endif  // _DEBUG || _RELEASE_INTERNAL
@@ -556,6 +556,8 @@ MOS_STATUS VpResourceManager::PrepareFcIntermediateSurface(SwFilterPipe &feature
             // Get surface parameter.
             // Use A8R8G8B8 instead of real surface format to ensure the surface can be reused for both AYUV and A8R8G8B8,
             // since for A8R8G8B8, tile64 is used, while for AYUV, both tile4 and tile64 is ok.
+            // Keep MMC disabled for the same reason: the render compression format follows the surface format, and
+            // the format is switched below without reallocation.
             if (m_fcIntermediateSurface[i] && m_fcIntermediateSurface[i]->osSurface)
             {
                 m_fcIntermediateSurface[i]->osSurface->Format = Format_A8R8G8B8;
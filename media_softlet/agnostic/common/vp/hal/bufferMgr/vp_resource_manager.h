@@ -335,6 +335,13 @@ struct VP_FRAME_IDS
 };
 struct VP_SURFACE_PARAMS;
 
+//!
+//! \brief  Owns the intermediate and history surfaces of one VP instance
+//! \details Reusing one resource set does not make the CPU wait for the previous frame:
+//!          all packets of the instance go to the same GPU context, which executes them
+//!          in submission order, so several frames can be queued against the same set.
+//!          Only CPU reads, such as HVS statistics, synchronize with the GPU.
+//!
 class VpResourceManager
 {
 public:
@@ -342,6 +349,13 @@ public:
     virtual ~VpResourceManager();
     virtual MOS_STATUS OnNewFrameProcessStart(SwFilterPipe &pipe);
     virtual void OnNewFrameProcessEnd();
+    //!
+    //! \brief    Allocate or grow the FC ping-pong surfaces of this instance
+    //! \details  Only called by policy when layer selection splits composition into
+    //!           multiple passes, so single pass instances never hold intermediates.
+    //!           Surfaces belong to this VpResourceManager and are not shared between
+    //!           VP contexts, whose GPU timelines are not synchronized with each other.
+    //!
     MOS_STATUS PrepareFcIntermediateSurface(SwFilterPipe &featurePipe);
     MOS_STATUS GetResourceHint(std::vector<FeatureType> &featurePool, SwFilterPipe& executedFilters, RESOURCE_ASSIGNMENT_HINT &hint);
     MOS_STATUS AssignExecuteResource(std::vector<FeatureType> &featurePool, VP_EXECUTE_CAPS& caps, SwFilterPipe &executedFilters);
@@ -430,6 +444,8 @@ protected:
     virtual Mos_MemPool GetHistStatMemType(VP_EXECUTE_CAPS &caps);
     MOS_STATUS ReAllocateVeboxOutputSurface(VP_EXECUTE_CAPS& caps, VP_SURFACE *inputSurface, VP_SURFACE *outputSurface, bool &allocated);
     MOS_STATUS ReAllocateVeboxDenoiseOutputSurface(VP_EXECUTE_CAPS& caps, VP_SURFACE *inputSurface, bool &allocated);
+    // STMM history is only reallocated and reset when the input size or memory type changes,
+    // so restarting a stream of the same resolution on this instance keeps the history.
     MOS_STATUS ReAllocateVeboxSTMMSurface(VP_EXECUTE_CAPS& caps, VP_SURFACE *inputSurface, bool &allocated);
     void DestoryVeboxOutputSurface();
     void DestoryVeboxDenoiseOutputSurface();
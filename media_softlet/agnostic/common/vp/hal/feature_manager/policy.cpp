@@ -1028,10 +1028,6 @@ MOS_STATUS Policy::GetScalingExecutionCaps(SwFilter *feature, bool isHdrEnabled)
     SwFilterScaling* scaling = (SwFilterScaling*)feature;
     FeatureParamScaling *scalingParams = &scaling->GetSwFilterParams();
     VP_EngineEntry *scalingEngine      = &scaling->GetFilterEngineCaps();
-    bool isAlphaSettingSupportedBySfc =
-        IsAlphaSettingSupportedBySfc(scalingParams->formatInput, scalingParams->formatOutput, scalingParams->pCompAlpha);
-    bool isAlphaSettingSupportedByVebox =
-        IsAlphaSettingSupportedByVebox(scalingParams->formatInput, scalingParams->formatOutput, scalingParams->pCompAlpha);
 
     // Clean usedForNextPass flag.
     if (scalingEngine->usedForNextPass)
@@ -1046,6 +1042,11 @@ MOS_STATUS Policy::GetScalingExecutionCaps(SwFilter *feature, bool isHdrEnabled)
         return MOS_STATUS_SUCCESS;
     }
 
+    bool isAlphaSettingSupportedBySfc =
+        IsAlphaSettingSupportedBySfc(scalingParams->formatInput, scalingParams->formatOutput, scalingParams->pCompAlpha);
+    bool isAlphaSettingSupportedByVebox =
+        IsAlphaSettingSupportedByVebox(scalingParams->formatInput, scalingParams->formatOutput, scalingParams->pCompAlpha);
+
     // For AVS sampler not enabled case, HQ/Fast scaling should go to SFC.
     // And Ief should only be done by SFC.
     if (!m_hwCaps.m_rules.isAvsSamplerSupported &&
@@ -1489,6 +1490,8 @@ MOS_STATUS Policy::GetDenoiseExecutionCaps(SwFilter* feature)
     {
         if (denoiseParams.denoiseParams.bEnableHVSDenoise)
         {
+            // HVS kernel runs every frame: besides QP/strength/mode it consumes the global and
+            // spatial noise statistics of the previous VEBOX pass, so its output is not stable.
             denoiseParams.stage      = DN_STAGE_HVS_KERNEL;
             denoiseEngine.bEnabled   = 1;
             denoiseEngine.isolated   = 1;
@@ -1817,6 +1820,8 @@ MOS_STATUS Policy::GetHdrExecutionCaps(SwFilter *feature)
 
     if (Is3DLutKernelSupported())
     {
+        // The generated 3DLUT is kept in a single vebox LUT surface and only regenerated when
+        // the tone mapping key changes, so repeated per frame HDR metadata costs no dispatch.
         if (hdrParams->uiMaxContentLevelLum != m_savedMaxCLL || hdrParams->uiMaxDisplayLum != m_savedMaxDLL ||
             hdrParams->hdrMode != m_savedHdrMode)
         {
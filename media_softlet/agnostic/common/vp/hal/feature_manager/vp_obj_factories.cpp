@@ -188,7 +188,7 @@ int SwFilterPipeFactory::GetPipeCountForProcessing(VP_PIPELINE_PARAMS &params)
 
     int pipeCnt = 1;
     int featureCnt = 0;
-    auto featureHander = *m_vpInterface.GetSwFilterHandlerMap();
+    auto &featureHander = *m_vpInterface.GetSwFilterHandlerMap();
     for (auto &handler : featureHander)
     {
         int cnt = handler.second->GetPipeCountForProcessing(params);
@@ -210,7 +210,7 @@ MOS_STATUS SwFilterPipeFactory::Update(VP_PIPELINE_PARAMS &params, int index)
 {
     VP_FUNC_CALL();
 
-    auto featureHander = *m_vpInterface.GetSwFilterHandlerMap();
+    auto &featureHander = *m_vpInterface.GetSwFilterHandlerMap();
     for (auto &handler : featureHander)
     {
         VP_PUBLIC_CHK_STATUS_RETURN(handler.second->UpdateParamsForProcessing(params, index));
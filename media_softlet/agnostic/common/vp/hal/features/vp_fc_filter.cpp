@@ -200,6 +200,8 @@ MOS_STATUS VpFcFilter::InitCompParams(VP_COMPOSITE_PARAMS &compParams, SwFilterP
     compParams.targetCount = 1;
     VP_RENDER_CHK_STATUS_RETURN(InitLayer(compParams.target[0], false, 0, executedPipe, defaultScalingMode));
 
+    // Color fill is done by the composition kernel itself while it writes each target block,
+    // so background pixels cost no extra pass or engine.
     SwFilterColorFill *colorFill        = dynamic_cast<SwFilterColorFill *>(executedPipe.GetSwFilter(false, 0, FeatureType::FeatureTypeColorFill));
     compParams.pColorFillParams         = colorFill ? colorFill->GetSwFilterParams().colorFillParams : nullptr;
 
@@ -1029,11 +1031,36 @@ MOS_STATUS PolicyFcHandler::AddInputLayerForProcess(bool &bSkip, std::vector<int
     return MOS_STATUS_SUCCESS;
 }
 
-MOS_STATUS PolicyFcHandler::RemoveTransparentLayers(SwFilterPipe& featurePipe)
+MOS_STATUS PolicyFcHandler::RemoveInvisibleLayers(SwFilterPipe& featurePipe)
 {
+    VP_SURFACE *output = featurePipe.GetSurface(false, 0);
+    VP_PUBLIC_CHK_NULL_RETURN(output);
+    VP_PUBLIC_CHK_NULL_RETURN(output->osSurface);
+
     for (uint32_t i = 0; i < featurePipe.GetSurfaceCount(true); ++i)
     {
         SwFilterSubPipe *subpipe = featurePipe.GetSwFilterSubPipe(true, i);
+        VP_SURFACE      *input   = featurePipe.GetSurface(true, i);
+
+        // Layers placed entirely outside of the target cannot write any pixel,
+        // but would still take a layer slot and may force an extra FC pass.
+        if (input &&
+            (input->rcDst.right <= 0 ||
+             input->rcDst.bottom <= 0 ||
+             input->rcDst.left >= (int32_t)output->osSurface->dwWidth ||
+             input->rcDst.top >= (int32_t)output->osSurface->dwHeight))
+        {
+            VP_PUBLIC_NORMALMESSAGE("Layer %d skipped: rcDst (%d, %d, %d, %d) is out of target %d x %d",
+                i,
+                input->rcDst.left,
+                input->rcDst.top,
+                input->rcDst.right,
+                input->rcDst.bottom,
+                output->osSurface->dwWidth,
+                output->osSurface->dwHeight);
+            VP_PUBLIC_CHK_STATUS_RETURN(featurePipe.DestroySurface(true, i));
+            continue;
+        }
 
         auto blending = dynamic_cast<SwFilterBlending *>(featurePipe.GetSwFilter(true, i, FeatureTypeBlending));
         if (nullptr == blending)
@@ -1078,7 +1105,7 @@ MOS_STATUS PolicyFcHandler::LayerSelectForProcess(std::vector<int> &layerIndexes
     layerIndexes.clear();
     m_resCounter.Reset(m_hwCaps.m_rules.isAvsSamplerSupported);
 
-    VP_PUBLIC_CHK_STATUS_RETURN(RemoveTransparentLayers(featurePipe));
+    VP_PUBLIC_CHK_STATUS_RETURN(RemoveInvisibleLayers(featurePipe));
 
     bool skip = false;
     VP_SURFACE *output = featurePipe.GetSurface(false, 0);
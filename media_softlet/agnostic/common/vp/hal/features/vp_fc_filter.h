@@ -154,6 +154,13 @@ public:
 MEDIA_CLASS_DEFINE_END(vp__PolicyFcFeatureHandler)
 };
 
+//!
+//! \brief  Layer selection for multi-layer composition on render
+//! \details A multi-layer pipe always composes on render. Opaque, non overlapping
+//!          mosaic tiles can use VEBOX+SFC instead when each tile is submitted as
+//!          its own single layer call into its rcDst of the shared target, with
+//!          color fill left to the first call.
+//!
 class PolicyFcHandler : public PolicyFeatureHandler
 {
 public:
@@ -181,7 +188,7 @@ public:
     static bool s_forceNearestToBilinearIfBilinearExists;
 
 private:
-    MOS_STATUS RemoveTransparentLayers(SwFilterPipe& featurePipe);
+    MOS_STATUS RemoveInvisibleLayers(SwFilterPipe& featurePipe);
     virtual MOS_STATUS AddInputLayerForProcess(bool &bSkip, std::vector<int> &layerIndexes, VPHAL_SCALING_MODE &scalingMode, int index, VP_SURFACE &input, SwFilterSubPipe& pipe, VP_SURFACE &output, VP_EXECUTE_CAPS& caps);
 
     PacketParamFactory<VpRenderFcParameter> m_PacketParamFactory;
@@ -793,6 +793,8 @@ MOS_STATUS VpRenderCmdPacket::SetupCurbeState()
 
     VP_RENDER_CHK_STATUS_RETURN(m_kernel->GetCurbeState(curbeData, curbeLength, curbeLengthAligned, m_renderData.KernelParam, m_renderHal->dwCurbeBlockAlign));
 
+    // The media state (DSH block) is reassigned by renderhal for every submission and the
+    // previous block may still be in use by the GPU, so CURBE is always loaded in full.
     m_renderData.iCurbeOffset = m_renderHal->pfnLoadCurbeData(
         m_renderHal,
         m_renderData.mediaState,
@@ -1231,6 +1231,10 @@ MOS_STATUS VpRenderFcKernel::GetKernelEntry(Kdll_CacheEntry &entry)
     //============================
     // KERNEL SEARCH
     //============================
+    // Linked kernels are cached in kernelDllState, keyed by the hash of the
+    // search filter, for the life of the VP instance. They are not persisted
+    // across processes: the cache holds GPU binaries patched with per-process
+    // CSC/procamp state, so a disk copy would need its own versioning and trust.
     Kdll_State *kernelDllState = m_kernelDllState;
 
     VP_RENDER_CHK_NULL_RETURN(kernelDllState);
@@ -2291,6 +2295,8 @@ MOS_STATUS VpRenderFcKernel::GetWalkerSetting(KERNEL_WALKER_PARAMS& walkerParam,
         walkerParam.isVerticalPattern = true;
     }
 
+    // The block per thread is fixed by the FC kernels and the platform media walker block size,
+    // only the walk order is chosen here, so there is no shape left to tune at run time.
     walkerParam.bSyncFlag = 0;
     walkerParam.isGroupStartInvolvedInGroupSize = true;
 
@@ -1548,13 +1548,14 @@ MOS_STATUS SfcRenderBase::FreeResources()
     return MOS_STATUS_SUCCESS;
 }
 
-MOS_STATUS SfcRenderBase::SetHistogramBuf(PMOS_BUFFER histogramBuf)
+MOS_STATUS SfcRenderBase::SetHistogramBuf(PMOS_BUFFER histogramBuf, uint32_t offset)
 {
     VP_FUNC_CALL();
 
     if (histogramBuf != nullptr)
     {
         m_histogramSurf.OsResource = histogramBuf->OsResource;
+        m_histogramSurf.dwOffset   = offset;
     }
 
     return MOS_STATUS_SUCCESS;
@@ -215,7 +215,7 @@ public:
         return m_renderData.pIefParams;
     }
 
-    MOS_STATUS SetHistogramBuf(PMOS_BUFFER histogramBuf);
+    MOS_STATUS SetHistogramBuf(PMOS_BUFFER histogramBuf, uint32_t offset = 0);
 
     //!
     //! \brief    Set sfc pipe selected with vebox
@@ -3781,6 +3781,9 @@ MOS_STATUS VpVeboxCmdPacket::UpdateVeboxStates()
     }
 
     // Update DN State in CPU
+    // Called in PrepareState before the current VEBOX command is submitted, so the
+    // statistics read here are the ones of the previous frame (N-1). The lock only
+    // waits when that frame is still running, and only HVS denoise takes this path.
     MOS_ZeroMemory(&LockFlags, sizeof(MOS_LOCK_PARAMS));
     LockFlags.ReadOnly = 1;
 
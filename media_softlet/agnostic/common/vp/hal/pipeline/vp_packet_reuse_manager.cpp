@@ -421,6 +421,46 @@ MOS_STATUS VpColorFillReuse::UpdateFeatureParams(FeatureParamColorFill &params)
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS VpColorFillReuse::CheckTeamsParams(bool reusable, bool &reused, SwFilter *filter, uint32_t index)
+{
+    VP_FUNC_CALL();
+    SwFilterColorFill *colorfill = dynamic_cast<SwFilterColorFill *>(filter);
+    auto               it        = m_params_Teams.find(index);
+
+    // A stored packet without color fill only matches a pipe without it.
+    if (nullptr == colorfill)
+    {
+        reused = reusable && m_params_Teams.end() == it;
+        return MOS_STATUS_SUCCESS;
+    }
+
+    reused = reusable && m_params_Teams.end() != it && colorfill->GetSwFilterParams() == it->second;
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS VpColorFillReuse::StoreTeamsParams(SwFilter *filter, uint32_t index)
+{
+    VP_FUNC_CALL();
+    SwFilterColorFill *colorfill = dynamic_cast<SwFilterColorFill *>(filter);
+
+    m_params_Teams.erase(index);
+    m_colorFillParams_Teams.erase(index);
+
+    if (nullptr == colorfill)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    FeatureParamColorFill params = colorfill->GetSwFilterParams();
+    if (params.colorFillParams)
+    {
+        auto stored = m_colorFillParams_Teams.insert(std::make_pair(index, *params.colorFillParams));
+        params.colorFillParams = &stored.first->second;
+    }
+    m_params_Teams.insert(std::make_pair(index, params));
+    return MOS_STATUS_SUCCESS;
+}
+
 /*******************************************************************/
 /***********************VpAlphaReuse********************************/
 /*******************************************************************/
@@ -473,6 +513,46 @@ MOS_STATUS VpAlphaReuse::UpdateFeatureParams(FeatureParamAlpha &params)
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS VpAlphaReuse::CheckTeamsParams(bool reusable, bool &reused, SwFilter *filter, uint32_t index)
+{
+    VP_FUNC_CALL();
+    SwFilterAlpha *alpha = dynamic_cast<SwFilterAlpha *>(filter);
+    auto           it    = m_params_Teams.find(index);
+
+    // A stored packet without alpha only matches a pipe without it.
+    if (nullptr == alpha)
+    {
+        reused = reusable && m_params_Teams.end() == it;
+        return MOS_STATUS_SUCCESS;
+    }
+
+    reused = reusable && m_params_Teams.end() != it && alpha->GetSwFilterParams() == it->second;
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS VpAlphaReuse::StoreTeamsParams(SwFilter *filter, uint32_t index)
+{
+    VP_FUNC_CALL();
+    SwFilterAlpha *alpha = dynamic_cast<SwFilterAlpha *>(filter);
+
+    m_params_Teams.erase(index);
+    m_compAlpha_Teams.erase(index);
+
+    if (nullptr == alpha)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    FeatureParamAlpha params = alpha->GetSwFilterParams();
+    if (params.compAlpha)
+    {
+        auto stored = m_compAlpha_Teams.insert(std::make_pair(index, *params.compAlpha));
+        params.compAlpha = &stored.first->second;
+    }
+    m_params_Teams.insert(std::make_pair(index, params));
+    return MOS_STATUS_SUCCESS;
+}
+
 /*******************************************************************/
 /***********************VpDenoiseReuse********************************/
 /*******************************************************************/
@@ -858,7 +938,9 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
 
             if (feature == FeatureTypeCsc ||
                 feature == FeatureTypeScaling ||
-                feature == FeatureTypeRotMir)
+                feature == FeatureTypeRotMir ||
+                feature == FeatureTypeColorFill ||
+                feature == FeatureTypeAlpha)
             {
                 // Teams feature
             }
@@ -879,31 +961,29 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
 
     if (!isPacketPipeReused && m_TeamsPacket)
     {
-        SwFilter *scaling = pipe.GetSwFilter(true, 0, FeatureTypeScaling);
-        SwFilter *csc     = pipe.GetSwFilter(true, 0, FeatureTypeCsc);
-        SwFilter *rot     = pipe.GetSwFilter(true, 0, FeatureTypeRotMir);
+        // Features keyed into the stored packets, one packet per distinct parameter set
+        const FeatureType teamsFeatures[] = {FeatureTypeScaling, FeatureTypeCsc, FeatureTypeRotMir, FeatureTypeColorFill, FeatureTypeAlpha};
 
         bool reused = false;
 
-        auto scalingreuse = m_features.find(FeatureTypeScaling);
-        auto cscreuse     = m_features.find(FeatureTypeCsc);
-        auto rotreuse     = m_features.find(FeatureTypeRotMir);
-
         for (index = 0; index < m_pipeReused_TeamsPacket.size(); index++)
         {
-            scalingreuse->second->CheckTeamsParams(reusableOfLastPipe, reused, scaling, index);
-            if (!reused)
+            for (auto feature : teamsFeatures)
             {
-                continue;
-            }
+                auto featureReuse = m_features.find(feature);
+                if (m_features.end() == featureReuse)
+                {
+                    reused = false;
+                    break;
+                }
 
-            cscreuse->second->CheckTeamsParams(reusableOfLastPipe, reused, csc, index);
-            if (!reused)
-            {
-                continue;
+                featureReuse->second->CheckTeamsParams(reusableOfLastPipe, reused, pipe.GetSwFilter(true, 0, feature), index);
+                if (!reused)
+                {
+                    break;
+                }
             }
 
-            rotreuse->second->CheckTeamsParams(reusableOfLastPipe, reused, rot, index);
             if (reused)
             {
                 break;
@@ -912,9 +992,14 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
         // if not found, store the new params and packet
         if (!reused)
         {
-            scalingreuse->second->StoreTeamsParams(scaling, curIndex);
-            cscreuse->second->StoreTeamsParams(csc, curIndex);
-            rotreuse->second->StoreTeamsParams(rot, curIndex);
+            for (auto feature : teamsFeatures)
+            {
+                auto featureReuse = m_features.find(feature);
+                if (m_features.end() != featureReuse)
+                {
+                    featureReuse->second->StoreTeamsParams(pipe.GetSwFilter(true, 0, feature), curIndex);
+                }
+            }
 
             m_TeamsPacket_reuse = false;
 
@@ -159,11 +159,15 @@ public:
     virtual ~VpColorFillReuse();
     MOS_STATUS UpdateFeatureParams(bool reusable, bool &reused, SwFilter *filter);
     MOS_STATUS UpdatePacket(SwFilter *filter, VpCmdPacket *packet);
+    MOS_STATUS CheckTeamsParams(bool reusable, bool &reused, SwFilter *filter, uint32_t index);
+    MOS_STATUS StoreTeamsParams(SwFilter *filter, uint32_t index);
 protected:
     MOS_STATUS UpdateFeatureParams(FeatureParamColorFill &params);
 
     FeatureParamColorFill m_params = {};
     VPHAL_COLORFILL_PARAMS m_colorFillParams = {};
+    std::map<uint32_t, FeatureParamColorFill> m_params_Teams;
+    std::map<uint32_t, VPHAL_COLORFILL_PARAMS> m_colorFillParams_Teams;    //!< Backing store of m_params_Teams[].colorFillParams
 
 MEDIA_CLASS_DEFINE_END(vp__VpColorFillReuse)
 };
@@ -175,12 +179,16 @@ public:
     virtual ~VpAlphaReuse();
     MOS_STATUS UpdateFeatureParams(bool reusable, bool &reused, SwFilter *filter);
     MOS_STATUS UpdatePacket(SwFilter *filter, VpCmdPacket *packet);
+    MOS_STATUS CheckTeamsParams(bool reusable, bool &reused, SwFilter *filter, uint32_t index);
+    MOS_STATUS StoreTeamsParams(SwFilter *filter, uint32_t index);
 
 protected:
     MOS_STATUS UpdateFeatureParams(FeatureParamAlpha &params);
 
     FeatureParamAlpha m_params = {};
     VPHAL_ALPHA_PARAMS m_compAlpha = {};
+    std::map<uint32_t, FeatureParamAlpha> m_params_Teams;
+    std::map<uint32_t, VPHAL_ALPHA_PARAMS> m_compAlpha_Teams;    //!< Backing store of m_params_Teams[].compAlpha
 
 MEDIA_CLASS_DEFINE_END(vp__VpAlphaReuse)
 };
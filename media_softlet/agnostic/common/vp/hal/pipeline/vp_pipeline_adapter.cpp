@@ -142,6 +142,8 @@ MOS_STATUS VpPipelineAdapter::Render(PCVPHAL_RENDER_PARAMS pcRenderParams)
 
     if (1 == pcRenderParams->uSrcCount && pcRenderParams->uDstCount > 1)
     {
+        // 1:N is executed as N single output pipes. Each one normally takes the VEBOX+SFC
+        // path, and with packet reuse the later outputs only patch scaling and surfaces.
         for (uint32_t dstIndex = 0; dstIndex < pcRenderParams->uDstCount; ++dstIndex)
         {
             params           = *(PVP_PIPELINE_PARAMS)pcRenderParams;
@@ -159,6 +159,8 @@ MOS_STATUS VpRenderKernel::Destroy()
 MOS_STATUS VpPlatformInterface::InitPolicyRules(VP_POLICY_RULES &rules)
 {
     VP_FUNC_CALL();
+    // Scaling beyond the one pass SFC range stays on SFC by two SFC passes when enabled below,
+    // instead of falling back to render. There is no two pass path for CSC.
     rules.sfcMultiPassSupport.csc.enable = false;
     if (m_sfc2PassScalingEnabled)
     {
@@ -25,6 +25,8 @@
 //! \brief    Defines the common interface for media scalability singlepipe mode.
 //! \details  The media scalability singlepipe interface is further sub-divided by component,
 //!           this file is for the base interface which is shared by all components.
+//!           Multi VEBOX column split scalability is VpScalabilityMultiPipeNext in
+//!           shared/scalability/vp_scalability_multipipe_next.h.
 //!
 
 #ifndef __VP_SCALABILITY_SINGLEPIPE_NEXT_H__
@@ -38,6 +38,12 @@
 
 namespace vp
 {
+//!
+//! \brief  Records the GPU tag of each reported VP frame in the status table
+//! \details Completion is resolved lazily from the tags when the application queries or syncs;
+//!          nothing runs on completion. A single thread can poll any number of contexts with
+//!          vaSyncSurface2 and a zero timeout.
+//!
 class VPStatusReport
 {
 public:
@@ -631,14 +631,15 @@ VAStatus DdiDecodeAvc::AllocSliceControlBuffer(
     {
         if (availSize < buf->uiNumElements)
         {
-            newSize = sizeof(VASliceParameterBufferBase) * (m_sliceCtrlBufNum - availSize + buf->uiNumElements);
+            uint32_t newNum = GetSliceCtrlGrowNum(m_sliceCtrlBufNum - availSize + buf->uiNumElements);
+            newSize = sizeof(VASliceParameterBufferBase) * newNum;
             bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264Base = (VASliceParameterBufferBase *)realloc(bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264Base, newSize);
             if (bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264Base == nullptr)
             {
                 return VA_STATUS_ERROR_ALLOCATION_FAILED;
             }
-            MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264Base + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferBase) * (buf->uiNumElements - availSize));
-            m_sliceCtrlBufNum = m_sliceCtrlBufNum - availSize + buf->uiNumElements;
+            MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264Base + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferBase) * (newNum - m_sliceCtrlBufNum));
+            m_sliceCtrlBufNum = newNum;
         }
         buf->pData    = (uint8_t*)bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264Base;
         buf->uiOffset = bufMgr->dwNumSliceControl * sizeof(VASliceParameterBufferBase);
@@ -647,14 +648,15 @@ VAStatus DdiDecodeAvc::AllocSliceControlBuffer(
     {
         if (availSize < buf->uiNumElements)
         {
-            newSize = sizeof(VASliceParameterBufferH264) * (m_sliceCtrlBufNum - availSize + buf->uiNumElements);
+            uint32_t newNum = GetSliceCtrlGrowNum(m_sliceCtrlBufNum - availSize + buf->uiNumElements);
+            newSize = sizeof(VASliceParameterBufferH264) * newNum;
             bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264 = (VASliceParameterBufferH264 *)realloc(bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264, newSize);
             if (bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264 == nullptr)
             {
                 return VA_STATUS_ERROR_ALLOCATION_FAILED;
             }
-            MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264 + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferH264) * (buf->uiNumElements - availSize));
-            m_sliceCtrlBufNum = m_sliceCtrlBufNum - availSize + buf->uiNumElements;
+            MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264 + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferH264) * (newNum - m_sliceCtrlBufNum));
+            m_sliceCtrlBufNum = newNum;
          }
          buf->pData    = (uint8_t*)bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264;
          buf->uiOffset = bufMgr->dwNumSliceControl * sizeof(VASliceParameterBufferH264);
@@ -114,6 +114,14 @@ VAStatus DdiDecodeBase::ParseProcessingBuffer(
             DDI_CODEC_CHK_NULL(m_procBuf, "nullptr m_procBuf", VA_STATUS_ERROR_ALLOCATION_FAILED);
             MOS_SecureMemcpy(m_procBuf, sizeof(VAProcPipelineParameterBuffer), procBuf, sizeof(VAProcPipelineParameterBuffer));
         }
+        DDI_CODEC_CHK_NULL(procBuf->additional_outputs, "nullptr processing outputs", VA_STATUS_ERROR_INVALID_PARAMETER);
+        if (procBuf->num_additional_outputs == 0)
+        {
+            DDI_CODEC_ASSERTMESSAGE("No processing output for decode processing.");
+            return VA_STATUS_ERROR_INVALID_PARAMETER;
+        }
+        m_procOutputs.assign(procBuf->additional_outputs, procBuf->additional_outputs + procBuf->num_additional_outputs);
+
         auto decProcessingParams =
             (DecodeProcessingParams *)m_decodeCtx->DecodeParams.m_procParams;
 
@@ -315,7 +323,7 @@ VAStatus DdiDecodeBase::DecodeCombineBitstream(DDI_MEDIA_CONTEXT *mediaCtx)
         return VA_STATUS_ERROR_DECODING_ERROR;
     }
 
-    newBitstreamBuffer->iSize     = m_decodeCtx->DecodeParams.m_dataSize;
+    newBitstreamBuffer->iSize     = GetBsBufArenaSize(m_decodeCtx->DecodeParams.m_dataSize);
     newBitstreamBuffer->uiType    = VASliceDataBufferType;
     newBitstreamBuffer->format    = Media_Format_Buffer;
     newBitstreamBuffer->uiOffset  = 0;
@@ -468,6 +476,17 @@ void DdiDecodeBase::DestroyContext(VADriverContextP ctx)
     return;
 }
 
+uint32_t DdiDecodeBase::GetBsBufArenaSize(uint32_t size)
+{
+    if (size > m_bsArenaSize)
+    {
+        uint32_t grown = m_bsArenaSize + (m_bsArenaSize >> 1);
+        m_bsArenaSize  = MOS_ALIGN_CEIL(MOS_MAX(size, grown), MOS_PAGE_SIZE);
+    }
+
+    return m_bsArenaSize;
+}
+
 int32_t DdiDecodeBase::GetBitstreamBufIndexFromBuffer(DDI_CODEC_COM_BUFFER_MGR *bufMgr, DDI_MEDIA_BUFFER *buf)
 {
     DDI_CODEC_FUNC_ENTER;
@@ -509,10 +528,10 @@ VAStatus DdiDecodeBase::AllocBsBuffer(
     if (index >= bufMgr->m_maxNumSliceData)
     {
         /* In theroy it can resize the m_maxNumSliceData one by one. But in order to
-         * avoid calling realloc frequently, it will try to allocate 10 to  hold more
-         * SliceDataBuf. This is only for the optimized purpose.
+         * avoid calling realloc frequently, it doubles the capacity (at least 10 more)
+         * to hold more SliceDataBuf. This is only for the optimized purpose.
          */
-        int32_t reallocSize = bufMgr->m_maxNumSliceData + 10;
+        uint32_t reallocSize = MOS_MAX(bufMgr->m_maxNumSliceData + 10, bufMgr->m_maxNumSliceData * 2);
 
         bufMgr->pSliceData  = (DDI_CODEC_BITSTREAM_BUFFER_INFO *)realloc(bufMgr->pSliceData, sizeof(bufMgr->pSliceData[0]) * reallocSize);
 
@@ -522,9 +541,9 @@ VAStatus DdiDecodeBase::AllocBsBuffer(
             return VA_STATUS_ERROR_ALLOCATION_FAILED;
         }
         memset(bufMgr->pSliceData + bufMgr->m_maxNumSliceData, 0,
-               sizeof(bufMgr->pSliceData[0]) * 10);
+               sizeof(bufMgr->pSliceData[0]) * (reallocSize - bufMgr->m_maxNumSliceData));
 
-        bufMgr->m_maxNumSliceData += 10;
+        bufMgr->m_maxNumSliceData = reallocSize;
     }
 
     if (index >= 1)
@@ -582,15 +601,18 @@ VAStatus DdiDecodeBase::AllocBsBuffer(
         bsBufObj->pMediaCtx = m_decodeCtx->pMediaCtx;
         bsBufBaseAddr       = bufMgr->pBitStreamBase[bufMgr->dwBitstreamIndex];
 
+        // Buffers smaller than the arena are replaced too, so the rest of the
+        // frame fits without an extra copy in DecodeCombineBitstream.
+        uint32_t arenaSize = GetBsBufArenaSize(buf->iSize);
         if (bsBufBaseAddr == nullptr)
         {
             createBsBuffer = true;
-            if (buf->iSize > bsBufObj->iSize)
+            if (arenaSize > bsBufObj->iSize)
             {
-                bsBufObj->iSize = buf->iSize;
+                bsBufObj->iSize = arenaSize;
             }
         }
-        else if (buf->iSize > bsBufObj->iSize)
+        else if (arenaSize > bsBufObj->iSize)
         {
            // free bo
             MediaLibvaUtilNext::UnlockBuffer(bsBufObj);
@@ -598,7 +620,7 @@ VAStatus DdiDecodeBase::AllocBsBuffer(
             bsBufBaseAddr = nullptr;
 
             createBsBuffer  = true;
-            bsBufObj->iSize = buf->iSize;
+            bsBufObj->iSize = arenaSize;
         }
 
         if (createBsBuffer)
@@ -748,9 +770,12 @@ VAStatus DdiDecodeBase::ExtraDownScaling(
     DDI_CODEC_CHK_NULL(decoder, "nullptr decoder", VA_STATUS_ERROR_INVALID_PARAMETER);
     isDecodeDownScalingSupported = decoder->IsDownSamplingSupported();
 
+    // Output 0 is written by VD+SFC within the decode submission when supported
+    uint32_t firstVpOutput = isDecodeDownScalingSupported ? 1 : 0;
+
     if (m_decodeCtx->DecodeParams.m_procParams != nullptr &&
        m_procBuf &&
-       !isDecodeDownScalingSupported)
+       m_procOutputs.size() > firstVpOutput)
     {
         // check vp context
         VAContextID vpCtxID = VA_INVALID_ID;
@@ -770,14 +795,21 @@ VAStatus DdiDecodeBase::ExtraDownScaling(
         PDDI_VP_CONTEXT pVpCtx = (PDDI_VP_CONTEXT)MediaLibvaCommonNext::GetContextFromContextID(ctx, vpCtxID, &ctxType);
         DDI_CODEC_CHK_NULL(pVpCtx, "nullptr pVpCtx", VA_STATUS_ERROR_INVALID_CONTEXT);
 
-        // Set parameters
-        VAProcPipelineParameterBuffer* pInputPipelineParam = m_procBuf;
-        DDI_CODEC_CHK_NULL(pInputPipelineParam, "nullptr pInputPipelineParam", VA_STATUS_ERROR_ALLOCATION_FAILED);
+        // Set parameters, the first vp output is the render target and the rest are
+        // passed as additional outputs so that all of them come out of one vp call
+        VAProcPipelineParameterBuffer inputPipelineParam = *m_procBuf;
+        inputPipelineParam.additional_outputs     = m_procOutputs.data() + firstVpOutput + 1;
+        inputPipelineParam.num_additional_outputs = (uint32_t)m_procOutputs.size() - firstVpOutput - 1;
+        if (firstVpOutput > 0)
+        {
+            // Output region only applies to the vdbox sfc output, scale full surface for the others
+            inputPipelineParam.output_region = nullptr;
+        }
 
-        vaStatus = mediaCtx->m_compList[CompVp]->BeginPicture(ctx, vpCtxID, pInputPipelineParam->additional_outputs[0]);
+        vaStatus = mediaCtx->m_compList[CompVp]->BeginPicture(ctx, vpCtxID, m_procOutputs[firstVpOutput]);
         DDI_CHK_RET(vaStatus, "VP BeginPicture failed");
 
-        vaStatus = m_decodeCtx->pVpDdiInterface->DdiSetProcPipelineParams(ctx, pVpCtx, pInputPipelineParam);
+        vaStatus = m_decodeCtx->pVpDdiInterface->DdiSetProcPipelineParams(ctx, pVpCtx, &inputPipelineParam);
         DDI_CHK_RET(vaStatus, "VP SetProcPipelineParams failed.");
 
         vaStatus = mediaCtx->m_compList[CompVp]->EndPicture(ctx, vpCtxID);
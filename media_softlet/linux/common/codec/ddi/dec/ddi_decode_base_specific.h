@@ -28,6 +28,7 @@
 #define _DDI_DECODE_BASE_SPECIFIC_H_
 
 #include <stdint.h>
+#include <vector>
 #include <va/va.h>
 #include "ddi_codec_base_specific.h"
 #include "decode_pipeline_adapter.h"
@@ -364,6 +365,34 @@ protected:
     //! \brief    decoded picture buffer flag
     bool m_withDpb = true;
 
+    //!
+    //! \brief    Get the size for a new bitstream buffer
+    //! \details  Bitstream buffers are sized by the biggest frame seen so far
+    //!           and grow by half of that on overflow, so a stream settles on
+    //!           one size and its slices are written straight into the BO.
+    //!
+    //! \param    [in] size
+    //!           Bytes needed by the current frame
+    //!
+    //! \return   Size in bytes, at least size
+    //!
+    uint32_t GetBsBufArenaSize(uint32_t size);
+
+    //!
+    //! \brief    Get the slice control capacity when it must grow
+    //! \details  Doubles the capacity so frames with many slices do not
+    //!           realloc the slice control arrays on every frame.
+    //!
+    //! \param    [in] required
+    //!           Number of slice control entries needed
+    //!
+    //! \return   New slice control capacity, at least required
+    //!
+    uint32_t GetSliceCtrlGrowNum(uint32_t required)
+    {
+        return MOS_MAX(required, m_sliceCtrlBufNum * 2);
+    }
+
     //!
     //! \brief    return the Buffer offset for sliceGroup
     //! \details  return the Base  offset for one given slice_data buffer.
@@ -379,7 +408,10 @@ protected:
     uint32_t GetBsBufOffset(int32_t sliceGroup);
 
     //! \brief    Parse the processing buffer if needed.
-    //! \details  Helps to parse the Video-post processing buffer for Decoding
+    //! \details  Helps to parse the Video-post processing buffer for Decoding.
+    //!           This is the fused decode+VPP path: a VAProcPipelineParameterBuffer
+    //!           rendered on the decode context makes DecodeDownSamplingFeature write
+    //!           the scaled/converted output via SFC, with no separate VP submission.
     //!
     //! \param    [in] mediaCtx
     //!           DDI_MEDIA_CONTEXT * type
@@ -436,7 +468,9 @@ protected:
         uint16_t wMode);
 
     //! \brief    Use EU path to do the scaling
-    //! \details  When VD+SFC are not supported, it will call into VPhal to do scaling
+    //! \details  When VD+SFC are not supported, it will call into VPhal to do scaling.
+    //!           When VD+SFC handles the first processing output, the remaining
+    //!           outputs are scaled from the decoded surface by one VPhal 1:N call.
     //!
     //! \param    [in] ctx
     //!           VADriverContextP * type
@@ -479,6 +513,7 @@ protected:
     bool                  m_streamOutEnabled;     //!<Stream Out enable flag
     uint32_t              m_sliceParamBufNum;     //!<Slice parameter Buffer Number
     uint32_t              m_sliceCtrlBufNum;      //!<Slice control Buffer Number
+    uint32_t              m_bsArenaSize = 0;      //!<Bitstream buffer size high water mark
     uint32_t              m_decProcessingType;    //!<Decode Processing type
     CodechalSetting      *m_codechalSettings = nullptr;    //!<Codechal Settings
     static const uint32_t m_decDefaultMaxWidth = 4096;
@@ -487,6 +522,7 @@ protected:
 #ifdef _DECODE_PROCESSING_SUPPORTED
     bool                           m_requireInputRegion = false;
     VAProcPipelineParameterBuffer *m_procBuf = nullptr; //!< Process parameters for vp sfc input
+    std::vector<VASurfaceID>       m_procOutputs;       //!< Processing outputs of current frame, the first one may be handled by vdbox sfc
 #endif
 MEDIA_CLASS_DEFINE_END(decode__DdiDecodeBase)
 };
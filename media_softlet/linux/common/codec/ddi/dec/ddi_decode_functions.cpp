@@ -206,6 +206,7 @@ VAStatus DdiDecodeFunctions::CreateContext(
 
     decCtx->pMediaCtx   = mediaCtx;
     decCtx->m_ddiDecodeNext = ddiDecode;
+    MosUtilities::MosInitMutex(&decCtx->StatusReportMutex);
 
     MOS_CONTEXT mosCtx = {};
     mosCtx.bufmgr                = mediaCtx->pDrmBufMgr;
@@ -347,11 +348,9 @@ void DdiDecodeFunctions::FreeBufferHeapElements(VADriverContextP ctx, PDDI_DECOD
         void *pDecContext = nullptr;
         uint32_t i = (uint32_t)mediaBufferHeapElmt->uiVaBufferID;
         DDI_CODEC_CHK_LESS(i, mediaCtx->pBufferHeap->uiAllocatedHeapElements, "invalid buffer id", );
-        MosUtilities::MosLockMutex(&mediaCtx->BufferMutex);
         PDDI_MEDIA_BUFFER_HEAP_ELEMENT bufHeapElement = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)mediaCtx->pBufferHeap->pHeapBase;
         bufHeapElement += i;
         pDecContext = bufHeapElement->pCtx;
-        MosUtilities::MosUnlockMutex(&mediaCtx->BufferMutex);
 
         if (pDecContext == decCtx)
         {
@@ -1028,7 +1027,10 @@ VAStatus DdiDecodeFunctions::StatusCheck(
 
     uint32_t i = 0;
     PDDI_DECODE_CONTEXT decCtx = (decltype(decCtx))surface->pDecCtx;
-    MediaLibvaUtilNext_LockGuard guard(&mediaCtx->SurfaceMutex);
+    DDI_CODEC_CHK_NULL(decCtx, "nullptr decCtx in Decode StatusCheck", VA_STATUS_ERROR_INVALID_CONTEXT);
+    // Only syncs on the same decoder need to be serialized, SurfaceMutex is
+    // just taken around the surface updates
+    MediaLibvaUtilNext_LockGuard guard(&decCtx->StatusReportMutex);
 
     Codechal *codecHal = decCtx->pCodecHal;
     // return success just avoid vaDestroyContext is ahead of vaSyncSurface
@@ -1069,6 +1071,7 @@ VAStatus DdiDecodeFunctions::StatusReport(
 
             if ((tempNewReport.codecStatus == CODECHAL_STATUS_SUCCESSFUL) || (tempNewReport.codecStatus == CODECHAL_STATUS_ERROR) || (tempNewReport.codecStatus == CODECHAL_STATUS_INCOMPLETE))
             {
+                MediaLibvaUtilNext_LockGuard surfaceGuard(&mediaCtx->SurfaceMutex);
                 PDDI_MEDIA_SURFACE_HEAP_ELEMENT mediaSurfaceHeapElmt = (PDDI_MEDIA_SURFACE_HEAP_ELEMENT)mediaCtx->pSurfaceHeap->pHeapBase;
 
                 uint32_t j = 0;
@@ -1106,17 +1109,22 @@ VAStatus DdiDecodeFunctions::StatusReport(
 #endif
 
     // check the report ptr of current surface.
-    if (surface->curStatusReportQueryState == DDI_MEDIA_STATUS_REPORT_QUERY_STATE_COMPLETED)
+    MosUtilities::MosLockMutex(&mediaCtx->SurfaceMutex);
+    DDI_MEDIA_STATUS_REPORT_QUERY_STATE queryState = surface->curStatusReportQueryState;
+    uint32_t                            status     = surface->curStatusReport.decode.status;
+    MosUtilities::MosUnlockMutex(&mediaCtx->SurfaceMutex);
+
+    if (queryState == DDI_MEDIA_STATUS_REPORT_QUERY_STATE_COMPLETED)
     {
-        if (surface->curStatusReport.decode.status == CODECHAL_STATUS_SUCCESSFUL)
+        if (status == CODECHAL_STATUS_SUCCESSFUL)
         {
             return VA_STATUS_SUCCESS;
         }
-        else if (surface->curStatusReport.decode.status == CODECHAL_STATUS_ERROR)
+        else if (status == CODECHAL_STATUS_ERROR)
         {
             return VA_STATUS_ERROR_DECODING_ERROR;
         }
-        else if (surface->curStatusReport.decode.status == CODECHAL_STATUS_INCOMPLETE || surface->curStatusReport.decode.status == CODECHAL_STATUS_UNAVAILABLE)
+        else if (status == CODECHAL_STATUS_INCOMPLETE || status == CODECHAL_STATUS_UNAVAILABLE)
         {
             return mediaCtx->bMediaResetEnable ? VA_STATUS_SUCCESS : VA_STATUS_ERROR_HW_BUSY;
         }
@@ -1278,6 +1286,7 @@ void DdiDecodeFunctions::CleanUp(
     {
         if (decCtx->m_ddiDecodeNext)
         {
+            MosUtilities::MosDestroyMutex(&decCtx->StatusReportMutex);
             decCtx->m_ddiDecodeNext->DestroyContext(ctx);
             MOS_Delete(decCtx->m_ddiDecodeNext);
             MOS_FreeMemory(decCtx);
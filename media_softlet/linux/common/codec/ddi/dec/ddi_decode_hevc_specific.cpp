@@ -883,12 +883,423 @@ MOS_FORMAT DdiDecodeHevc::GetFormat()
     return Format;
 }
 
+HevcSliceHeaderBits::HevcSliceHeaderBits(const uint8_t *data, uint32_t size)
+{
+    m_data = data;
+    m_size = size;
+}
+
+uint8_t HevcSliceHeaderBits::GetByte()
+{
+    // 0x000003 marks an emulation prevention byte which is not part of RBSP
+    if (m_zeroRun >= 2 && m_pos < m_size && m_data[m_pos] == 0x03)
+    {
+        m_pos++;
+        m_emuPrevnBytes++;
+        m_zeroRun = 0;
+    }
+
+    if (m_pos >= m_size)
+    {
+        m_overrun = true;
+        return 0;
+    }
+
+    uint8_t v = m_data[m_pos++];
+    m_zeroRun = (v == 0) ? (m_zeroRun + 1) : 0;
+    m_rbspBytes++;
+    return v;
+}
+
+uint32_t HevcSliceHeaderBits::GetBit()
+{
+    if (m_bitsLeft == 0)
+    {
+        m_curByte  = GetByte();
+        m_bitsLeft = 8;
+    }
+
+    m_bitsLeft--;
+    return (m_curByte >> m_bitsLeft) & 1;
+}
+
+uint32_t HevcSliceHeaderBits::GetBits(uint32_t n)
+{
+    uint32_t v = 0;
+    while (n-- > 0)
+    {
+        v = (v << 1) | GetBit();
+    }
+    return v;
+}
+
+uint32_t HevcSliceHeaderBits::GetUE()
+{
+    uint32_t nZero = 0;
+    while (!GetBit())
+    {
+        if (m_overrun || ++nZero > 31)
+        {
+            m_overrun = true;
+            return 0;
+        }
+    }
+
+    return ((1u << nZero) - 1) + GetBits(nZero);
+}
+
+int32_t HevcSliceHeaderBits::GetSE()
+{
+    uint32_t k = GetUE();
+    return (k & 1) ? (int32_t)((k + 1) >> 1) : -(int32_t)(k >> 1);
+}
+
+void HevcSliceHeaderBits::SkipBits(uint32_t n)
+{
+    while (n-- > 0 && !m_overrun)
+    {
+        GetBit();
+    }
+}
+
+static uint32_t HevcCeilLog2(uint32_t value)
+{
+    uint32_t bits = 0;
+    while ((1u << bits) < value)
+    {
+        bits++;
+    }
+    return bits;
+}
+
+bool DdiDecodeHevc::ParseSliceHeader(
+    const uint8_t               *data,
+    uint32_t                    size,
+    const CODEC_HEVC_PIC_PARAMS &picParams,
+    const uint8_t               *rpsList0,
+    const uint8_t               *rpsList1,
+    uint32_t                    numPicTotalCurr,
+    CODEC_HEVC_SLICE_PARAMS     &slc)
+{
+    enum
+    {
+        sliceTypeB = 0,
+        sliceTypeP = 1,
+        sliceTypeI = 2
+    };
+
+    // Long format slice data starts at the NAL unit header
+    uint32_t startCodeLen = 0;
+    if (size >= 3 && data[0] == 0 && data[1] == 0 && data[2] == 1)
+    {
+        startCodeLen = 3;
+    }
+    else if (size >= 4 && data[0] == 0 && data[1] == 0 && data[2] == 0 && data[3] == 1)
+    {
+        startCodeLen = 4;
+    }
+
+    HevcSliceHeaderBits bits(data + startCodeLen, size - startCodeLen);
+
+    bits.SkipBits(1);  // forbidden_zero_bit
+    uint32_t nalUnitType = bits.GetBits(6);
+    bits.SkipBits(9);  // nuh_layer_id, nuh_temporal_id_plus1
+    if (nalUnitType > 23)
+    {
+        return false;
+    }
+
+    uint32_t minCbSize        = 1 << (picParams.log2_min_luma_coding_block_size_minus3 + 3);
+    uint32_t ctbSize          = minCbSize << picParams.log2_diff_max_min_luma_coding_block_size;
+    uint32_t widthInCtb       = MOS_ROUNDUP_DIVIDE(picParams.PicWidthInMinCbsY * minCbSize, ctbSize);
+    uint32_t heightInCtb      = MOS_ROUNDUP_DIVIDE(picParams.PicHeightInMinCbsY * minCbSize, ctbSize);
+    uint32_t chromaArrayType  = picParams.separate_colour_plane_flag ? 0 : picParams.chroma_format_idc;
+
+    uint32_t firstSliceInPic = bits.GetBit();
+    if (nalUnitType >= 16)
+    {
+        bits.SkipBits(1);  // no_output_of_prior_pics_flag
+    }
+    bits.GetUE();  // slice_pic_parameter_set_id
+
+    slc.slice_segment_address = 0;
+    if (!firstSliceInPic)
+    {
+        if (picParams.dependent_slice_segments_enabled_flag && bits.GetBit())
+        {
+            // Dependent slice segments inherit the header of the previous slice
+            return false;
+        }
+        slc.slice_segment_address = bits.GetBits(HevcCeilLog2(widthInCtb * heightInCtb));
+    }
+
+    bits.SkipBits(picParams.num_extra_slice_header_bits);
+    uint32_t sliceType = bits.GetUE();
+    if (sliceType > sliceTypeI || (sliceType != sliceTypeI && numPicTotalCurr == 0))
+    {
+        return false;
+    }
+    if (picParams.output_flag_present_flag)
+    {
+        bits.SkipBits(1);  // pic_output_flag
+    }
+    if (picParams.separate_colour_plane_flag)
+    {
+        slc.LongSliceFlags.fields.color_plane_id = bits.GetBits(2);
+    }
+
+    slc.LongSliceFlags.fields.slice_type = sliceType;
+
+    // IDR_W_RADL and IDR_N_LP carry no POC and no RPS
+    if (nalUnitType != 19 && nalUnitType != 20)
+    {
+        bits.SkipBits(picParams.log2_max_pic_order_cnt_lsb_minus4 + 4);
+        if (!bits.GetBit())  // short_term_ref_pic_set_sps_flag
+        {
+            bits.SkipBits(picParams.wNumBitsForShortTermRPSInSlice);
+        }
+        else if (picParams.num_short_term_ref_pic_sets > 1)
+        {
+            bits.SkipBits(HevcCeilLog2(picParams.num_short_term_ref_pic_sets));
+        }
+        if (picParams.sps_temporal_mvp_enabled_flag)
+        {
+            slc.LongSliceFlags.fields.slice_temporal_mvp_enabled_flag = bits.GetBit();
+        }
+    }
+
+    if (picParams.sample_adaptive_offset_enabled_flag)
+    {
+        slc.LongSliceFlags.fields.slice_sao_luma_flag = bits.GetBit();
+        if (chromaArrayType != 0)
+        {
+            slc.LongSliceFlags.fields.slice_sao_chroma_flag = bits.GetBit();
+        }
+    }
+
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        for (uint32_t j = 0; j < CODEC_MAX_NUM_REF_FRAME_HEVC; j++)
+        {
+            slc.RefPicList[i][j].FrameIdx = 0x7f;
+        }
+    }
+
+    if (sliceType != sliceTypeI)
+    {
+        uint32_t numRefIdxL0 = picParams.num_ref_idx_l0_default_active_minus1;
+        uint32_t numRefIdxL1 = picParams.num_ref_idx_l1_default_active_minus1;
+        if (bits.GetBit())  // num_ref_idx_active_override_flag
+        {
+            numRefIdxL0 = bits.GetUE();
+            if (sliceType == sliceTypeB)
+            {
+                numRefIdxL1 = bits.GetUE();
+            }
+        }
+        if (numRefIdxL0 >= CODEC_MAX_NUM_REF_FRAME_HEVC || numRefIdxL1 >= CODEC_MAX_NUM_REF_FRAME_HEVC)
+        {
+            return false;
+        }
+        slc.num_ref_idx_l0_active_minus1 = numRefIdxL0;
+        slc.num_ref_idx_l1_active_minus1 = (sliceType == sliceTypeB) ? numRefIdxL1 : 0;
+
+        for (uint32_t j = 0; j <= numRefIdxL0; j++)
+        {
+            slc.RefPicList[0][j].FrameIdx = rpsList0[j % numPicTotalCurr];
+        }
+        if (sliceType == sliceTypeB)
+        {
+            for (uint32_t j = 0; j <= numRefIdxL1; j++)
+            {
+                slc.RefPicList[1][j].FrameIdx = rpsList1[j % numPicTotalCurr];
+            }
+            slc.LongSliceFlags.fields.mvd_l1_zero_flag = bits.GetBit();
+        }
+        if (picParams.cabac_init_present_flag)
+        {
+            slc.LongSliceFlags.fields.cabac_init_flag = bits.GetBit();
+        }
+
+        slc.LongSliceFlags.fields.collocated_from_l0_flag = 1;
+        if (slc.LongSliceFlags.fields.slice_temporal_mvp_enabled_flag)
+        {
+            if (sliceType == sliceTypeB)
+            {
+                slc.LongSliceFlags.fields.collocated_from_l0_flag = bits.GetBit();
+            }
+            uint32_t numRefIdx = slc.LongSliceFlags.fields.collocated_from_l0_flag ?
+                slc.num_ref_idx_l0_active_minus1 : slc.num_ref_idx_l1_active_minus1;
+            if (numRefIdx > 0)
+            {
+                slc.collocated_ref_idx = bits.GetUE();
+                if (slc.collocated_ref_idx > numRefIdx)
+                {
+                    return false;
+                }
+            }
+        }
+
+        slc.five_minus_max_num_merge_cand = bits.GetUE();
+    }
+
+    slc.slice_qp_delta = bits.GetSE();
+    if (picParams.pps_slice_chroma_qp_offsets_present_flag)
+    {
+        slc.slice_cb_qp_offset = bits.GetSE();
+        slc.slice_cr_qp_offset = bits.GetSE();
+    }
+
+    slc.LongSliceFlags.fields.slice_deblocking_filter_disabled_flag = picParams.pps_deblocking_filter_disabled_flag;
+    slc.slice_beta_offset_div2 = picParams.pps_beta_offset_div2;
+    slc.slice_tc_offset_div2   = picParams.pps_tc_offset_div2;
+    if (picParams.deblocking_filter_override_enabled_flag && bits.GetBit())
+    {
+        slc.LongSliceFlags.fields.slice_deblocking_filter_disabled_flag = bits.GetBit();
+        if (!slc.LongSliceFlags.fields.slice_deblocking_filter_disabled_flag)
+        {
+            slc.slice_beta_offset_div2 = bits.GetSE();
+            slc.slice_tc_offset_div2   = bits.GetSE();
+        }
+    }
+
+    slc.LongSliceFlags.fields.slice_loop_filter_across_slices_enabled_flag = picParams.pps_loop_filter_across_slices_enabled_flag;
+    if (picParams.pps_loop_filter_across_slices_enabled_flag &&
+        (slc.LongSliceFlags.fields.slice_sao_luma_flag || slc.LongSliceFlags.fields.slice_sao_chroma_flag ||
+         !slc.LongSliceFlags.fields.slice_deblocking_filter_disabled_flag))
+    {
+        slc.LongSliceFlags.fields.slice_loop_filter_across_slices_enabled_flag = bits.GetBit();
+    }
+
+    if (picParams.slice_segment_header_extension_present_flag)
+    {
+        bits.SkipBits(bits.GetUE() * 8);
+    }
+
+    // byte_alignment()
+    if (!bits.GetBit())
+    {
+        return false;
+    }
+    while (!bits.IsByteAligned())
+    {
+        bits.SkipBits(1);
+    }
+
+    if (bits.IsOverrun() || bits.GetRbspByteOffset() + bits.GetNumEmuPrevnBytes() >= size - startCodeLen)
+    {
+        return false;
+    }
+
+    slc.slice_data_offset         += startCodeLen;
+    slc.slice_data_size           -= startCodeLen;
+    slc.ByteOffsetToSliceData      = bits.GetRbspByteOffset();
+    slc.NumEmuPrevnBytesInSliceHdr = bits.GetNumEmuPrevnBytes();
+
+    return true;
+}
+
+bool DdiDecodeHevc::ParseShortFormatSliceHeaders()
+{
+    DDI_CODEC_FUNC_ENTER;
+
+    CodechalDecodeParams     *decodeParams = &m_decodeCtx->DecodeParams;
+    PCODEC_HEVC_PIC_PARAMS   picParams     = (PCODEC_HEVC_PIC_PARAMS)decodeParams->m_picParams;
+    PCODEC_HEVC_SLICE_PARAMS slcParams     = (PCODEC_HEVC_SLICE_PARAMS)decodeParams->m_sliceParams;
+    uint32_t                 numSlices     = decodeParams->m_numSlices;
+
+    if (!m_hostSliceParseInUse || picParams == nullptr || slcParams == nullptr ||
+        numSlices == 0 || numSlices > m_hostParsedSliceNumMax)
+    {
+        return false;
+    }
+
+    // Leave anything beyond the plain slice header syntax to HuC
+    if (picParams->tiles_enabled_flag || picParams->entropy_coding_sync_enabled_flag ||
+        picParams->long_term_ref_pics_present_flag || picParams->lists_modification_present_flag ||
+        picParams->weighted_pred_flag || picParams->weighted_bipred_flag)
+    {
+        return false;
+    }
+
+    // Initial reference lists: StCurrBefore by descending POC, StCurrAfter by ascending POC
+    uint8_t  before[8], after[8];
+    uint32_t numBefore = 0, numAfter = 0;
+    for (uint32_t i = 0; i < 8; i++)
+    {
+        uint8_t idx = picParams->RefPicSetStCurrBefore[i];
+        if (idx < CODEC_MAX_NUM_REF_FRAME_HEVC)
+        {
+            uint32_t j = numBefore++;
+            for (; j > 0 && picParams->PicOrderCntValList[before[j - 1]] < picParams->PicOrderCntValList[idx]; j--)
+            {
+                before[j] = before[j - 1];
+            }
+            before[j] = idx;
+        }
+        idx = picParams->RefPicSetStCurrAfter[i];
+        if (idx < CODEC_MAX_NUM_REF_FRAME_HEVC)
+        {
+            uint32_t j = numAfter++;
+            for (; j > 0 && picParams->PicOrderCntValList[after[j - 1]] > picParams->PicOrderCntValList[idx]; j--)
+            {
+                after[j] = after[j - 1];
+            }
+            after[j] = idx;
+        }
+    }
+
+    uint32_t numPicTotalCurr = numBefore + numAfter;
+    uint8_t  rpsList0[16], rpsList1[16];
+    for (uint32_t i = 0; i < numPicTotalCurr; i++)
+    {
+        rpsList0[i] = (i < numBefore) ? before[i] : after[i - numBefore];
+        rpsList1[i] = (i < numAfter) ? after[i] : before[i - numAfter];
+    }
+
+    DDI_CODEC_COM_BUFFER_MGR *bufMgr = &m_decodeCtx->BufMgr;
+    DDI_MEDIA_BUFFER         *bsBuf  = bufMgr->pBitStreamBuffObject[bufMgr->dwBitstreamIndex];
+    if (bsBuf == nullptr || bsBuf->bo == nullptr)
+    {
+        return false;
+    }
+
+    uint8_t *bsBase = (uint8_t *)MediaLibvaUtilNext::LockBuffer(bsBuf, MOS_LOCKFLAG_READONLY);
+    if (bsBase == nullptr)
+    {
+        return false;
+    }
+
+    CODEC_HEVC_SLICE_PARAMS parsed[m_hostParsedSliceNumMax];
+    bool                    valid = true;
+    for (uint32_t i = 0; i < numSlices && valid; i++)
+    {
+        parsed[i] = slcParams[i];
+        valid     = ((uint64_t)parsed[i].slice_data_offset + parsed[i].slice_data_size <= bsBuf->iSize) &&
+                    ParseSliceHeader(bsBase + parsed[i].slice_data_offset, parsed[i].slice_data_size,
+                        *picParams, rpsList0, rpsList1, numPicTotalCurr, parsed[i]);
+    }
+
+    MediaLibvaUtilNext::UnlockBuffer(bsBuf);
+
+    if (!valid)
+    {
+        return false;
+    }
+
+    parsed[numSlices - 1].LongSliceFlags.fields.LastSliceOfPic = 1;
+    MOS_SecureMemcpy(slcParams, numSlices * sizeof(CODEC_HEVC_SLICE_PARAMS), parsed, numSlices * sizeof(CODEC_HEVC_SLICE_PARAMS));
+
+    return true;
+}
+
 VAStatus DdiDecodeHevc::SetDecodeParams()
 {
     DDI_CODEC_FUNC_ENTER;
 
      DDI_CODEC_CHK_RET(DdiDecodeBase::SetDecodeParams(), "SetDecodeParams failed!");
      CODEC_HEVC_PIC_PARAMS *picParams = (CODEC_HEVC_PIC_PARAMS *)(&m_decodeCtx->DecodeParams)->m_picParams;
+     m_decodeCtx->DecodeParams.m_hostParsedSliceParams = ParseShortFormatSliceHeaders();
      // "flat" scaling lists
      if (picParams->scaling_list_enabled_flag == 0)
      {
@@ -1198,14 +1609,15 @@ VAStatus DdiDecodeHevc::AllocSliceControlBuffer(DDI_MEDIA_BUFFER *buf)
             if (buf->iSize / buf->uiNumElements != sizeof(VASliceParameterBufferBase))
                 return VA_STATUS_ERROR_ALLOCATION_FAILED;
 
-            newSize = sizeof(VASliceParameterBufferBase) * (m_sliceCtrlBufNum - availSize + buf->uiNumElements);
+            uint32_t newNum = GetSliceCtrlGrowNum(m_sliceCtrlBufNum - availSize + buf->uiNumElements);
+            newSize = sizeof(VASliceParameterBufferBase) * newNum;
             bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufBaseHEVC = (VASliceParameterBufferBase *)realloc(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufBaseHEVC, newSize);
             if (bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufBaseHEVC == nullptr)
             {
                 return VA_STATUS_ERROR_ALLOCATION_FAILED;
             }
-            MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufBaseHEVC + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferBase) * (buf->uiNumElements - availSize));
-            m_sliceCtrlBufNum = m_sliceCtrlBufNum - availSize + buf->uiNumElements;
+            MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufBaseHEVC + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferBase) * (newNum - m_sliceCtrlBufNum));
+            m_sliceCtrlBufNum = newNum;
         }
         buf->pData    = (uint8_t*)bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufBaseHEVC;
         buf->uiOffset = bufMgr->dwNumSliceControl * sizeof(VASliceParameterBufferBase);
@@ -1219,14 +1631,15 @@ VAStatus DdiDecodeHevc::AllocSliceControlBuffer(DDI_MEDIA_BUFFER *buf)
                 if (buf->iSize / buf->uiNumElements != sizeof(VASliceParameterBufferHEVC))
                     return VA_STATUS_ERROR_ALLOCATION_FAILED;
 
-                newSize = sizeof(VASliceParameterBufferHEVC) * (m_sliceCtrlBufNum - availSize + buf->uiNumElements);
+                uint32_t newNum = GetSliceCtrlGrowNum(m_sliceCtrlBufNum - availSize + buf->uiNumElements);
+                newSize = sizeof(VASliceParameterBufferHEVC) * newNum;
                 bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVC = (VASliceParameterBufferHEVC *)realloc(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVC, newSize);
                 if (bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVC == nullptr)
                 {
                     return VA_STATUS_ERROR_ALLOCATION_FAILED;
                 }
-                MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVC + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferHEVC) * (buf->uiNumElements - availSize));
-                m_sliceCtrlBufNum = m_sliceCtrlBufNum - availSize + buf->uiNumElements;
+                MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVC + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferHEVC) * (newNum - m_sliceCtrlBufNum));
+                m_sliceCtrlBufNum = newNum;
             }
             buf->pData    = (uint8_t*)bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVC;
             buf->uiOffset = bufMgr->dwNumSliceControl * sizeof(VASliceParameterBufferHEVC);
@@ -1238,14 +1651,15 @@ VAStatus DdiDecodeHevc::AllocSliceControlBuffer(DDI_MEDIA_BUFFER *buf)
                 if (buf->iSize / buf->uiNumElements != sizeof(VASliceParameterBufferHEVCExtension))
                     return VA_STATUS_ERROR_ALLOCATION_FAILED;
 
-                newSize = sizeof(VASliceParameterBufferHEVCExtension) * (m_sliceCtrlBufNum - availSize + buf->uiNumElements);
+                uint32_t newNum = GetSliceCtrlGrowNum(m_sliceCtrlBufNum - availSize + buf->uiNumElements);
+                newSize = sizeof(VASliceParameterBufferHEVCExtension) * newNum;
                 bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVCRext= (VASliceParameterBufferHEVCExtension*)realloc(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVCRext, newSize);
                 if (bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVCRext == nullptr)
                 {
                     return VA_STATUS_ERROR_ALLOCATION_FAILED;
                 }
-                MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVCRext+ m_sliceCtrlBufNum, sizeof(VASliceParameterBufferHEVCExtension) * (buf->uiNumElements - availSize));
-                m_sliceCtrlBufNum = m_sliceCtrlBufNum - availSize + buf->uiNumElements;
+                MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVCRext+ m_sliceCtrlBufNum, sizeof(VASliceParameterBufferHEVCExtension) * (newNum - m_sliceCtrlBufNum));
+                m_sliceCtrlBufNum = newNum;
             }
             buf->pData    = (uint8_t*)bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVCRext;
             buf->uiOffset = bufMgr->dwNumSliceControl * sizeof(VASliceParameterBufferHEVCExtension);
@@ -1292,6 +1706,11 @@ VAStatus DdiDecodeHevc::CodecHalInit(
 
     m_codechalSettings->shortFormatInUse = m_decodeCtx->bShortFormatInUse;
 
+    // Encrypted bitstreams and range extension slice params can't be parsed on host
+    m_hostSliceParseInUse = m_decodeCtx->bShortFormatInUse && !IsRextProfile() &&
+                            !m_ddiDecodeAttr->componentData.data.encryptType;
+    m_codechalSettings->hostSliceParseInUse = m_hostSliceParseInUse;
+
     m_codechalSettings->mode         = CODECHAL_DECODE_MODE_HEVCVLD;
     m_codechalSettings->standard     = CODECHAL_HEVC;
     m_codechalSettings->chromaFormat = HCP_CHROMA_FORMAT_YUV420;
@@ -32,6 +32,56 @@
 namespace decode
 {
 
+//!
+//! \class  HevcSliceHeaderBits
+//! \brief  Bit reader over a HEVC NAL unit, emulation prevention bytes are skipped
+//!
+class HevcSliceHeaderBits
+{
+public:
+    HevcSliceHeaderBits() = delete;
+
+    HevcSliceHeaderBits(const uint8_t *data, uint32_t size);
+
+    virtual ~HevcSliceHeaderBits() {};
+
+    uint32_t GetBit();
+
+    uint32_t GetBits(uint32_t n);
+
+    uint32_t GetUE();
+
+    int32_t GetSE();
+
+    void SkipBits(uint32_t n);
+
+    //!
+    //! \brief  Number of RBSP bytes consumed, emulation prevention bytes excluded
+    //!
+    uint32_t GetRbspByteOffset() { return m_rbspBytes; }
+
+    uint32_t GetNumEmuPrevnBytes() { return m_emuPrevnBytes; }
+
+    bool IsByteAligned() { return m_bitsLeft == 0; }
+
+    bool IsOverrun() { return m_overrun; }
+
+protected:
+    uint8_t GetByte();
+
+    const uint8_t *m_data          = nullptr;
+    uint32_t       m_size          = 0;
+    uint32_t       m_pos           = 0;
+    uint32_t       m_zeroRun       = 0;
+    uint32_t       m_curByte       = 0;
+    uint32_t       m_bitsLeft      = 0;
+    uint32_t       m_rbspBytes     = 0;
+    uint32_t       m_emuPrevnBytes = 0;
+    bool           m_overrun       = false;
+
+MEDIA_CLASS_DEFINE_END(decode__HevcSliceHeaderBits)
+};
+
 //!
 //! \class  DdiDecodeHevc
 //! \brief  DDI Decode HEVC
@@ -139,6 +189,42 @@ protected:
     VAStatus AllocSliceParamContext(
         uint32_t numSlices);
 
+    //! \brief   Parse short format slices to long format on host
+    //! \details For frames with few slices and no tiles, WPP, long term
+    //!          references, list modification or weighted prediction the slice
+    //!          headers are parsed on CPU, so HuC short to long conversion can
+    //!          be skipped. The slice params are left untouched on failure.
+    //!
+    //! \return  true if all slice params of the frame are filled in long format
+    bool ParseShortFormatSliceHeaders();
+
+    //! \brief   Parse one slice segment header
+    //!
+    //! \param   [in] data
+    //!          Slice NAL unit, an optional start code is skipped
+    //! \param   [in] size
+    //!          Size of data in bytes
+    //! \param   [in] picParams
+    //!          Picture params of current frame
+    //! \param   [in] rpsList0
+    //!          Initial reference list 0 before repetition, RefFrameList indices
+    //! \param   [in] rpsList1
+    //!          Initial reference list 1 before repetition, RefFrameList indices
+    //! \param   [in] numPicTotalCurr
+    //!          Number of entries in rpsList0 and rpsList1
+    //! \param   [in, out] slc
+    //!          Slice params, slice data offset and size are updated past the start code
+    //!
+    //! \return  true if the header is supported and parsed successfully
+    bool ParseSliceHeader(
+        const uint8_t               *data,
+        uint32_t                    size,
+        const CODEC_HEVC_PIC_PARAMS &picParams,
+        const uint8_t               *rpsList0,
+        const uint8_t               *rpsList1,
+        uint32_t                    numPicTotalCurr,
+        CODEC_HEVC_SLICE_PARAMS     &slc);
+
     //! \brief   Init Resource buffer for HEVC
     //! \details Initialize and allocate the Resource buffer for HEVC
     //!
@@ -223,6 +309,9 @@ protected:
 
     static const uint32_t m_decHevcMax16kWidth  = CODEC_16K_MAX_PIC_WIDTH;
     static const uint32_t m_decHevcMax16kHeight = CODEC_16K_MAX_PIC_HEIGHT;
+    static const uint32_t m_hostParsedSliceNumMax = 4;  //!< Max slices per frame parsed to long format by host
+
+    bool m_hostSliceParseInUse = false;  //!< Short format slices may be parsed to long format by host
 
 MEDIA_CLASS_DEFINE_END(decode__DdiDecodeHevc)
 };
@@ -86,6 +86,8 @@ struct DDI_DECODE_CONTEXT
     uint32_t                      dwSliceParamBufNum;
     uint32_t                      dwSliceCtrlBufNum;
     uint32_t                      uiDecProcessingType;
+    // Serializes status report queries of this context, see DdiDecodeFunctions::StatusCheck
+    MEDIA_MUTEX_T                 StatusReportMutex;
 };
 
 typedef struct DDI_DECODE_CONTEXT *PDDI_DECODE_CONTEXT;
@@ -28,6 +28,7 @@
 #include "ddi_encode_base_specific.h"
 #include "media_libva_util_next.h"
 #include "media_libva_interface_next.h"
+#include "media_libva_buffer_pool_next.h"
 namespace encode
 {
 
@@ -169,6 +170,22 @@ VAStatus DdiEncodeBase::StatusReport(
 
     m_encodeCtx->BufMgr.pCodedBufferSegment->status    = 0;
 
+    // The frame currently bound to this buffer was resolved by an earlier map, reuse its slot
+    // instead of scanning and re-querying the status report queue
+    int32_t cachedIndex = (int32_t)mediaBuf->uiCodedReportSlot - 1;
+    if ((cachedIndex >= 0) && (cachedIndex < DDI_ENCODE_MAX_STATUS_REPORT_BUFFER) &&
+        (m_encodeCtx->statusReportBuf.infos[cachedIndex].pCodedBuf == (void *)mediaBuf->bo) &&
+        (m_encodeCtx->statusReportBuf.infos[cachedIndex].uiSize != 0))
+    {
+        m_encodeCtx->BufMgr.pCodedBufferSegment->buf    = MediaLibvaUtilNext::LockBuffer(mediaBuf, MOS_LOCKFLAG_READONLY);
+        m_encodeCtx->BufMgr.pCodedBufferSegment->size   = m_encodeCtx->statusReportBuf.infos[cachedIndex].uiSize;
+        m_encodeCtx->BufMgr.pCodedBufferSegment->status = m_encodeCtx->statusReportBuf.infos[cachedIndex].uiStatus;
+        DDI_CODEC_CHK_RET(SetupCodedBufferSegments(cachedIndex, m_encodeCtx->BufMgr.pCodedBufferSegment), "fail to setup coded buffer segments!");
+        *buf = m_encodeCtx->BufMgr.pCodedBufferSegment;
+        return VA_STATUS_SUCCESS;
+    }
+    mediaBuf->uiCodedReportSlot = 0;
+
     //when this function is called, there must be a frame is ready, will wait until get the right information.
     uint32_t size         = 0;
     int32_t  index        = 0;
@@ -190,6 +207,8 @@ VAStatus DdiEncodeBase::StatusReport(
             {
                 return VA_STATUS_ERROR_ENCODING_ERROR;
             }
+            mediaBuf->uiCodedReportSlot = index + 1;
+            DDI_CODEC_CHK_RET(SetupCodedBufferSegments(index, m_encodeCtx->BufMgr.pCodedBufferSegment), "fail to setup coded buffer segments!");
             break;
         }
 
@@ -423,6 +442,9 @@ VAStatus DdiEncodeBase::RemoveFromStatusReportQueue(DDI_MEDIA_BUFFER *buf)
     DDI_CODEC_CHK_NULL(m_encodeCtx, "Null m_encodeCtx", VA_STATUS_ERROR_INVALID_CONTEXT);
     DDI_CODEC_CHK_NULL(buf, "Null buf", VA_STATUS_ERROR_INVALID_CONTEXT);
 
+    // The buffer is bound to a new frame
+    buf->uiCodedReportSlot = 0;
+
     int32_t    index  = 0;
     uint32_t   size   = 0;
     uint32_t   status = 0;
@@ -895,14 +917,16 @@ VAStatus DdiEncodeBase::CreateBuffer(
         return VA_STATUS_ERROR_INVALID_PARAMETER;
     }
 
-    DDI_MEDIA_BUFFER *buf = (DDI_MEDIA_BUFFER *)MOS_New(DDI_MEDIA_BUFFER);
+    PDDI_MEDIA_CONTEXT mediaCtx = GetMediaContext(ctx);
+    DDI_CODEC_CHK_NULL(mediaCtx, "nullptr mediaCtx", VA_STATUS_ERROR_INVALID_CONTEXT);
+
+    MediaBufferPoolNext *bufferPool = mediaCtx->pBufferPool;
+    DDI_MEDIA_BUFFER *buf = bufferPool ? bufferPool->AcquireBuffer() : (DDI_MEDIA_BUFFER *)MOS_New(DDI_MEDIA_BUFFER);
     if (buf == nullptr)
     {
         return VA_STATUS_ERROR_ALLOCATION_FAILED;
     }
 
-    PDDI_MEDIA_CONTEXT mediaCtx = GetMediaContext(ctx);
-
     buf->pMediaCtx     = mediaCtx;
     buf->uiNumElements = elementsNum;
     buf->uiType        = type;
@@ -1293,7 +1317,15 @@ VAStatus DdiEncodeBase::CreateBuffer(
         (VAEncMacroblockDisableSkipMapBufferType != (int32_t)type) &&
         (VAProbabilityBufferType != (int32_t)type))
     {
-        buf->pData = (uint8_t*)MOS_NewArray(uint8_t,bufSize);
+        // Per frame parameter and slice buffers are recycled through the pool
+        if (bufferPool)
+        {
+            bufferPool->AcquireData(buf, bufSize);
+        }
+        else
+        {
+            buf->pData = (uint8_t*)MOS_NewArray(uint8_t,bufSize);
+        }
         if (nullptr == buf->pData)
         {
             va = VA_STATUS_ERROR_ALLOCATION_FAILED;
@@ -1359,6 +1391,11 @@ void DdiEncodeBase::CleanUpBufferandReturn(DDI_MEDIA_BUFFER *buf)
 {
     if (buf)
     {
+        if (buf->uiPoolCapacity != 0 && buf->pMediaCtx && buf->pMediaCtx->pBufferPool)
+        {
+            buf->pMediaCtx->pBufferPool->ReleaseBuffer(buf);
+            return;
+        }
         MOS_FreeMemory(buf->pData);
         MOS_FreeMemory(buf);
     }
@@ -570,6 +570,26 @@ protected:
         return VA_STATUS_SUCCESS;
     }
 
+    //!
+    //! \brief    Setup the coded buffer segment list for the frame bound to a status report slot.
+    //! \details  Called once the slot of the mapped coded buffer is known, the first segment
+    //!           already describes the whole frame.
+    //!
+    //! \param    [in] index
+    //!           Index of the status report slot
+    //! \param    [in,out] codedBufferSegment
+    //!           Pointer to the first coded buffer segment
+    //!
+    //! \return   VAStatus
+    //!           VA_STATUS_SUCCESS if success, else fail reason
+    //!
+    virtual VAStatus SetupCodedBufferSegments(
+        int32_t                index,
+        VACodedBufferSegment   *codedBufferSegment)
+    {
+        return VA_STATUS_SUCCESS;
+    }
+
     //!
     //! \brief    Clean Up Buffer and Return
     //!
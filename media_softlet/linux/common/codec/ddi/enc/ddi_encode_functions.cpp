@@ -31,6 +31,7 @@
 #include "media_interfaces_codechal_next.h"
 #include "media_interfaces_mmd.h"
 #include "media_libva_interface_next.h"
+#include "media_libva_buffer_pool_next.h"
 
 VAStatus DdiEncodeFunctions::CreateConfig (
     VADriverContextP  ctx,
@@ -650,6 +651,16 @@ VAStatus DdiEncodeFunctions::DestroyBuffer (
     encCtx = encode::GetEncContextFromPVOID(ctxPtr);
     bufMgr = &(encCtx->BufMgr);
 
+    MediaBufferPoolNext *bufferPool = mediaCtx->pBufferPool;
+    if (bufferPool && buf->uiPoolCapacity != 0)
+    {
+        // CPU parameter buffer with pool owned data, park both for the next frame
+        bufferPool->ReleaseBuffer(buf);
+        MediaLibvaInterfaceNext::DestroyBufFromVABufferID(mediaCtx, buffer_id);
+        MOS_TraceEventExt(EVENT_VA_FREE_BUFFER, EVENT_TYPE_END, nullptr, 0, nullptr, 0);
+        return VA_STATUS_SUCCESS;
+    }
+
     switch ((int32_t)buf->uiType)
     {
         case VAImageBufferType:
@@ -766,7 +777,14 @@ VAStatus DdiEncodeFunctions::DestroyBuffer (
             break;
             //return va_STATUS_SUCCESS;
     }
-    MOS_Delete(buf);
+    if (bufferPool)
+    {
+        bufferPool->ReleaseBuffer(buf);
+    }
+    else
+    {
+        MOS_Delete(buf);
+    }
 
     MediaLibvaInterfaceNext::DestroyBufFromVABufferID(mediaCtx, buffer_id);
     MOS_TraceEventExt(EVENT_VA_FREE_BUFFER, EVENT_TYPE_END, nullptr, 0, nullptr, 0);
@@ -418,6 +418,87 @@ VAStatus DdiEncodeHevc::ResetAtFrameLevel()
     return VA_STATUS_SUCCESS;
 }
 
+VAStatus DdiEncodeHevc::ReportExtraStatus(
+    EncodeStatusReportData *encodeStatusReportData,
+    VACodedBufferSegment   *codedBufferSegment)
+{
+    DDI_CODEC_FUNC_ENTER;
+
+    DDI_CODEC_CHK_NULL(m_encodeCtx, "nullptr m_encodeCtx", VA_STATUS_ERROR_INVALID_CONTEXT);
+    DDI_CODEC_CHK_NULL(encodeStatusReportData, "nullptr encodeStatusReportData", VA_STATUS_ERROR_INVALID_PARAMETER);
+
+    // The report was just added by UpdateStatusReportBuffer, which already advanced the update position
+    uint32_t slot = (m_encodeCtx->statusReportBuf.ulUpdatePosition + DDI_ENCODE_MAX_STATUS_REPORT_BUFFER - 1) % DDI_ENCODE_MAX_STATUS_REPORT_BUFFER;
+    std::vector<uint16_t> &sliceSizes = m_sliceSegmentSizes[slot];
+    sliceSizes.clear();
+
+    // Slice sizes are only reported by PAK when dynamic slice size control is enabled
+    if (encodeStatusReportData->sliceSizes == nullptr || encodeStatusReportData->numberSlices <= 1)
+    {
+        return VA_STATUS_SUCCESS;
+    }
+
+    uint32_t totalSize = 0;
+    for (uint32_t i = 0; i < encodeStatusReportData->numberSlices; i++)
+    {
+        totalSize += encodeStatusReportData->sliceSizes[i];
+    }
+
+    // Only expose slices that exactly tile the coded frame, otherwise keep the single segment
+    if (totalSize == encodeStatusReportData->bitstreamSize)
+    {
+        sliceSizes.assign(encodeStatusReportData->sliceSizes, encodeStatusReportData->sliceSizes + encodeStatusReportData->numberSlices);
+    }
+
+    return VA_STATUS_SUCCESS;
+}
+
+VAStatus DdiEncodeHevc::SetupCodedBufferSegments(
+    int32_t                index,
+    VACodedBufferSegment   *codedBufferSegment)
+{
+    DDI_CODEC_FUNC_ENTER;
+
+    DDI_CODEC_CHK_NULL(codedBufferSegment, "nullptr codedBufferSegment", VA_STATUS_ERROR_INVALID_PARAMETER);
+
+    codedBufferSegment->next = nullptr;
+    if (index < 0 || index >= DDI_ENCODE_MAX_STATUS_REPORT_BUFFER || codedBufferSegment->buf == nullptr)
+    {
+        return VA_STATUS_SUCCESS;
+    }
+
+    const std::vector<uint16_t> &sliceSizes = m_sliceSegmentSizes[index];
+    if (sliceSizes.size() <= 1)
+    {
+        return VA_STATUS_SUCCESS;
+    }
+
+    // One segment per slice, all pointing into the same mapped coded buffer so the
+    // application can forward each slice NAL unit without parsing the bitstream
+    m_sliceSegments.resize(sliceSizes.size() - 1);
+
+    uint8_t  *data   = (uint8_t *)codedBufferSegment->buf;
+    uint32_t  status = codedBufferSegment->status;
+    VACodedBufferSegment *segment = codedBufferSegment;
+
+    segment->size = sliceSizes[0];
+    data += sliceSizes[0];
+    for (uint32_t i = 1; i < sliceSizes.size(); i++)
+    {
+        VACodedBufferSegment *nextSegment = &m_sliceSegments[i - 1];
+        MOS_ZeroMemory(nextSegment, sizeof(VACodedBufferSegment));
+        nextSegment->buf    = data;
+        nextSegment->size   = sliceSizes[i];
+        nextSegment->status = status;
+
+        segment->next = nextSegment;
+        segment       = nextSegment;
+        data         += sliceSizes[i];
+    }
+
+    return VA_STATUS_SUCCESS;
+}
+
 VAStatus DdiEncodeHevc::ParseSeqParams(void *ptr)
 {
     DDI_CODEC_CHK_NULL(m_encodeCtx, "nullptr m_encodeCtx", VA_STATUS_ERROR_INVALID_PARAMETER);
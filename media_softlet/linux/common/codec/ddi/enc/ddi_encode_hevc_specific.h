@@ -27,6 +27,7 @@
 #ifndef __DDI_ENCODER_HEVC_SPECIFIC_H__
 #define __DDI_ENCODER_HEVC_SPECIFIC_H__
 
+#include <vector>
 #include "ddi_encode_base_specific.h"
 namespace encode
 {
@@ -224,8 +225,41 @@ protected:
     //!
     VAStatus Qmatrix(void *ptr);
 
+    //!
+    //! \brief    Keep the per slice sizes reported for a completed frame
+    //!
+    //! \param    [in] encodeStatusReportData
+    //!           Pointer to encode status reported by Codechal
+    //! \param    [in] codedBufferSegment
+    //!           Pointer to coded buffer segment
+    //!
+    //! \return   VAStatus
+    //!           VA_STATUS_SUCCESS if success, else fail reason
+    //!
+    VAStatus ReportExtraStatus(
+        EncodeStatusReportData *encodeStatusReportData,
+        VACodedBufferSegment   *codedBufferSegment) override;
+
+    //!
+    //! \brief    Split the coded buffer into one segment per slice when slice sizes were reported
+    //!
+    //! \param    [in] index
+    //!           Index of the status report slot
+    //! \param    [in,out] codedBufferSegment
+    //!           Pointer to the first coded buffer segment
+    //!
+    //! \return   VAStatus
+    //!           VA_STATUS_SUCCESS if success, else fail reason
+    //!
+    VAStatus SetupCodedBufferSegments(
+        int32_t                index,
+        VACodedBufferSegment   *codedBufferSegment) override;
+
     uint16_t m_previousFRvalue = 0; //!< For saving FR value to be used in case of dynamic BRC reset.
 
+    std::vector<uint16_t>             m_sliceSegmentSizes[DDI_ENCODE_MAX_STATUS_REPORT_BUFFER]; //!< Slice sizes per status report slot
+    std::vector<VACodedBufferSegment> m_sliceSegments;                                          //!< Extra segments chained after the first one
+
 private:
     //!
     //! \brief    Get Encode Codechal Picture Type from Va Slice Type
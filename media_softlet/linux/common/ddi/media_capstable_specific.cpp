@@ -84,37 +84,55 @@ VAStatus MediaCapsTableSpecific::Init(DDI_MEDIA_CONTEXT *mediaCtx)
         return VA_STATUS_ERROR_INVALID_PARAMETER;
     }
 
-    for (auto profileMapIter: *m_profileMap)
+    return VA_STATUS_SUCCESS;
+}
+
+void MediaCapsTableSpecific::EnsureConfigList()
+{
+    if (m_configListReady.load(std::memory_order_acquire))
     {
-        auto profile = profileMapIter.first;
-        for(auto entrypointMapIter: *profileMapIter.second)
+        return;
+    }
+
+    m_configListMutex.Lock();
+    if (!m_configListReady.load(std::memory_order_relaxed) && m_profileMap != nullptr)
+    {
+        for (auto profileMapIter: *m_profileMap)
         {
-            auto entrypoint     = entrypointMapIter.first;
-            auto entrypointData = entrypointMapIter.second;
-            DDI_CHK_NULL(entrypointData, "Null pointer", VA_STATUS_ERROR_INVALID_PARAMETER);
+            auto profile = profileMapIter.first;
+            for(auto entrypointMapIter: *profileMapIter.second)
+            {
+                auto entrypoint     = entrypointMapIter.first;
+                auto entrypointData = entrypointMapIter.second;
+                if (entrypointData == nullptr || entrypointData->attribList == nullptr)
+                {
+                    DDI_ASSERTMESSAGE("Null entrypoint data for profile %d entrypoint %d", (int)profile, (int)entrypoint);
+                    continue;
+                }
 
-            auto attriblist     = entrypointData->attribList;
-            DDI_CHK_NULL(attriblist, "Null pointer", VA_STATUS_ERROR_INVALID_PARAMETER);
+                auto attriblist     = entrypointData->attribList;
 
-            auto componentData  = entrypointData->configDataList;
-            int32_t numAttribList = attriblist->size();
-            if(componentData && componentData->size() != 0)
-            {
-                for(int i = 0; i < componentData->size(); i++)
+                auto componentData  = entrypointData->configDataList;
+                int32_t numAttribList = attriblist->size();
+                if(componentData && componentData->size() != 0)
                 {
-                    auto configData = componentData->at(i);
+                    for(int i = 0; i < componentData->size(); i++)
+                    {
+                        auto configData = componentData->at(i);
+                        m_configList.emplace_back(profile, entrypoint, const_cast<VAConfigAttrib*>(attriblist->data()), numAttribList, configData);
+                    }
+                }
+                else
+                {
+                    ComponentData configData = {};
                     m_configList.emplace_back(profile, entrypoint, const_cast<VAConfigAttrib*>(attriblist->data()), numAttribList, configData);
                 }
             }
-            else
-            {
-                ComponentData configData = {};
-                m_configList.emplace_back(profile, entrypoint, const_cast<VAConfigAttrib*>(attriblist->data()), numAttribList, configData);
-            }
         }
-    }
 
-    return VA_STATUS_SUCCESS;
+        m_configListReady.store(true, std::memory_order_release);
+    }
+    m_configListMutex.Unlock();
 }
 
 VAStatus MediaCapsTableSpecific::QueryConfigProfiles(
@@ -175,6 +193,8 @@ ConfigList* MediaCapsTableSpecific::GetConfigList()
 {
     DDI_FUNC_ENTER;
 
+    EnsureConfigList();
+
     return &m_configList;
 }
 
@@ -183,6 +203,8 @@ ConfigLinux* MediaCapsTableSpecific::QueryConfigItemFromIndex(
 {
     DDI_FUNC_ENTER;
 
+    EnsureConfigList();
+
     if (!IS_VALID_CONFIG_ID(configId))
     {
         DDI_ASSERTMESSAGE("Invalid config ID");
@@ -224,6 +246,8 @@ VAStatus MediaCapsTableSpecific::CreateConfig(
 {
     DDI_FUNC_ENTER;
 
+    EnsureConfigList();
+
     DDI_UNUSED(attribList);
     DDI_UNUSED(numAttribs);
     DDI_UNUSED(configId);
@@ -276,6 +300,8 @@ VAStatus MediaCapsTableSpecific::DestroyConfig(VAConfigID configId)
     VAStatus status = VA_STATUS_SUCCESS;
     DDI_FUNC_ENTER;
 
+    EnsureConfigList();
+
     if(!IS_VALID_CONFIG_ID(configId))
     {
         DDI_ASSERTMESSAGE("Invalid config ID");
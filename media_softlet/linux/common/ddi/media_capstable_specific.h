@@ -30,11 +30,13 @@
 #include <vector>
 #include <map>
 #include <set>
+#include <atomic>
 
 #include "va/va.h"
 #include "va/va_drmcommon.h"
 #include "capstable_data_linux_definition.h"
 #include "media_capstable.h"
+#include "mos_utilities.h"
 
 //!
 //! \class  ConfigInfo
@@ -103,9 +105,20 @@ private:
     ImgTable      *m_imgTbl     = nullptr;
     DdiCpCapsInterface *m_cpCaps = nullptr;
 
+    std::atomic<bool> m_configListReady = {false};  //!< m_configList has been expanded from m_profileMap
+    MosMutex          m_configListMutex;
+
+    //!
+    //! \brief    Expand m_profileMap into m_configList on first use
+    //! \details  The profile map is a static per platform table, so vaInitialize
+    //!           only has to resolve it; the flat config list that config IDs
+    //!           index into is built the first time a config is looked up
+    //!
+    void EnsureConfigList();
+
 public:
     //!
-    //! \brief  Store config
+    //! \brief  Store config, only valid after EnsureConfigList, use GetConfigList
     //!
     ConfigList m_configList = {};
 
@@ -120,7 +133,7 @@ public:
     ~MediaCapsTableSpecific();
 
     //!
-    //! \brief    Init configlist
+    //! \brief    Init CP caps, the configlist is built lazily
     //!
     //! \param    [in] mediaCtx
     //!           media context
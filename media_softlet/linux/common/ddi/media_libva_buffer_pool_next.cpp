@@ -0,0 +1,192 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     media_libva_buffer_pool_next.cpp
+//! \brief    Recycler for CPU backed VA parameter buffers
+//!
+
+#include "media_libva_buffer_pool_next.h"
+#include "media_libva_util_next.h"
+
+MediaBufferPoolNext::MediaBufferPoolNext()
+{
+}
+
+MediaBufferPoolNext::~MediaBufferPoolNext()
+{
+    DDI_NORMALMESSAGE("Buffer pool: hits %llu, misses %llu, bypassed %llu, parked %u blocks / %llu bytes",
+        (unsigned long long)m_stats.hits, (unsigned long long)m_stats.misses, (unsigned long long)m_stats.bypassed,
+        m_stats.pooledBlocks, (unsigned long long)m_stats.pooledBytes);
+
+    for (auto &bucket : m_blocks)
+    {
+        for (auto block : bucket.second)
+        {
+            MOS_DeleteArray(block);
+        }
+    }
+    m_blocks.clear();
+
+    for (auto buf : m_structs)
+    {
+        MOS_Delete(buf);
+    }
+    m_structs.clear();
+}
+
+uint32_t MediaBufferPoolNext::GetSizeClassShift(uint32_t size)
+{
+    uint32_t shift = DDI_MEDIA_BUFFER_POOL_MIN_CLASS_SHIFT;
+    while (shift <= DDI_MEDIA_BUFFER_POOL_MAX_CLASS_SHIFT && (1u << shift) < size)
+    {
+        shift++;
+    }
+    return shift;
+}
+
+DDI_MEDIA_BUFFER *MediaBufferPoolNext::AcquireBuffer()
+{
+    DDI_MEDIA_BUFFER *buf = nullptr;
+
+    m_mutex.Lock();
+    if (!m_structs.empty())
+    {
+        buf = m_structs.back();
+        m_structs.pop_back();
+        m_stats.pooledStructs--;
+    }
+    m_mutex.Unlock();
+
+    if (buf == nullptr)
+    {
+        return MOS_New(DDI_MEDIA_BUFFER);
+    }
+
+    *buf = DDI_MEDIA_BUFFER();
+    return buf;
+}
+
+bool MediaBufferPoolNext::AcquireData(DDI_MEDIA_BUFFER *buf, uint32_t size)
+{
+    DDI_CHK_NULL(buf, "nullptr buf", false);
+
+    uint32_t shift = GetSizeClassShift(size);
+    if (shift > DDI_MEDIA_BUFFER_POOL_MAX_CLASS_SHIFT)
+    {
+        m_mutex.Lock();
+        m_stats.bypassed++;
+        m_mutex.Unlock();
+
+        // Too big to park, owned by the caller like any other CPU buffer
+        buf->pData          = (uint8_t *)MOS_NewArray(uint8_t, size);
+        buf->uiPoolCapacity = 0;
+        return buf->pData != nullptr;
+    }
+
+    uint32_t capacity = 1u << shift;
+    uint8_t *block    = nullptr;
+
+    m_mutex.Lock();
+    auto it = m_blocks.find(GetKey(buf->uiType, shift));
+    if (it != m_blocks.end() && !it->second.empty())
+    {
+        block = it->second.back();
+        it->second.pop_back();
+        m_stats.hits++;
+        m_stats.pooledBlocks--;
+        m_stats.pooledBytes -= capacity;
+    }
+    else
+    {
+        m_stats.misses++;
+    }
+    m_mutex.Unlock();
+
+    if (block == nullptr)
+    {
+        block = (uint8_t *)MOS_NewArray(uint8_t, capacity);
+        if (block == nullptr)
+        {
+            return false;
+        }
+    }
+
+    buf->pData          = block;
+    buf->uiPoolCapacity = capacity;
+    return true;
+}
+
+void MediaBufferPoolNext::ReleaseBuffer(DDI_MEDIA_BUFFER *buf)
+{
+    if (buf == nullptr)
+    {
+        return;
+    }
+
+    // Only blocks handed out by AcquireData are owned here, any other pData
+    // has already been released by the caller according to its format.
+    uint8_t *block      = (buf->uiPoolCapacity != 0) ? buf->pData : nullptr;
+    uint32_t capacity   = buf->uiPoolCapacity;
+    uint32_t type       = buf->uiType;
+    bool     keepStruct = false;
+    bool     keepBlock  = false;
+
+    buf->pData          = nullptr;
+    buf->uiPoolCapacity = 0;
+
+    m_mutex.Lock();
+    if (block != nullptr)
+    {
+        auto &bucket = m_blocks[GetKey(type, GetSizeClassShift(capacity))];
+        if (bucket.size() < DDI_MEDIA_BUFFER_POOL_MAX_PER_CLASS)
+        {
+            bucket.push_back(block);
+            m_stats.pooledBlocks++;
+            m_stats.pooledBytes += capacity;
+            keepBlock = true;
+        }
+    }
+    if (m_structs.size() < DDI_MEDIA_BUFFER_POOL_MAX_STRUCTS)
+    {
+        m_structs.push_back(buf);
+        m_stats.pooledStructs++;
+        keepStruct = true;
+    }
+    m_mutex.Unlock();
+
+    if (!keepBlock)
+    {
+        MOS_DeleteArray(block);
+    }
+    if (!keepStruct)
+    {
+        MOS_Delete(buf);
+    }
+}
+
+MediaBufferPoolStats MediaBufferPoolNext::GetStats()
+{
+    m_mutex.Lock();
+    MediaBufferPoolStats stats = m_stats;
+    m_mutex.Unlock();
+    return stats;
+}
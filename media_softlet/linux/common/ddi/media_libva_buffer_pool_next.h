@@ -0,0 +1,113 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     media_libva_buffer_pool_next.h
+//! \brief    Recycler for CPU backed VA parameter buffers
+//!
+
+#ifndef __MEDIA_LIBVA_BUFFER_POOL_NEXT_H__
+#define __MEDIA_LIBVA_BUFFER_POOL_NEXT_H__
+
+#include <map>
+#include <vector>
+#include "media_libva_common_next.h"
+
+#define DDI_MEDIA_BUFFER_POOL_MIN_CLASS_SHIFT   6    // 64 bytes
+#define DDI_MEDIA_BUFFER_POOL_MAX_CLASS_SHIFT   16   // 64 KB
+#define DDI_MEDIA_BUFFER_POOL_MAX_PER_CLASS     32
+#define DDI_MEDIA_BUFFER_POOL_MAX_STRUCTS       256
+
+struct MediaBufferPoolStats
+{
+    uint64_t hits          = 0;   //!< Data blocks served from the pool
+    uint64_t misses        = 0;   //!< Data blocks freshly allocated
+    uint64_t bypassed      = 0;   //!< Requests larger than the biggest size class
+    uint32_t pooledBlocks  = 0;   //!< Data blocks currently parked in the pool
+    uint64_t pooledBytes   = 0;   //!< Bytes currently parked in the pool
+    uint32_t pooledStructs = 0;   //!< Spare DDI_MEDIA_BUFFER structs
+};
+
+//!
+//! \class  MediaBufferPoolNext
+//! \brief  Keeps released DDI_MEDIA_BUFFER structs and their CPU data blocks,
+//!         bucketed by (VA buffer type, power of two size class), so per frame
+//!         parameter and slice buffers are recycled instead of reallocated.
+//!
+class MediaBufferPoolNext
+{
+public:
+    MediaBufferPoolNext();
+
+    ~MediaBufferPoolNext();
+
+    //!
+    //! \brief  Get a DDI_MEDIA_BUFFER struct reset to its defaults
+    //!
+    //! \return DDI_MEDIA_BUFFER*
+    //!         Recycled or newly allocated struct, nullptr on allocation failure
+    //!
+    DDI_MEDIA_BUFFER *AcquireBuffer();
+
+    //!
+    //! \brief  Attach a CPU data block of at least size bytes to buf
+    //!
+    //! \param  [in,out] buf
+    //!         Buffer obtained from AcquireBuffer, buf->uiType must be set
+    //! \param  [in] size
+    //!         Requested size in bytes
+    //!
+    //! \return bool
+    //!         true if buf->pData is valid
+    //!
+    bool AcquireData(DDI_MEDIA_BUFFER *buf, uint32_t size);
+
+    //!
+    //! \brief  Park buf and, if uiPoolCapacity is set, its data block
+    //! \details Any other pData must be released by the caller beforehand
+    //!
+    //! \param  [in] buf
+    //!         Buffer to release, must not be used afterwards
+    //!
+    void ReleaseBuffer(DDI_MEDIA_BUFFER *buf);
+
+    //!
+    //! \brief  Snapshot of the pool counters
+    //!
+    MediaBufferPoolStats GetStats();
+
+private:
+    static uint32_t GetSizeClassShift(uint32_t size);
+
+    static uint64_t GetKey(uint32_t type, uint32_t shift)
+    {
+        return ((uint64_t)type << 32) | shift;
+    }
+
+    MosMutex                                   m_mutex;
+    std::map<uint64_t, std::vector<uint8_t *>> m_blocks;
+    std::vector<DDI_MEDIA_BUFFER *>            m_structs;
+    MediaBufferPoolStats                       m_stats;
+
+MEDIA_CLASS_DEFINE_END(MediaBufferPoolNext)
+};
+
+#endif //__MEDIA_LIBVA_BUFFER_POOL_NEXT_H__
@@ -24,6 +24,8 @@
 //! \brief    libva common next implementaion.
 //!
 #include <stdint.h>
+#include <errno.h>
+#include <sys/mman.h>
 #include "mos_utilities.h"
 #include "media_libva_common_next.h"
 #include "media_libva_util_next.h"
@@ -45,16 +47,59 @@ DDI_MEDIA_SURFACE* MediaLibvaCommonNext::GetSurfaceFromVASurfaceID(PDDI_MEDIA_CO
     if(validSurface)
     {
         DDI_CHK_LESS(id, mediaCtx->pSurfaceHeap->uiAllocatedHeapElements, "invalid surface id", nullptr);
-        MosUtilities::MosLockMutex(&mediaCtx->SurfaceMutex);
         surfaceElement  = (PDDI_MEDIA_SURFACE_HEAP_ELEMENT)mediaCtx->pSurfaceHeap->pHeapBase;
         surfaceElement += id;
         surface         = surfaceElement->pSurface;
-        MosUtilities::MosUnlockMutex(&mediaCtx->SurfaceMutex);
     }
 
     return surface;
 }
 
+void *MediaLibvaCommonNext::GrowHeap(PDDI_MEDIA_HEAP mediaHeap, uint32_t elementSize, uint32_t count)
+{
+    DDI_FUNC_ENTER;
+    DDI_CHK_NULL(mediaHeap, "nullptr mediaHeap", nullptr);
+
+    if (nullptr == mediaHeap->pHeapBase)
+    {
+        // Reserve the whole arena up front, pages are committed on first touch
+        size_t size = (size_t)DDI_MEDIA_HEAP_MAX_ELEMENTS * elementSize;
+        void  *base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (MAP_FAILED == base)
+        {
+            DDI_ASSERTMESSAGE("DDI: failed to reserve heap, errno=%d.", errno);
+            return nullptr;
+        }
+        mediaHeap->pHeapBase              = base;
+        mediaHeap->uiHeapElementSize      = elementSize;
+        mediaHeap->uiReservedHeapElements = DDI_MEDIA_HEAP_MAX_ELEMENTS;
+    }
+
+    if (elementSize != mediaHeap->uiHeapElementSize ||
+        count > mediaHeap->uiReservedHeapElements - mediaHeap->uiAllocatedHeapElements)
+    {
+        DDI_ASSERTMESSAGE("DDI: heap exhausted.");
+        return nullptr;
+    }
+
+    return (uint8_t *)mediaHeap->pHeapBase + (size_t)mediaHeap->uiAllocatedHeapElements * elementSize;
+}
+
+void MediaLibvaCommonNext::DestroyHeap(PDDI_MEDIA_HEAP mediaHeap)
+{
+    DDI_FUNC_ENTER;
+    if (nullptr == mediaHeap || nullptr == mediaHeap->pHeapBase)
+    {
+        return;
+    }
+
+    munmap(mediaHeap->pHeapBase, (size_t)mediaHeap->uiReservedHeapElements * mediaHeap->uiHeapElementSize);
+    mediaHeap->pHeapBase               = nullptr;
+    mediaHeap->pFirstFreeHeapElement   = nullptr;
+    mediaHeap->uiAllocatedHeapElements = 0;
+    mediaHeap->uiReservedHeapElements  = 0;
+}
+
 void MediaLibvaCommonNext::MediaSurfaceToMosResource(DDI_MEDIA_SURFACE *mediaSurface, MOS_RESOURCE  *mosResource)
 {
     DDI_FUNC_ENTER;
@@ -138,6 +183,9 @@ PDDI_MEDIA_SURFACE MediaLibvaCommonNext::ReplaceSurfaceWithNewFormat(PDDI_MEDIA_
     dstSurface->uiLockedBufID = VA_INVALID_ID;
     dstSurface->uiLockedImageID = VA_INVALID_ID;
     dstSurface->pSurfDesc = nullptr;
+    dstSurface->pShadowBuffer = nullptr;
+    dstSurface->pExportDesc = nullptr;
+    dstSurface->pExportBo = nullptr;
     // Lock surface heap
     MosUtilities::MosLockMutex(&mediaCtx->SurfaceMutex);
     uint32_t i;
@@ -252,6 +300,9 @@ PDDI_MEDIA_SURFACE MediaLibvaCommonNext::ReplaceSurfaceWithVariant(PDDI_MEDIA_SU
     MOS_SecureMemcpy(dstSurface,sizeof(DDI_MEDIA_SURFACE),surface,sizeof(DDI_MEDIA_SURFACE));
 
     dstSurface->uiVariantFlag = 1;
+    dstSurface->pShadowBuffer = nullptr;
+    dstSurface->pExportDesc = nullptr;
+    dstSurface->pExportBo = nullptr;
     dstSurface->format = alignedFormat;
     dstSurface->iWidth = alignedWidth;
     dstSurface->iHeight = alignedHeight;
@@ -288,11 +339,9 @@ DDI_MEDIA_BUFFER* MediaLibvaCommonNext::GetBufferFromVABufferID(
     i = (uint32_t)bufferID;
     DDI_CHK_LESS(i, mediaCtx->pBufferHeap->uiAllocatedHeapElements, "invalid buffer id", nullptr);
 
-    MosUtilities::MosLockMutex(&mediaCtx->BufferMutex);
     bufHeapElement  = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)mediaCtx->pBufferHeap->pHeapBase;
     bufHeapElement += i;
     buf             = bufHeapElement->pBuffer;
-    MosUtilities::MosUnlockMutex(&mediaCtx->BufferMutex);
 
     return buf;
 }
@@ -305,17 +354,16 @@ void* MediaLibvaCommonNext::GetVaContextFromHeap(
     PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT vaCtxHeapElmt = nullptr;
     void                              *context      = nullptr;
     DDI_FUNC_ENTER;
+    // Heap elements never move (see GrowHeap), no lock needed
+    MOS_UNUSED(mutex);
 
-    MosUtilities::MosLockMutex(mutex);
     if(nullptr == mediaHeap || index >= mediaHeap->uiAllocatedHeapElements)
     {
-        MosUtilities::MosUnlockMutex(mutex);
         return nullptr;
     }
     vaCtxHeapElmt  = (PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT)mediaHeap->pHeapBase;
     vaCtxHeapElmt  += index;
     context        = vaCtxHeapElmt->pVaContext;
-    MosUtilities::MosUnlockMutex(mutex);
 
     return context;
 }
@@ -387,11 +435,9 @@ uint32_t MediaLibvaCommonNext::GetCtxTypeFromVABufferID(PDDI_MEDIA_CONTEXT media
 
     i = (uint32_t)bufferID;
     DDI_CHK_LESS(i, mediaCtx->pBufferHeap->uiAllocatedHeapElements, "invalid buffer id", DDI_MEDIA_CONTEXT_TYPE_NONE);
-    MosUtilities::MosLockMutex(&mediaCtx->BufferMutex);
     bufHeapElement  = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)mediaCtx->pBufferHeap->pHeapBase;
     bufHeapElement  += i;
     ctxType = bufHeapElement->uiCtxType;
-    MosUtilities::MosUnlockMutex(&mediaCtx->BufferMutex);
 
     return ctxType;
 }
@@ -406,11 +452,9 @@ void* MediaLibvaCommonNext::GetCtxFromVABufferID(PDDI_MEDIA_CONTEXT mediaCtx, VA
 
     i = (uint32_t)bufferID;
     DDI_CHK_LESS(i, mediaCtx->pBufferHeap->uiAllocatedHeapElements, "invalid buffer id", nullptr);
-    MosUtilities::MosLockMutex(&mediaCtx->BufferMutex);
     bufHeapElement  = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)mediaCtx->pBufferHeap->pHeapBase;
     bufHeapElement += i;
     void *temp      = bufHeapElement->pCtx;
-    MosUtilities::MosUnlockMutex(&mediaCtx->BufferMutex);
 
     return temp;
 }
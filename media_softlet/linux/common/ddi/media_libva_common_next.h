@@ -30,6 +30,7 @@
 
 #include <va/va.h>
 #include <va/va_backend.h>
+#include <va/va_drmcommon.h>
 #include <semaphore.h>
 #include "GmmLib.h"
 #include "mos_bufmgr.h"
@@ -37,6 +38,13 @@
 #define DDI_MEDIA_MAX_SURFACE_NUMBER_CONTEXT       127
 #define DDI_MEDIA_MAX_INSTANCE_NUMBER              0x0FFFFFFF
 
+// Address space reserved per DDI heap, elements never move once allocated
+#if defined(__LP64__) || defined(_LP64)
+#define DDI_MEDIA_HEAP_MAX_ELEMENTS                0x00100000
+#else
+#define DDI_MEDIA_HEAP_MAX_ELEMENTS                0x00010000
+#endif
+
 #define DDI_MEDIA_VACONTEXTID_OFFSET_DECODER       0x10000000
 #define DDI_MEDIA_VACONTEXTID_OFFSET_ENCODER       0x20000000
 #define DDI_MEDIA_VACONTEXTID_OFFSET_PROT          0x30000000
@@ -256,6 +264,10 @@ typedef struct _DDI_MEDIA_SURFACE
 
     uint32_t                uiVariantFlag;
     int                     memType;
+
+    VADRMPRIMESurfaceDescriptor *pExportDesc;   // Cached vaExportSurfaceHandle layout, objects[0].fd is a private prime fd
+    uint32_t                uiExportFlags;      // Export flags pExportDesc was built with
+    MOS_LINUX_BO           *pExportBo;          // bo pExportDesc was built for, a different bo invalidates the cache
 } DDI_MEDIA_SURFACE, *PDDI_MEDIA_SURFACE;
 
 typedef struct _DDI_MEDIA_BUFFER
@@ -287,6 +299,8 @@ typedef struct _DDI_MEDIA_BUFFER
     PDDI_MEDIA_SURFACE     pSurface          = nullptr;
     GMM_RESOURCE_INFO     *pGmmResourceInfo  = nullptr; // GMM resource descriptor
     PDDI_MEDIA_CONTEXT     pMediaCtx         = nullptr; // Media driver Context
+    uint32_t               uiPoolCapacity    = 0;       // Size of pData block owned by MediaBufferPoolNext, 0 if not pooled
+    uint32_t               uiCodedReportSlot = 0;       // 1 + status report slot a coded buffer's current frame resolved into, 0 if unresolved
 } DDI_MEDIA_BUFFER, *PDDI_MEDIA_BUFFER;
 
 typedef struct _DDI_MEDIA_SURFACE_HEAP_ELEMENT
@@ -325,6 +339,7 @@ typedef struct _DDI_MEDIA_HEAP
     uint32_t           uiHeapElementSize;
     uint32_t           uiAllocatedHeapElements;
     void               *pFirstFreeHeapElement;
+    uint32_t           uiReservedHeapElements;
 }DDI_MEDIA_HEAP, *PDDI_MEDIA_HEAP;
 
 #ifndef ANDROID
@@ -395,6 +410,33 @@ public:
     //!
     static VASurfaceID GetVASurfaceIDFromSurface(PDDI_MEDIA_SURFACE surface);
 
+    //!
+    //! \brief  Grow heap by count elements
+    //! \details The heap is an arena reserved once with DDI_MEDIA_HEAP_MAX_ELEMENTS
+    //!          elements and committed on touch, so growing never moves existing
+    //!          elements and ID lookups can index pHeapBase without a lock.
+    //!          Caller initializes the new elements and bumps uiAllocatedHeapElements.
+    //!
+    //! \param  [in] mediaHeap
+    //!     Pointer to ddi media heap
+    //! \param  [in] elementSize
+    //!     Size of one heap element
+    //! \param  [in] count
+    //!     Number of elements to add
+    //!
+    //! \return void*
+    //!     Pointer to the first new (zeroed) element, nullptr if failed
+    //!
+    static void *GrowHeap(PDDI_MEDIA_HEAP mediaHeap, uint32_t elementSize, uint32_t count);
+
+    //!
+    //! \brief  Release the arena backing a heap
+    //!
+    //! \param  [in] mediaHeap
+    //!     Pointer to ddi media heap
+    //!
+    static void DestroyHeap(PDDI_MEDIA_HEAP mediaHeap);
+
     //!
     //! \brief  Replace the surface with given format
     //!
@@ -462,7 +504,7 @@ public:
     //! \param  [in] index
     //!         the index
     //! \param  [in] mutex
-    //!         the mutex
+    //!         unused, heap elements have stable addresses
     //!
     static void* GetVaContextFromHeap(PDDI_MEDIA_HEAP mediaHeap, uint32_t index, PMOS_MUTEX mutex);
 
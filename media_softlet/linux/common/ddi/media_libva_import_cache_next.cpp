@@ -0,0 +1,106 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     media_libva_import_cache_next.cpp
+//! \brief    Cache of buffer objects imported from DMA-BUF fds
+//!
+
+#include <sys/stat.h>
+#include "media_libva_import_cache_next.h"
+
+MediaDmaBufImportCacheNext::MediaDmaBufImportCacheNext(uint32_t maxEntries) :
+    m_maxEntries(maxEntries)
+{
+}
+
+MediaDmaBufImportCacheNext::~MediaDmaBufImportCacheNext()
+{
+    for (auto &entry : m_entries)
+    {
+        mos_bo_unreference(entry.bo);
+    }
+    m_entries.clear();
+}
+
+MOS_LINUX_BO *MediaDmaBufImportCacheNext::Import(MOS_BUFMGR *bufmgr, int primeFd, uint32_t size)
+{
+    struct stat st = {};
+
+    if (m_maxEntries == 0 || fstat(primeFd, &st) != 0)
+    {
+        return mos_bo_gem_create_from_prime(bufmgr, primeFd, size);
+    }
+
+    m_mutex.Lock();
+    for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
+    {
+        if (it->dev == (uint64_t)st.st_dev && it->ino == (uint64_t)st.st_ino)
+        {
+            MOS_LINUX_BO *bo = it->bo;
+            mos_bo_reference(bo);
+            m_entries.splice(m_entries.begin(), m_entries, it);
+            m_mutex.Unlock();
+            return bo;
+        }
+    }
+    m_mutex.Unlock();
+
+    MOS_LINUX_BO *bo = mos_bo_gem_create_from_prime(bufmgr, primeFd, size);
+    if (bo == nullptr)
+    {
+        return nullptr;
+    }
+
+    MOS_LINUX_BO *evicted = nullptr;
+    mos_bo_reference(bo);
+
+    m_mutex.Lock();
+    for (auto &cached : m_entries)
+    {
+        // Another thread imported the same dma-buf meanwhile, keep its entry
+        if (cached.dev == (uint64_t)st.st_dev && cached.ino == (uint64_t)st.st_ino)
+        {
+            evicted = bo;
+            break;
+        }
+    }
+    if (evicted == nullptr)
+    {
+        Entry entry;
+        entry.dev = (uint64_t)st.st_dev;
+        entry.ino = (uint64_t)st.st_ino;
+        entry.bo  = bo;
+        m_entries.push_front(entry);
+        if (m_entries.size() > m_maxEntries)
+        {
+            evicted = m_entries.back().bo;
+            m_entries.pop_back();
+        }
+    }
+    m_mutex.Unlock();
+
+    if (evicted)
+    {
+        mos_bo_unreference(evicted);
+    }
+    return bo;
+}
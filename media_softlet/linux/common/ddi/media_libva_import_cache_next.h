@@ -0,0 +1,84 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     media_libva_import_cache_next.h
+//! \brief    Cache of buffer objects imported from DMA-BUF fds
+//!
+
+#ifndef __MEDIA_LIBVA_IMPORT_CACHE_NEXT_H__
+#define __MEDIA_LIBVA_IMPORT_CACHE_NEXT_H__
+
+#include <list>
+#include "mos_bufmgr.h"
+#include "mos_utilities.h"
+
+//!
+//! \class  MediaDmaBufImportCacheNext
+//! \brief  Keeps the most recently imported PRIME buffer objects alive, keyed
+//!         by the (st_dev, st_ino) identity of the dma-buf, so pipelines that
+//!         hand the same buffers in every frame skip the import ioctls, the
+//!         tiling query and the GPU VA assignment of a fresh BO.
+//! \details Holding a BO reference keeps the dma-buf file alive, so its inode
+//!         cannot be recycled for a different buffer while it is cached.
+//!
+class MediaDmaBufImportCacheNext
+{
+public:
+    //!
+    //! \param  [in] maxEntries
+    //!         Number of imports kept alive after their surfaces are gone
+    //!
+    MediaDmaBufImportCacheNext(uint32_t maxEntries);
+
+    ~MediaDmaBufImportCacheNext();
+
+    //!
+    //! \brief  Import prime_fd, reusing a cached BO for the same dma-buf
+    //!
+    //! \param  [in] bufmgr
+    //!         Buffer manager
+    //! \param  [in] primeFd
+    //!         DMA-BUF fd
+    //! \param  [in] size
+    //!         Size hint passed on to the import
+    //!
+    //! \return MOS_LINUX_BO*
+    //!         BO holding a reference owned by the caller, nullptr on failure
+    //!
+    MOS_LINUX_BO *Import(MOS_BUFMGR *bufmgr, int primeFd, uint32_t size);
+
+private:
+    struct Entry
+    {
+        uint64_t      dev = 0;
+        uint64_t      ino = 0;
+        MOS_LINUX_BO *bo  = nullptr;
+    };
+
+    uint32_t         m_maxEntries = 0;
+    std::list<Entry> m_entries;        //!< Most recently used first
+    MosMutex         m_mutex;
+
+MEDIA_CLASS_DEFINE_END(MediaDmaBufImportCacheNext)
+};
+
+#endif //__MEDIA_LIBVA_IMPORT_CACHE_NEXT_H__
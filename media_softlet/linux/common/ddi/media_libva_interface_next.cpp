@@ -30,6 +30,7 @@
 #endif
 
 #include <drm_fourcc.h>
+#include <fcntl.h>
 
 #include "media_libva_util_next.h"
 #include "media_libva_interface_next.h"
@@ -37,6 +38,9 @@
 #include "mos_utilities.h"
 #include "media_interfaces_mmd_next.h"
 #include "media_libva_caps_next.h"
+#include "media_libva_buffer_pool_next.h"
+#include "media_libva_import_cache_next.h"
+#include "media_libva_shared_device_next.h"
 #include "media_ddi_prot.h"
 #include "media_interfaces_hwinfo_device.h"
 #include "mos_oca_interface_specific.h"
@@ -136,6 +140,17 @@ VAStatus MediaLibvaInterfaceNext::HeapInitialize(PDDI_MEDIA_CONTEXT mediaCtx)
     DDI_CHK_NULL(mediaCtx->pProtCtxHeap, "nullptr pProtCtxHeap", VA_STATUS_ERROR_ALLOCATION_FAILED);
     mediaCtx->pProtCtxHeap->uiHeapElementSize = sizeof(DDI_MEDIA_VACONTEXT_HEAP_ELEMENT);
 
+    // Recycler for CPU backed parameter buffers, optional for callers
+    mediaCtx->pBufferPool = MOS_New(MediaBufferPoolNext);
+
+    uint32_t importCacheEntries = 16;
+    ReadUserSetting(
+        mediaCtx->m_userSettingPtr,
+        importCacheEntries,
+        __MEDIA_USER_FEATURE_VALUE_DMABUF_IMPORT_CACHE_ENTRIES,
+        MediaUserSetting::Group::Device);
+    mediaCtx->pImportCache = MOS_New(MediaDmaBufImportCacheNext, importCacheEntries);
+
     // init the mutexs
     MediaLibvaUtilNext::InitMutex(&mediaCtx->SurfaceMutex);
     MediaLibvaUtilNext::InitMutex(&mediaCtx->BufferMutex);
@@ -389,7 +404,19 @@ VAStatus MediaLibvaInterfaceNext::Initialize (
         return VA_STATUS_ERROR_ALLOCATION_FAILED;
     }
 
-    if (MosInterface::CreateOsDeviceContext(&mosCtx, &mediaCtx->m_osDeviceContext) != MOS_STATUS_SUCCESS)
+    // Displays opened on the same device can opt in to one device context
+    bool shareDevice = false;
+    ReadUserSetting(
+        mediaCtx->m_userSettingPtr,
+        shareDevice,
+        __MEDIA_USER_FEATURE_VALUE_SHARE_DEVICE_CONTEXT,
+        MediaUserSetting::Group::Device);
+    mediaCtx->m_sharedOsDevice = shareDevice;
+
+    MOS_STATUS deviceStatus = shareDevice ?
+        MediaSharedDeviceNext::Acquire(&mosCtx, &mediaCtx->m_osDeviceContext) :
+        MosInterface::CreateOsDeviceContext(&mosCtx, &mediaCtx->m_osDeviceContext);
+    if (deviceStatus != MOS_STATUS_SUCCESS)
     {
         DDI_ASSERTMESSAGE("Unable to create MOS device context.");
         FreeForMediaContext(mediaCtx);
@@ -407,6 +434,14 @@ VAStatus MediaLibvaInterfaceNext::Initialize (
     mediaCtx->m_tileYFlag               = mosCtx.bTileYFlag;
     mediaCtx->bIsAtomSOC                = mosCtx.bIsAtomSOC;
     mediaCtx->perfData                  = mosCtx.pPerfData;
+
+    uint32_t hwSwizzleThreshold = 0x800000;
+    ReadUserSetting(
+        mediaCtx->m_userSettingPtr,
+        hwSwizzleThreshold,
+        __MEDIA_USER_FEATURE_VALUE_HW_SWIZZLE_THRESHOLD,
+        MediaUserSetting::Group::Device);
+    mediaCtx->m_hwSwizzleThreshold = hwSwizzleThreshold;
 #ifdef _MMC_SUPPORTED
     if (mosCtx.ppMediaMemDecompState == nullptr)
     {
@@ -675,25 +710,27 @@ VAStatus MediaLibvaInterfaceNext::HeapDestroy(PDDI_MEDIA_CONTEXT mediaCtx)
 
     DDI_CHK_NULL(mediaCtx, "nullptr ctx", VA_STATUS_ERROR_INVALID_CONTEXT);
     // destroy heaps
-    MOS_FreeMemory(mediaCtx->pSurfaceHeap->pHeapBase);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pSurfaceHeap);
     MOS_FreeMemory(mediaCtx->pSurfaceHeap);
+    MOS_Delete(mediaCtx->pImportCache);
 
-    MOS_FreeMemory(mediaCtx->pBufferHeap->pHeapBase);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pBufferHeap);
     MOS_FreeMemory(mediaCtx->pBufferHeap);
+    MOS_Delete(mediaCtx->pBufferPool);
 
-    MOS_FreeMemory(mediaCtx->pImageHeap->pHeapBase);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pImageHeap);
     MOS_FreeMemory(mediaCtx->pImageHeap);
 
-    MOS_FreeMemory(mediaCtx->pDecoderCtxHeap->pHeapBase);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pDecoderCtxHeap);
     MOS_FreeMemory(mediaCtx->pDecoderCtxHeap);
 
-    MOS_FreeMemory(mediaCtx->pEncoderCtxHeap->pHeapBase);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pEncoderCtxHeap);
     MOS_FreeMemory(mediaCtx->pEncoderCtxHeap);
 
-    MOS_FreeMemory(mediaCtx->pVpCtxHeap->pHeapBase);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pVpCtxHeap);
     MOS_FreeMemory(mediaCtx->pVpCtxHeap);
 
-    MOS_FreeMemory(mediaCtx->pProtCtxHeap->pHeapBase);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pProtCtxHeap);
     MOS_FreeMemory(mediaCtx->pProtCtxHeap);
 
     // destroy the mutexs
@@ -809,7 +846,14 @@ VAStatus MediaLibvaInterfaceNext::Terminate(VADriverContextP ctx)
     HeapDestroy(mediaCtx);
     DdiMediaProtected::FreeInstances();
 
-    MosInterface::DestroyOsDeviceContext(mediaCtx->m_osDeviceContext);
+    if (mediaCtx->m_sharedOsDevice)
+    {
+        MediaSharedDeviceNext::Release(mediaCtx->m_osDeviceContext);
+    }
+    else
+    {
+        MosInterface::DestroyOsDeviceContext(mediaCtx->m_osDeviceContext);
+    }
     mediaCtx->m_osDeviceContext = MOS_INVALID_HANDLE;
     MOS_FreeMemory(mediaCtx->pGtSystemInfo);
     MosOcaInterfaceSpecific::UninitInterface();
@@ -1116,6 +1160,8 @@ VAStatus MediaLibvaInterfaceNext::LoadFunction(VADriverContextP ctx)
     pVTable->vaGetDisplayAttributes          = GetDisplayAttributes;
     pVTable->vaSetDisplayAttributes          = SetDisplayAttributes;
     pVTable->vaQueryProcessingRate           = QueryProcessingRate;
+    // vaCreateMFContext/vaMFAddContext/vaMFSubmit are left unset on purpose: legacy MFE
+    // merges kernel based AVC encodes, VDENC/HuC pipelines encode one frame per pass.
 #if VA_CHECK_VERSION(1,10,0)
     pVTable->vaCopy                          = Copy;
 #endif
@@ -1182,19 +1228,19 @@ VAStatus MediaLibvaInterfaceNext::CreateContext (
         }
     }
 
-    if(mediaDrvCtx->m_capsNext->m_capsTable->IsDecConfigId(configId) && REMOVE_CONFIG_ID_DEC_OFFSET(configId) < mediaDrvCtx->m_capsNext->m_capsTable->m_configList.size())
+    if(mediaDrvCtx->m_capsNext->m_capsTable->IsDecConfigId(configId) && REMOVE_CONFIG_ID_DEC_OFFSET(configId) < mediaDrvCtx->m_capsNext->m_capsTable->GetConfigList()->size())
     {
         DDI_CHK_NULL(mediaDrvCtx->m_compList[CompDecode],  "nullptr complist",  VA_STATUS_ERROR_INVALID_CONTEXT);
         vaStatus = mediaDrvCtx->m_compList[CompDecode]->CreateContext(
             ctx, configId, pictureWidth, pictureHeight, flag, renderTarget, renderTargetsNum, context);
     }
-    else if(mediaDrvCtx->m_capsNext->m_capsTable->IsEncConfigId(configId) && REMOVE_CONFIG_ID_ENC_OFFSET(configId) < mediaDrvCtx->m_capsNext->m_capsTable->m_configList.size())
+    else if(mediaDrvCtx->m_capsNext->m_capsTable->IsEncConfigId(configId) && REMOVE_CONFIG_ID_ENC_OFFSET(configId) < mediaDrvCtx->m_capsNext->m_capsTable->GetConfigList()->size())
     {
         DDI_CHK_NULL(mediaDrvCtx->m_compList[CompEncode],  "nullptr complist",  VA_STATUS_ERROR_INVALID_CONTEXT);
         vaStatus = mediaDrvCtx->m_compList[CompEncode]->CreateContext(
             ctx, configId, pictureWidth, pictureHeight, flag, renderTarget, renderTargetsNum, context);
     }
-    else if(mediaDrvCtx->m_capsNext->m_capsTable->IsVpConfigId(configId) && mediaDrvCtx->m_capsNext->m_capsTable->m_configList.size())
+    else if(mediaDrvCtx->m_capsNext->m_capsTable->IsVpConfigId(configId) && mediaDrvCtx->m_capsNext->m_capsTable->GetConfigList()->size())
     {
         DDI_CHK_NULL(mediaDrvCtx->m_compList[CompVp],  "nullptr complist",  VA_STATUS_ERROR_INVALID_CONTEXT);
         vaStatus = mediaDrvCtx->m_compList[CompVp]->CreateContext(
@@ -1343,12 +1389,58 @@ VAStatus MediaLibvaInterfaceNext::BeginPicture (
     }
     MosUtilities::MosUnlockMutex(&mediaCtx->SurfaceMutex);
 
+    if (ctxType != DDI_MEDIA_CONTEXT_TYPE_DECODER)
+    {
+        FlushAllDecodeBatches(mediaCtx);
+    }
+
     CompType componentIndex = MapComponentFromCtxType(ctxType);
     DDI_CHK_NULL(mediaCtx->m_compList[componentIndex],  "nullptr complist", VA_STATUS_ERROR_INVALID_CONTEXT);
 
     return mediaCtx->m_compList[componentIndex]->BeginPicture(ctx, context, renderTarget);
 }
 
+void MediaLibvaInterfaceNext::FlushDecodeBatch(DDI_MEDIA_SURFACE *surface)
+{
+    if (surface == nullptr || surface->pDecCtx == nullptr ||
+        surface->curCtxType != DDI_MEDIA_CONTEXT_TYPE_DECODER)
+    {
+        return;
+    }
+
+    PDDI_DECODE_CONTEXT    decCtx  = (PDDI_DECODE_CONTEXT)surface->pDecCtx;
+    DecodePipelineAdapter *decoder = dynamic_cast<DecodePipelineAdapter *>(decCtx->pCodecHal);
+    if (decoder != nullptr)
+    {
+        decoder->FlushBatchedFrames();
+    }
+}
+
+void MediaLibvaInterfaceNext::FlushAllDecodeBatches(PDDI_MEDIA_CONTEXT mediaCtx)
+{
+    if (mediaCtx == nullptr || mediaCtx->pDecoderCtxHeap == nullptr || mediaCtx->uiNumDecoders == 0)
+    {
+        return;
+    }
+
+    MosUtilities::MosLockMutex(&mediaCtx->DecoderMutex);
+    PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT decCtxElement = (PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT)mediaCtx->pDecoderCtxHeap->pHeapBase;
+    for (uint32_t i = 0; decCtxElement != nullptr && i < mediaCtx->pDecoderCtxHeap->uiAllocatedHeapElements; i++)
+    {
+        PDDI_DECODE_CONTEXT decCtx = (PDDI_DECODE_CONTEXT)decCtxElement[i].pVaContext;
+        if (decCtx == nullptr)
+        {
+            continue;
+        }
+        DecodePipelineAdapter *decoder = dynamic_cast<DecodePipelineAdapter *>(decCtx->pCodecHal);
+        if (decoder != nullptr)
+        {
+            decoder->FlushBatchedFrames();
+        }
+    }
+    MosUtilities::MosUnlockMutex(&mediaCtx->DecoderMutex);
+}
+
 VAStatus MediaLibvaInterfaceNext::RenderPicture (
     VADriverContextP  ctx,
     VAContextID       context,
@@ -1420,6 +1512,7 @@ VAStatus MediaLibvaInterfaceNext::SyncSurface(
 
     DDI_MEDIA_SURFACE  *surface = MediaLibvaCommonNext::GetSurfaceFromVASurfaceID(mediaCtx, renderTarget);
     DDI_CHK_NULL(surface,    "nullptr surface",      VA_STATUS_ERROR_INVALID_CONTEXT);
+    FlushDecodeBatch(surface);
     if (surface->pCurrentFrameSemaphore)
     {
         MediaLibvaUtilNext::WaitSemaphore(surface->pCurrentFrameSemaphore);
@@ -1489,6 +1582,7 @@ VAStatus MediaLibvaInterfaceNext::PutSurface(
 
     DDI_CHK_NULL(mediaDrvCtx,                      "nullptr mediaDrvCtx",   VA_STATUS_ERROR_INVALID_CONTEXT);
     DDI_CHK_NULL(mediaDrvCtx->m_compList[CompVp],  "nullptr complist",      VA_STATUS_ERROR_INVALID_CONTEXT);
+    FlushAllDecodeBatches(mediaDrvCtx);
 
     return mediaDrvCtx->m_compList[CompVp]->PutSurface(ctx, surface, draw, srcx, srcy, srcw, srch, destx, desty, destw, desth, cliprects, numberCliprects, flags);
 }
@@ -1559,9 +1653,26 @@ void MediaLibvaInterfaceNext::CopyPlane(
     uint32_t dstPitch,
     uint8_t  *src,
     uint32_t srcPitch,
-    uint32_t height)
+    uint32_t height,
+    bool     srcUncached)
 {
     uint32_t rowSize = std::min(dstPitch, srcPitch);
+    if (srcUncached)
+    {
+        if (dstPitch == srcPitch)
+        {
+            MosUtilities::MosStreamingMemcpy(dst, src, (size_t)rowSize * height);
+            return;
+        }
+        for (uint32_t y = 0; y < height; y += 1)
+        {
+            MosUtilities::MosStreamingMemcpy(dst, src, rowSize);
+            dst += dstPitch;
+            src += srcPitch;
+        }
+        return;
+    }
+
     for (int y = 0; y < height; y += 1)
     {
         MOS_SecureMemcpy(dst, rowSize, src, rowSize);
@@ -1641,7 +1752,9 @@ VAStatus MediaLibvaInterfaceNext::CopySurfaceToImage(
         ySrc = (uint8_t*)surfData;
     }
 
-    CopyPlane(yDst, image->pitches[0], ySrc, surface->iPitch, image->height);
+    // ySrc is a GPU mapping unless it was swizzled into system memory
+    bool srcUncached = (swizzleData == nullptr) && (surfData != surface->pSystemShadow);
+    CopyPlane(yDst, image->pitches[0], ySrc, surface->iPitch, image->height, srcUncached);
     if (image->num_planes > 1)
     {
         uint8_t *uSrc = ySrc + surface->iPitch * surface->iHeight;
@@ -1652,13 +1765,13 @@ VAStatus MediaLibvaInterfaceNext::CopySurfaceToImage(
         uint32_t imageChromaHeight = 0;
         GetChromaPitchHeight(MediaFormatToOsFormat(surface->format), surface->iPitch, surface->iHeight, &chromaPitch, &chromaHeight);
         GetChromaPitchHeight(image->format.fourcc, image->pitches[0], image->height, &imageChromaPitch, &imageChromaHeight);
-        CopyPlane(uDst, image->pitches[1], uSrc, chromaPitch, imageChromaHeight);
+        CopyPlane(uDst, image->pitches[1], uSrc, chromaPitch, imageChromaHeight, srcUncached);
 
         if(image->num_planes > 2)
         {
             uint8_t *vSrc = uSrc + chromaPitch * chromaHeight;
             uint8_t *vDst = yDst + image->offsets[2];
-            CopyPlane(vDst, image->pitches[2], vSrc, chromaPitch, imageChromaHeight);
+            CopyPlane(vDst, image->pitches[2], vSrc, chromaPitch, imageChromaHeight, srcUncached);
         }
     }
 
@@ -1714,6 +1827,7 @@ VAStatus MediaLibvaInterfaceNext::GetImage(
     DDI_MEDIA_SURFACE *inputSurface = MediaLibvaCommonNext::GetSurfaceFromVASurfaceID(mediaCtx, surface);
     DDI_CHK_NULL(inputSurface,     "nullptr inputSurface.",      VA_STATUS_ERROR_INVALID_SURFACE);
     DDI_CHK_NULL(inputSurface->bo, "nullptr inputSurface->bo.",  VA_STATUS_ERROR_INVALID_SURFACE);
+    FlushDecodeBatch(inputSurface);
 
     VAStatus vaStatus = VA_STATUS_SUCCESS;
 #ifndef _FULL_OPEN_SOURCE
@@ -2556,6 +2670,8 @@ VAStatus MediaLibvaInterfaceNext::BufferSetNumElements(
         buf->iSize = buf->iSize / buf->uiNumElements;
         buf->pData = (uint8_t*)MOS_AllocAndZeroMemory(buf->iSize * elementsNum);
         buf->iSize = buf->iSize * elementsNum;
+        // the block no longer comes from the buffer pool
+        buf->uiPoolCapacity = 0;
     }
 
     return VA_STATUS_SUCCESS;
@@ -2798,6 +2914,7 @@ VAStatus MediaLibvaInterfaceNext::DeriveImage (
 
     DDI_MEDIA_SURFACE *mediaSurface = MediaLibvaCommonNext::GetSurfaceFromVASurfaceID(mediaCtx, surface);
     DDI_CHK_NULL(mediaSurface, "nullptr mediaSurface", VA_STATUS_ERROR_INVALID_SURFACE);
+    FlushDecodeBatch(mediaSurface);
 
     VAImage *vaimg                  = (VAImage*)MOS_AllocAndZeroMemory(sizeof(VAImage));
     DDI_CHK_NULL(vaimg, "nullptr vaimg", VA_STATUS_ERROR_ALLOCATION_FAILED);
@@ -2907,6 +3024,7 @@ VAStatus MediaLibvaInterfaceNext::SyncSurface2 (
 
     DDI_MEDIA_SURFACE  *surface = MediaLibvaCommonNext::GetSurfaceFromVASurfaceID(mediaCtx, surfaceId);
     DDI_CHK_NULL(surface,    "nullptr surface",      VA_STATUS_ERROR_INVALID_CONTEXT);
+    FlushDecodeBatch(surface);
     if (surface->pCurrentFrameSemaphore)
     {
         MediaLibvaUtilNext::WaitSemaphore(surface->pCurrentFrameSemaphore);
@@ -3055,6 +3173,7 @@ VAStatus MediaLibvaInterfaceNext::QuerySurfaceStatus (
     DDI_CHK_LESS((uint32_t)renderTarget, mediaCtx->pSurfaceHeap->uiAllocatedHeapElements, "Invalid renderTarget", VA_STATUS_ERROR_INVALID_SURFACE);
     DDI_MEDIA_SURFACE *surface   = MediaLibvaCommonNext::GetSurfaceFromVASurfaceID(mediaCtx, renderTarget);
     DDI_CHK_NULL(surface,    "nullptr surface",    VA_STATUS_ERROR_INVALID_SURFACE);
+    FlushDecodeBatch(surface);
 
     if (surface->pCurrentFrameSemaphore)
     {
@@ -3875,6 +3994,70 @@ VAStatus MediaLibvaInterfaceNext::InitSurfaceDescriptorWithAuxTableMgr(
     return VA_STATUS_SUCCESS;
 }
 
+bool MediaLibvaInterfaceNext::GetCachedExportDescriptor(
+    PDDI_MEDIA_CONTEXT          mediaCtx,
+    DDI_MEDIA_SURFACE           *mediaSurface,
+    uint32_t                    flags,
+    VADRMPRIMESurfaceDescriptor *desc)
+{
+    bool hit = false;
+
+    MosUtilities::MosLockMutex(&mediaCtx->SurfaceMutex);
+    if (mediaSurface->pExportDesc != nullptr     &&
+        mediaSurface->pExportBo == mediaSurface->bo &&
+        mediaSurface->uiExportFlags == flags)
+    {
+        // Same dma-buf as a fresh export of the bo, without the prime ioctl
+        int32_t fd = fcntl(mediaSurface->pExportDesc->objects[0].fd, F_DUPFD_CLOEXEC, 0);
+        if (fd >= 0)
+        {
+            *desc               = *mediaSurface->pExportDesc;
+            desc->objects[0].fd = fd;
+            mediaSurface->name  = fd;
+            hit                 = true;
+        }
+    }
+    MosUtilities::MosUnlockMutex(&mediaCtx->SurfaceMutex);
+
+    return hit;
+}
+
+void MediaLibvaInterfaceNext::CacheExportDescriptor(
+    PDDI_MEDIA_CONTEXT          mediaCtx,
+    DDI_MEDIA_SURFACE           *mediaSurface,
+    uint32_t                    flags,
+    VADRMPRIMESurfaceDescriptor *desc)
+{
+    // The application owns desc->objects[0].fd, keep a private one
+    int32_t fd = fcntl(desc->objects[0].fd, F_DUPFD_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        return;
+    }
+
+    MosUtilities::MosLockMutex(&mediaCtx->SurfaceMutex);
+    if (mediaSurface->pExportDesc == nullptr)
+    {
+        mediaSurface->pExportDesc = (VADRMPRIMESurfaceDescriptor *)MOS_AllocAndZeroMemory(sizeof(VADRMPRIMESurfaceDescriptor));
+    }
+    else
+    {
+        close(mediaSurface->pExportDesc->objects[0].fd);
+    }
+
+    if (mediaSurface->pExportDesc == nullptr)
+    {
+        MosUtilities::MosUnlockMutex(&mediaCtx->SurfaceMutex);
+        close(fd);
+        return;
+    }
+    *mediaSurface->pExportDesc               = *desc;
+    mediaSurface->pExportDesc->objects[0].fd = fd;
+    mediaSurface->uiExportFlags              = flags;
+    mediaSurface->pExportBo                  = mediaSurface->bo;
+    MosUtilities::MosUnlockMutex(&mediaCtx->SurfaceMutex);
+}
+
 VAStatus MediaLibvaInterfaceNext::ExportSurfaceHandle(
     VADriverContextP ctx,
     VASurfaceID      surfaceId,
@@ -3898,19 +4081,27 @@ VAStatus MediaLibvaInterfaceNext::ExportSurfaceHandle(
     DDI_CHK_NULL(mediaSurface,                   "nullptr mediaSurface",                   VA_STATUS_ERROR_INVALID_SURFACE);
     DDI_CHK_NULL(mediaSurface->bo,               "nullptr mediaSurface->bo",               VA_STATUS_ERROR_INVALID_SURFACE);
     DDI_CHK_NULL(mediaSurface->pGmmResourceInfo, "nullptr mediaSurface->pGmmResourceInfo", VA_STATUS_ERROR_INVALID_SURFACE);
+    FlushDecodeBatch(mediaSurface);
 
     if (memType != VA_SURFACE_ATTRIB_MEM_TYPE_DRM_PRIME_2) {
         DDI_ASSERTMESSAGE("vaExportSurfaceHandle: memory type %08x is not supported.\n", memType);
         return VA_STATUS_ERROR_UNSUPPORTED_MEMORY_TYPE;
     }
 
+    VADRMPRIMESurfaceDescriptor *desc = (VADRMPRIMESurfaceDescriptor *)descriptor;
+
+    // Repeated exports of an unchanged surface skip the layout queries
+    if (GetCachedExportDescriptor(mediaCtx, mediaSurface, flags, desc))
+    {
+        return VA_STATUS_SUCCESS;
+    }
+
     if (mos_bo_gem_export_to_prime(mediaSurface->bo, (int32_t*)&mediaSurface->name))
     {
         DDI_ASSERTMESSAGE("Failed drm_intel_gem_export_to_prime operation!!!\n");
         return VA_STATUS_ERROR_OPERATION_FAILED;
     }
 
-    VADRMPRIMESurfaceDescriptor *desc = (VADRMPRIMESurfaceDescriptor *)descriptor;
     desc->fourcc = MediaFormatToOsFormat(mediaSurface->format);
     if(desc->fourcc == VA_STATUS_ERROR_UNSUPPORTED_RT_FORMAT)
     {
@@ -3990,6 +4181,11 @@ VAStatus MediaLibvaInterfaceNext::ExportSurfaceHandle(
             offsetY, offsetU, offsetV, pitch, chromaPitch);
     }
 
+    if (status == VA_STATUS_SUCCESS)
+    {
+        CacheExportDescriptor(mediaCtx, mediaSurface, flags, desc);
+    }
+
     return status;
 }
 
@@ -5181,10 +5377,14 @@ VAStatus MediaLibvaInterfaceNext::Copy(
 
     vaStatus = CopyInternal(&mosCtx, &src, &dst, option.bits.va_copy_mode);
 
-    if ((option.bits.va_copy_sync == VA_EXEC_SYNC) && dst_surface)
+    // VA_EXEC_ASYNC returns as soon as the copy is submitted; completion is then
+    // observed through the implicit fence of the destination bo (vaSyncSurface /
+    // vaSyncBuffer or an exported handle), so only the sync mode waits here.
+    MOS_LINUX_BO *dstBo = dst_surface ? dst_surface->bo : (dst_buffer ? dst_buffer->bo : nullptr);
+    if ((option.bits.va_copy_sync == VA_EXEC_SYNC) && dstBo)
     {
         uint32_t timeout_NS = 100000000;
-        while (0 != mos_gem_bo_wait(dst_surface->bo, timeout_NS))
+        while (0 != mos_gem_bo_wait(dstBo, timeout_NS))
         {
             // Just loop while gem_bo_wait times-out.
         }
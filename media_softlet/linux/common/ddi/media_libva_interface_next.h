@@ -1077,6 +1077,11 @@ public:
  
     //!
     //! \brief API for export surface handle to other component
+    //! \details The surface is exported as is, never decompressed. With an aux
+    //!          table a compressed surface carries its CCS modifier and aux planes.
+    //!          Importers that cannot take CCS choose a plain modifier when the
+    //!          surface is created from a DRM_PRIME_2 descriptor, and libva has no
+    //!          per export negotiation.
     //!
     //! \param [in] dpy
     //!        VA display.
@@ -1510,6 +1515,23 @@ public:
         VASurfaceID        surface);
 private:
 
+    //!
+    //! \brief  Submit the batched decode frames of the context which wrote surface
+    //!
+    //! \param  [in] surface
+    //!         Surface about to be read
+    //!
+    static void FlushDecodeBatch(DDI_MEDIA_SURFACE *surface);
+
+    //!
+    //! \brief  Submit the batched frames of every decode context
+    //! \details Called before other components consume decoded surfaces
+    //!
+    //! \param  [in] mediaCtx
+    //!         Pointer to media context
+    //!
+    static void FlushAllDecodeBatches(PDDI_MEDIA_CONTEXT mediaCtx);
+
     //!
     //! \brief  Copy Surface To Image
     //!
@@ -1541,13 +1563,16 @@ private:
     //!         Source plane pitch
     //! \param  [in] height
     //!         Plane hight
+    //! \param  [in] srcUncached
+    //!         Source is a WC/uncached mapping, read it with streaming loads
     //!
     static void CopyPlane(
         uint8_t  *dst,
         uint32_t dstPitch,
         uint8_t  *src,
         uint32_t srcPitch,
-        uint32_t height);
+        uint32_t height,
+        bool     srcUncached = false);
 
     //!
     //! \brief  Map CompType from entrypoint
@@ -2037,6 +2062,45 @@ private:
         uint32_t                    auxOffsetUV,
         int32_t                     pitch);
 
+    //!
+    //! \brief  Fill desc from the layout cached on the surface by a previous export
+    //!
+    //! \param  [in] mediaCtx
+    //!         Media context
+    //! \param  [in] mediaSurface
+    //!         Media surface
+    //! \param  [in] flags
+    //!         Export flags
+    //! \param  [out] desc
+    //!         SurfaceDescriptor, objects[0].fd is a new duplicate of the cached prime fd
+    //!
+    //! \return bool
+    //!     true if the cache matched the surface bo and flags
+    //!
+    static bool GetCachedExportDescriptor(
+        PDDI_MEDIA_CONTEXT          mediaCtx,
+        DDI_MEDIA_SURFACE           *mediaSurface,
+        uint32_t                    flags,
+        VADRMPRIMESurfaceDescriptor *desc);
+
+    //!
+    //! \brief  Cache desc on the surface together with a private duplicate of its prime fd
+    //!
+    //! \param  [in] mediaCtx
+    //!         Media context
+    //! \param  [in] mediaSurface
+    //!         Media surface
+    //! \param  [in] flags
+    //!         Export flags
+    //! \param  [in] desc
+    //!         SurfaceDescriptor just returned to the application
+    //!
+    static void CacheExportDescriptor(
+        PDDI_MEDIA_CONTEXT          mediaCtx,
+        DDI_MEDIA_SURFACE           *mediaSurface,
+        uint32_t                    flags,
+        VADRMPRIMESurfaceDescriptor *desc);
+
     //!
     //! \brief  Generate Vaimg From input Media format
     //!
@@ -2185,6 +2249,10 @@ public:
 
     //!
     //! \brief  Decompress a compressed surface.
+    //! \details The resolve is in place and the GMM compression state of the surface is
+    //!          left as is, since later GPU writes compress it again without passing
+    //!          through the DDI. There is no per surface record of whether content
+    //!          changed since the last resolve, so every CPU access resolves again.
     //!
     //! \param  [in]  mediaCtx
     //!         Pointer to ddi media context
@@ -0,0 +1,70 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     media_libva_lib_preload_next.cpp
+//! \brief    Loads optional shared libraries on a worker thread during vaInitialize
+//!
+
+#include "media_libva_lib_preload_next.h"
+
+MediaLibPreloadNext::MediaLibPreloadNext(const char *const *libNames) :
+    m_libNames(libNames)
+{
+    m_thread       = MosUtilities::MosCreateThread((void *)LoadLibraries, this);
+    m_threadActive = (m_thread != 0);
+}
+
+MediaLibPreloadNext::~MediaLibPreloadNext()
+{
+    Wait();
+
+    for (uint32_t i = 0; i < MEDIA_LIB_PRELOAD_MAX_LIBS; i++)
+    {
+        if (m_modules[i] != nullptr)
+        {
+            MosUtilities::MosFreeLibrary(m_modules[i]);
+            m_modules[i] = nullptr;
+        }
+    }
+}
+
+void MediaLibPreloadNext::Wait()
+{
+    if (m_threadActive)
+    {
+        MosUtilities::MosWaitThread(m_thread);
+        m_threadActive = false;
+    }
+}
+
+void *MediaLibPreloadNext::LoadLibraries(void *data)
+{
+    MediaLibPreloadNext *preload = (MediaLibPreloadNext *)data;
+
+    // A library that fails to load here fails again, and is reported, in its real load
+    for (uint32_t i = 0; i < MEDIA_LIB_PRELOAD_MAX_LIBS && preload->m_libNames[i] != nullptr; i++)
+    {
+        MosUtilities::MosLoadLibrary(preload->m_libNames[i], &preload->m_modules[i]);
+    }
+
+    return nullptr;
+}
@@ -0,0 +1,70 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     media_libva_lib_preload_next.h
+//! \brief    Loads optional shared libraries on a worker thread during vaInitialize
+//!
+
+#ifndef __MEDIA_LIBVA_LIB_PRELOAD_NEXT_H__
+#define __MEDIA_LIBVA_LIB_PRELOAD_NEXT_H__
+
+#include "mos_utilities.h"
+
+#define MEDIA_LIB_PRELOAD_MAX_LIBS 4
+
+//!
+//! \class  MediaLibPreloadNext
+//! \brief  dlopen()s a few libraries in the background while the device is
+//!         being initialized, so the later synchronous loads of the same
+//!         libraries (X11 and DRI output) only take a reference.
+//! \details The worker touches nothing but this object, so the owner may
+//!         bail out of initialization at any point; the destructor waits for
+//!         the worker and drops the preload references.
+//!
+class MediaLibPreloadNext
+{
+public:
+    //!
+    //! \param  [in] libNames
+    //!         nullptr terminated list of library names, must outlive the object
+    //!
+    MediaLibPreloadNext(const char *const *libNames);
+
+    ~MediaLibPreloadNext();
+
+    //!
+    //! \brief  Block until the worker has finished loading
+    //!
+    void Wait();
+
+private:
+    static void *LoadLibraries(void *data);
+
+    const char *const *m_libNames                            = nullptr;
+    HMODULE           m_modules[MEDIA_LIB_PRELOAD_MAX_LIBS]  = {};
+    MOS_THREADHANDLE  m_thread                               = 0;
+    bool              m_threadActive                         = false;
+
+MEDIA_CLASS_DEFINE_END(MediaLibPreloadNext)
+};
+
+#endif //__MEDIA_LIBVA_LIB_PRELOAD_NEXT_H__
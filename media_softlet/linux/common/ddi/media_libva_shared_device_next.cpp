@@ -0,0 +1,130 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     media_libva_shared_device_next.cpp
+//! \brief    Process wide MOS device contexts shared between VADisplays
+//!
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "media_libva_shared_device_next.h"
+#include "mos_interface.h"
+#include "media_libva_util_next.h"
+
+std::vector<MediaSharedDeviceNext::Device *> MediaSharedDeviceNext::m_devices;
+MosMutex                                     MediaSharedDeviceNext::m_mutex;
+
+MOS_STATUS MediaSharedDeviceNext::Acquire(PMOS_CONTEXT mosCtx, MOS_DEVICE_HANDLE *deviceContext)
+{
+    DDI_CHK_NULL(mosCtx,        "nullptr mosCtx",        MOS_STATUS_NULL_POINTER);
+    DDI_CHK_NULL(deviceContext, "nullptr deviceContext", MOS_STATUS_NULL_POINTER);
+
+    struct stat st = {};
+    if (fstat(mosCtx->fd, &st) != 0)
+    {
+        DDI_ASSERTMESSAGE("Unable to stat device fd %d.", mosCtx->fd);
+        return MOS_STATUS_INVALID_HANDLE;
+    }
+
+    m_mutex.Lock();
+    for (auto device : m_devices)
+    {
+        if (device->rdev == (uint64_t)st.st_rdev)
+        {
+            int32_t                   fd             = mosCtx->fd;
+            MediaUserSettingSharedPtr userSettingPtr = mosCtx->m_userSettingPtr;
+
+            *mosCtx                  = device->mosCtx;
+            mosCtx->fd               = fd;
+            mosCtx->m_userSettingPtr = userSettingPtr;
+            *deviceContext           = device->deviceContext;
+            device->refCount++;
+            m_mutex.Unlock();
+            return MOS_STATUS_SUCCESS;
+        }
+    }
+
+    Device *device = MOS_New(Device);
+    if (device == nullptr)
+    {
+        m_mutex.Unlock();
+        return MOS_STATUS_NO_SPACE;
+    }
+
+    int32_t appFd = mosCtx->fd;
+    device->rdev  = (uint64_t)st.st_rdev;
+    device->fd    = fcntl(appFd, F_DUPFD_CLOEXEC, 0);
+    if (device->fd < 0)
+    {
+        m_mutex.Unlock();
+        MOS_Delete(device);
+        return MOS_STATUS_INVALID_HANDLE;
+    }
+
+    mosCtx->fd        = device->fd;
+    MOS_STATUS status = MosInterface::CreateOsDeviceContext(mosCtx, &device->deviceContext);
+    if (status != MOS_STATUS_SUCCESS)
+    {
+        m_mutex.Unlock();
+        mosCtx->fd = appFd;
+        close(device->fd);
+        MOS_Delete(device);
+        return status;
+    }
+
+    device->mosCtx   = *mosCtx;
+    device->refCount = 1;
+    m_devices.push_back(device);
+    *deviceContext   = device->deviceContext;
+    m_mutex.Unlock();
+
+    mosCtx->fd = appFd;
+    return MOS_STATUS_SUCCESS;
+}
+
+void MediaSharedDeviceNext::Release(MOS_DEVICE_HANDLE deviceContext)
+{
+    Device *last = nullptr;
+
+    m_mutex.Lock();
+    for (auto it = m_devices.begin(); it != m_devices.end(); ++it)
+    {
+        if ((*it)->deviceContext == deviceContext)
+        {
+            if (--(*it)->refCount == 0)
+            {
+                last = *it;
+                m_devices.erase(it);
+            }
+            break;
+        }
+    }
+    m_mutex.Unlock();
+
+    if (last != nullptr)
+    {
+        MosInterface::DestroyOsDeviceContext(last->deviceContext);
+        close(last->fd);
+        MOS_Delete(last);
+    }
+}
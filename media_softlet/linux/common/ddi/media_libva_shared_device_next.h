@@ -0,0 +1,85 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     media_libva_shared_device_next.h
+//! \brief    Process wide MOS device contexts shared between VADisplays
+//!
+
+#ifndef __MEDIA_LIBVA_SHARED_DEVICE_NEXT_H__
+#define __MEDIA_LIBVA_SHARED_DEVICE_NEXT_H__
+
+#include <vector>
+#include "mos_os_specific.h"
+#include "mos_utilities.h"
+
+//!
+//! \class  MediaSharedDeviceNext
+//! \brief  Reference counts one MOS device context (bufmgr, GMM client
+//!         context, SKU/WA tables, aux table manager) per DRM device node,
+//!         so displays opened on the same node in one process reuse it
+//!         instead of building their own.
+//! \details The device context is created on a private duplicate of the
+//!         first display's fd, so it stays valid when that display is
+//!         terminated and the application closes its fd.
+//!
+class MediaSharedDeviceNext
+{
+public:
+    //!
+    //! \brief  Get the device context for mosCtx->fd, creating it if needed
+    //!
+    //! \param  [in,out] mosCtx
+    //!         MOS context with fd and m_userSettingPtr set, receives the
+    //!         device outputs (bufmgr, tables, GMM client context ...)
+    //! \param  [out] deviceContext
+    //!         Shared device context, release with Release
+    //!
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    static MOS_STATUS Acquire(PMOS_CONTEXT mosCtx, MOS_DEVICE_HANDLE *deviceContext);
+
+    //!
+    //! \brief  Drop one reference, destroying the context with the last one
+    //!
+    //! \param  [in] deviceContext
+    //!         Device context obtained from Acquire
+    //!
+    static void Release(MOS_DEVICE_HANDLE deviceContext);
+
+private:
+    struct Device
+    {
+        uint64_t          rdev          = 0;
+        int32_t           fd            = -1;        //!< Private duplicate the context was created on
+        uint32_t          refCount      = 0;
+        MOS_DEVICE_HANDLE deviceContext = nullptr;
+        MOS_CONTEXT       mosCtx        = {};        //!< Outputs of CreateOsDeviceContext
+    };
+
+    static std::vector<Device *> m_devices;
+    static MosMutex              m_mutex;
+
+MEDIA_CLASS_DEFINE_END(MediaSharedDeviceNext)
+};
+
+#endif //__MEDIA_LIBVA_SHARED_DEVICE_NEXT_H__
@@ -24,8 +24,10 @@
 //! \brief    libva util next implementaion.
 //!
 #include <sys/time.h>
+#include <unistd.h>
 #include "inttypes.h"
 #include "media_libva_util_next.h"
+#include "media_libva_import_cache_next.h"
 #include "mos_utilities.h"
 #include "mos_os.h"
 #include "mos_defs.h"
@@ -472,10 +474,16 @@ VAStatus MediaLibvaUtilNext::CreateExternalSurface(
             bo = mos_bo_gem_create_from_name(mediaDrvCtx->pDrmBufMgr, "MEDIA", mediaSurface->pSurfDesc->ulBuffer);
             break;
         case VA_SURFACE_ATTRIB_MEM_TYPE_DRM_PRIME:
-            bo = mos_bo_gem_create_from_prime(mediaDrvCtx->pDrmBufMgr, mediaSurface->pSurfDesc->ulBuffer, mediaSurface->pSurfDesc->uiSize);
-            break;
         case VA_SURFACE_ATTRIB_MEM_TYPE_DRM_PRIME_2:
-            bo = mos_bo_gem_create_from_prime(mediaDrvCtx->pDrmBufMgr, mediaSurface->pSurfDesc->ulBuffer, mediaSurface->pSurfDesc->uiSize);
+            // Re-imports of a dma-buf already seen come back from the cache
+            if (mediaDrvCtx->pImportCache)
+            {
+                bo = mediaDrvCtx->pImportCache->Import(mediaDrvCtx->pDrmBufMgr, mediaSurface->pSurfDesc->ulBuffer, mediaSurface->pSurfDesc->uiSize);
+            }
+            else
+            {
+                bo = mos_bo_gem_create_from_prime(mediaDrvCtx->pDrmBufMgr, mediaSurface->pSurfDesc->ulBuffer, mediaSurface->pSurfDesc->uiSize);
+            }
             break;
         case VA_SURFACE_ATTRIB_MEM_TYPE_USER_PTR:
 #ifdef DRM_IOCTL_I915_GEM_USERPTR
@@ -823,14 +831,11 @@ PDDI_MEDIA_SURFACE_HEAP_ELEMENT MediaLibvaUtilNext::AllocPMediaSurfaceFromHeap(P
 
     if (nullptr == surfaceHeap->pFirstFreeHeapElement)
     {
-        void *newHeapBase = MOS_ReallocMemory(surfaceHeap->pHeapBase, (surfaceHeap->uiAllocatedHeapElements + DDI_MEDIA_HEAP_INCREMENTAL_SIZE) * sizeof(DDI_MEDIA_SURFACE_HEAP_ELEMENT));
-
-        if (nullptr == newHeapBase)
+        if (nullptr == MediaLibvaCommonNext::GrowHeap(surfaceHeap, sizeof(DDI_MEDIA_SURFACE_HEAP_ELEMENT), DDI_MEDIA_HEAP_INCREMENTAL_SIZE))
         {
-            DDI_ASSERTMESSAGE("DDI: realloc failed.");
+            DDI_ASSERTMESSAGE("DDI: heap grow failed.");
             return nullptr;
         }
-        surfaceHeap->pHeapBase                    = newHeapBase;
         PDDI_MEDIA_SURFACE_HEAP_ELEMENT surfaceHeapBase  = (PDDI_MEDIA_SURFACE_HEAP_ELEMENT)surfaceHeap->pHeapBase;
         surfaceHeap->pFirstFreeHeapElement        = (void*)(&surfaceHeapBase[surfaceHeap->uiAllocatedHeapElements]);
         for (int32_t i = 0; i < (DDI_MEDIA_HEAP_INCREMENTAL_SIZE); i++)
@@ -1052,6 +1057,23 @@ void MediaLibvaUtilNext::FreeSurface(DDI_MEDIA_SURFACE *surface)
         UnlockSurface(surface);
         DDI_VERBOSEMESSAGE("DDI: try to free a locked surface.");
     }
+
+    if (surface->pShadowBuffer != nullptr)
+    {
+        mos_bo_unmap(surface->pShadowBuffer->bo);
+        FreeBuffer(surface->pShadowBuffer);
+        MOS_Delete(surface->pShadowBuffer);
+        surface->pShadowBuffer = nullptr;
+    }
+
+    // Drop the cached export layout and its private prime fd
+    if (surface->pExportDesc != nullptr)
+    {
+        close(surface->pExportDesc->objects[0].fd);
+        MOS_FreeMemory(surface->pExportDesc);
+        surface->pExportDesc = nullptr;
+        surface->pExportBo   = nullptr;
+    }
     mos_bo_unreference(surface->bo);
     // For External Buffer, only needs to destory SurfaceDescriptor
     if (surface->pSurfDesc)
@@ -1157,7 +1179,11 @@ void* MediaLibvaUtilNext::LockSurfaceInternal(DDI_MEDIA_SURFACE  *surface, uint3
             DDI_CHK_CONDITION((surface->TileType != I915_TILING_Y), "Unsupported tile type", nullptr);
             DDI_CHK_CONDITION((surfSize <= 0 || surface->iPitch <= 0), "Invalid surface size or pitch", nullptr);
 
-            if (MEDIA_IS_SKU(&surface->pMediaCtx->SkuTable, FtrLocalMemory))
+            // Large surfaces are cheaper to detile with a GPU copy into a linear
+            // staging BO than with the CPU swizzle below
+            uint32_t hwSwizzleThreshold = surface->pMediaCtx->m_hwSwizzleThreshold;
+            if (MEDIA_IS_SKU(&surface->pMediaCtx->SkuTable, FtrLocalMemory) ||
+                (hwSwizzleThreshold != 0 && surfSize >= hwSwizzleThreshold))
             {
                 if (surface->pShadowBuffer == nullptr)
                 {
@@ -1258,13 +1284,14 @@ void MediaLibvaUtilNext::UnlockSurface(DDI_MEDIA_SURFACE  *surface)
             }
             else if (surface->pShadowBuffer != nullptr)
             {
-                SwizzleSurfaceByHW(surface, true);
-
-                mos_bo_unmap(surface->pShadowBuffer->bo);
-                FreeBuffer(surface->pShadowBuffer);
-                MOS_FreeMemory(surface->pShadowBuffer);
-                surface->pShadowBuffer = nullptr;
+                // Read only locks leave the surface untouched, skip the copy back
+                if (!(surface->uiMapFlag & MOS_LOCKFLAG_READONLY) || (surface->uiMapFlag & MOS_LOCKFLAG_WRITEONLY))
+                {
+                    SwizzleSurfaceByHW(surface, true);
+                }
 
+                // The staging BO stays allocated and mapped for the next lock,
+                // it is released with the surface
                 mos_bo_unmap(surface->bo);
             }
             else if (surface->pSystemShadow)
@@ -1457,6 +1484,27 @@ VAStatus MediaLibvaUtilNext::SwizzleSurface(
     uiPicHeight = pGmmResInfo->GetBaseHeight();
     uiSize      = pGmmResInfo->GetSizeSurface();
     uiPitch     = pGmmResInfo->GetRenderPitch();
+
+    // Legacy TileX/TileY without Yf/Ys is a plain swizzle of whole tile
+    // lines, which MosSwizzleData does far faster than the generic CpuBlt
+    GMM_TILE_TYPE     gmmTileType = pGmmResInfo->GetTileType();
+    GMM_RESOURCE_FLAG gmmFlags    = pGmmResInfo->GetResFlags();
+    if ((gmmTileType == GMM_TILED_Y || gmmTileType == GMM_TILED_X) &&
+        !gmmFlags.Info.TiledYf && !gmmFlags.Info.TiledYs &&
+        uiPitch != 0 && (uiSize % uiPitch) == 0)
+    {
+        MOS_TILE_TYPE tiling = (gmmTileType == GMM_TILED_Y) ? MOS_TILE_Y : MOS_TILE_X;
+        if (bUpload)
+        {
+            MosUtilities::MosSwizzleData(pResourceBase, (uint8_t *)pLockedAddr, MOS_TILE_LINEAR, tiling, uiSize / uiPitch, uiPitch, 0);
+        }
+        else
+        {
+            MosUtilities::MosSwizzleData((uint8_t *)pLockedAddr, pResourceBase, tiling, MOS_TILE_LINEAR, uiSize / uiPitch, uiPitch, 0);
+        }
+        return vaStatus;
+    }
+
     gmmResCopyBlt.Gpu.pData      = pLockedAddr;
     gmmResCopyBlt.Sys.pData      = pResourceBase;
     gmmResCopyBlt.Sys.RowPitch   = uiPitch;
@@ -1728,6 +1776,12 @@ VAStatus MediaLibvaUtilNext::AllocateBuffer(
         mediaBuffer->bo         = bo;
         mediaBuffer->pData      = (uint8_t*) bo->virt;
 
+        // Coded buffers are read back by the CPU every frame
+        if (mediaBuffer->uiType == VAEncCodedBufferType)
+        {
+            mos_gem_bo_set_map_hot(bo, true);
+        }
+
         DDI_VERBOSEMESSAGE("Alloc %8d bytes resource.",size);
         uint32_t event[] = {bo->handle, format, size, 1, size, bo->size, 0, 0};
         MOS_TraceEventExt(EVENT_VA_BUFFER, EVENT_TYPE_INFO, event, sizeof(event), &mediaBuffer->pGmmResourceInfo->GetResFlags(), sizeof(GMM_RESOURCE_FLAG));
@@ -1749,13 +1803,11 @@ PDDI_MEDIA_BUFFER_HEAP_ELEMENT MediaLibvaUtilNext::AllocPMediaBufferFromHeap(PDD
     PDDI_MEDIA_BUFFER_HEAP_ELEMENT  mediaBufferHeapElmt = nullptr;
     if (nullptr == bufferHeap->pFirstFreeHeapElement)
     {
-        void *newHeapBase = MOS_ReallocMemory(bufferHeap->pHeapBase, (bufferHeap->uiAllocatedHeapElements + DDI_MEDIA_HEAP_INCREMENTAL_SIZE) * sizeof(DDI_MEDIA_BUFFER_HEAP_ELEMENT));
-        if (nullptr == newHeapBase)
+        if (nullptr == MediaLibvaCommonNext::GrowHeap(bufferHeap, sizeof(DDI_MEDIA_BUFFER_HEAP_ELEMENT), DDI_MEDIA_HEAP_INCREMENTAL_SIZE))
         {
-            DDI_ASSERTMESSAGE("DDI: realloc failed.");
+            DDI_ASSERTMESSAGE("DDI: heap grow failed.");
             return nullptr;
         }
-        bufferHeap->pHeapBase                                 = newHeapBase;
         PDDI_MEDIA_BUFFER_HEAP_ELEMENT mediaBufferHeapBase    = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)bufferHeap->pHeapBase;
         bufferHeap->pFirstFreeHeapElement     = (void*)(&mediaBufferHeapBase[bufferHeap->uiAllocatedHeapElements]);
         for (int32_t i = 0; i < (DDI_MEDIA_HEAP_INCREMENTAL_SIZE); i++)
@@ -1780,14 +1832,11 @@ PDDI_MEDIA_IMAGE_HEAP_ELEMENT MediaLibvaUtilNext::AllocPVAImageFromHeap(PDDI_MED
 
     if (nullptr == imageHeap->pFirstFreeHeapElement)
     {
-        void *newHeapBase = MOS_ReallocMemory(imageHeap->pHeapBase, (imageHeap->uiAllocatedHeapElements + DDI_MEDIA_HEAP_INCREMENTAL_SIZE) * sizeof(DDI_MEDIA_IMAGE_HEAP_ELEMENT));
-
-        if (nullptr == newHeapBase)
+        if (nullptr == MediaLibvaCommonNext::GrowHeap(imageHeap, sizeof(DDI_MEDIA_IMAGE_HEAP_ELEMENT), DDI_MEDIA_HEAP_INCREMENTAL_SIZE))
         {
-            DDI_ASSERTMESSAGE("DDI: realloc failed.");
+            DDI_ASSERTMESSAGE("DDI: heap grow failed.");
             return nullptr;
         }
-        imageHeap->pHeapBase                           = newHeapBase;
         PDDI_MEDIA_IMAGE_HEAP_ELEMENT vaimageHeapBase  = (PDDI_MEDIA_IMAGE_HEAP_ELEMENT)imageHeap->pHeapBase;
         imageHeap->pFirstFreeHeapElement               = (void*)(&vaimageHeapBase[imageHeap->uiAllocatedHeapElements]);
         for (int32_t i = 0; i < (DDI_MEDIA_HEAP_INCREMENTAL_SIZE); i++)
@@ -1995,10 +2044,11 @@ PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT MediaLibvaUtilNext::DdiAllocPVAContextFromHeap
 
     if (nullptr == vaContextHeap->pFirstFreeHeapElement)
     {
-        void *newHeapBase = MOS_ReallocMemory(vaContextHeap->pHeapBase, (vaContextHeap->uiAllocatedHeapElements + DDI_MEDIA_HEAP_INCREMENTAL_SIZE) * sizeof(DDI_MEDIA_VACONTEXT_HEAP_ELEMENT));
-        DDI_CHK_NULL(newHeapBase, "DDI: realloc failed.", nullptr);
-
-        vaContextHeap->pHeapBase                            = newHeapBase;
+        if (nullptr == MediaLibvaCommonNext::GrowHeap(vaContextHeap, sizeof(DDI_MEDIA_VACONTEXT_HEAP_ELEMENT), DDI_MEDIA_HEAP_INCREMENTAL_SIZE))
+        {
+            DDI_ASSERTMESSAGE("DDI: heap grow failed.");
+            return nullptr;
+        }
         PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT vacontextHeapBase = (PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT)vaContextHeap->pHeapBase;
         DDI_CHK_NULL(vacontextHeapBase, "nullptr vacontextHeapBase.", nullptr);
         vaContextHeap->pFirstFreeHeapElement        = (void*)(&(vacontextHeapBase[vaContextHeap->uiAllocatedHeapElements]));
@@ -2208,8 +2258,10 @@ void MediaLibvaUtilNext::MediaPrintFps()
         sprintf_s(fpsFileName, sizeof(fpsFileName), FPS_FILE_NAME);
         if ((fp = fopen(fpsFileName, "wb")) == nullptr)
         {
+            m_frameCountFps = -1;
             pthread_mutex_unlock(&m_fpsMutex);
             DDI_ASSERTMESSAGE("Unable to open fps file.");
+            return;
         }
 
         fwrite(temp, 1, strlen(temp), fp);
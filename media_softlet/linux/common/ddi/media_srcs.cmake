@@ -25,6 +25,10 @@ set(TMP_SOURCES_
     ${CMAKE_CURRENT_LIST_DIR}/media_libva_caps_next.cpp
     ${CMAKE_CURRENT_LIST_DIR}/media_libva_interface_next.cpp
     ${CMAKE_CURRENT_LIST_DIR}/media_libva_common_next.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/media_libva_buffer_pool_next.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/media_libva_import_cache_next.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/media_libva_shared_device_next.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/media_libva_lib_preload_next.cpp
 )
 
 set(TMP_HEADERS_
@@ -38,6 +42,10 @@ set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/media_libva_interface_next.h
     ${CMAKE_CURRENT_LIST_DIR}/media_libva_common_next.h
     ${CMAKE_CURRENT_LIST_DIR}/ddi_register_components_specific.h
+    ${CMAKE_CURRENT_LIST_DIR}/media_libva_buffer_pool_next.h
+    ${CMAKE_CURRENT_LIST_DIR}/media_libva_import_cache_next.h
+    ${CMAKE_CURRENT_LIST_DIR}/media_libva_shared_device_next.h
+    ${CMAKE_CURRENT_LIST_DIR}/media_libva_lib_preload_next.h
     ${CMAKE_CURRENT_LIST_DIR}/media_libva_common_next.h
 )
 
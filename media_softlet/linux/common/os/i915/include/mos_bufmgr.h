@@ -157,6 +157,8 @@ struct mos_aub_annotation {
 };
 
 #define BO_ALLOC_FOR_RENDER (1<<0)
+/* leave softpin address assignment to the caller, used by batched allocation */
+#define BO_ALLOC_NO_SOFTPIN (1<<1)
 
 struct mos_linux_bo *mos_bo_alloc(struct mos_bufmgr *bufmgr, const char *name,
                  unsigned long size, unsigned int alignment, int mem_type);
@@ -236,16 +238,42 @@ void mos_bufmgr_gem_enable_reuse(struct mos_bufmgr *bufmgr);
 void mos_bufmgr_gem_enable_fenced_relocs(struct mos_bufmgr *bufmgr);
 void mos_bufmgr_gem_enable_softpin(struct mos_bufmgr *bufmgr, bool va1m_align);
 void mos_bufmgr_gem_enable_vmbind(struct mos_bufmgr *bufmgr);
+void mos_bufmgr_gem_enable_async_destroy(struct mos_bufmgr *bufmgr);
 void mos_bufmgr_gem_disable_object_capture(struct mos_bufmgr *bufmgr);
 
 void mos_bufmgr_gem_set_vma_cache_size(struct mos_bufmgr *bufmgr,
                          int limit);
 int mos_bufmgr_gem_get_memory_info(struct mos_bufmgr *bufmgr, char *info, uint32_t length);
+
+/** Counters of the per-thread BO reuse magazines */
+struct mos_bufmgr_reuse_stats {
+    uint32_t magazine_hit;
+    uint32_t magazine_miss;
+    uint32_t magazine_evict;
+};
+void mos_bufmgr_gem_get_reuse_stats(struct mos_bufmgr *bufmgr, struct mos_bufmgr_reuse_stats *stats);
+
+/** Counters of the execbuffer validation list reuse */
+struct mos_bufmgr_exec_stats {
+    uint64_t exec_objects_reused;   /* entries left unchanged from the previous submission */
+    uint64_t exec_objects_rebuilt;  /* entries written */
+    uint64_t targets_merged;        /* softpin targets folded into an existing one */
+};
+void mos_bufmgr_gem_get_exec_stats(struct mos_bufmgr *bufmgr, struct mos_bufmgr_exec_stats *stats);
+
+/** Fragmentation statistics of a softpin memory zone, see mos_vma.h */
+struct _mos_vma_heap_stats;
+int mos_bufmgr_gem_get_vma_stats(struct mos_bufmgr *bufmgr, enum mos_memory_zone memzone, struct _mos_vma_heap_stats *stats);
 int mos_gem_bo_map_unsynchronized(struct mos_linux_bo *bo);
 int mos_gem_bo_map_gtt(struct mos_linux_bo *bo);
 int mos_gem_bo_unmap_gtt(struct mos_linux_bo *bo);
 int mos_gem_bo_map_wc_unsynchronized(struct mos_linux_bo *bo);
 int mos_gem_bo_unmap_wc(struct mos_linux_bo *bo);
+void mos_gem_bo_set_map_hot(struct mos_linux_bo *bo, bool hot);
+int mos_gem_bo_export_sync_file(struct mos_linux_bo *bo, int *fd);
+void mos_gem_bo_set_persistent(struct mos_linux_bo *bo);
+void mos_gem_bo_mark_queued(struct mos_linux_bo *bo);
+void mos_gem_bo_mark_submitted(struct mos_linux_bo *bo);
 
 int mos_gem_bo_get_fake_offset(struct mos_linux_bo *bo);
 int mos_gem_bo_get_reloc_count(struct mos_linux_bo *bo);
@@ -300,6 +328,10 @@ int mos_set_context_param_parallel(struct mos_linux_context *ctx,
 int mos_set_context_param_load_balance(struct mos_linux_context *ctx,
                          struct i915_engine_class_instance *ci,
                          unsigned int count);
+int mos_set_context_param_load_balance_ext(struct mos_linux_context *ctx,
+                         struct i915_engine_class_instance *ci,
+                         unsigned int count,
+                         bool expose_siblings);
 int mos_set_context_param_bond(struct mos_linux_context *ctx,
                         struct i915_engine_class_instance master_ci,
                         struct i915_engine_class_instance *bond_ci,
@@ -416,6 +448,22 @@ mos_gem_bo_alloc_internal(struct mos_bufmgr *bufmgr,
                 unsigned int alignment,
                 int mem_type);
 drm_export int
+mos_gem_bo_alloc_batch(struct mos_bufmgr *bufmgr,
+                const char *name,
+                unsigned long size,
+                unsigned long flags,
+                uint32_t tiling_mode,
+                unsigned long stride,
+                unsigned int alignment,
+                int mem_type,
+                struct mos_linux_bo **bos,
+                int count);
+drm_export int
+mos_gem_bo_alloc_tiled_batch(struct mos_bufmgr *bufmgr, const char *name,
+                int x, int y, int cpp, uint32_t *tiling_mode,
+                unsigned long *pitch, unsigned long flags,
+                int mem_type, struct mos_linux_bo **bos, int count);
+drm_export int
 mos_gem_bo_exec(struct mos_linux_bo *bo, int used,
               drm_clip_rect_t * cliprects, int num_cliprects, int DR4);
 drm_export int do_exec2(struct mos_linux_bo *bo, int used, struct mos_linux_context *ctx,
@@ -47,6 +47,7 @@
 #include <unistd.h>
 #include <assert.h>
 #include <pthread.h>
+#include <time.h>
 #include <sys/ioctl.h>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -110,12 +111,34 @@
                  (devid) == PCI_CHIP_I915_GM)
 
 #define INITIAL_SOFTPIN_TARGET_COUNT  1024
+/* Softpin target arrays of freed bos kept for the next bo gaining targets */
+#define MOS_SOFTPIN_POOL_DEPTH        16
+
+/* Per-thread BO magazines sitting in front of the shared reuse buckets */
+#define MOS_BO_MAGAZINE_DEPTH         4
+#define MOS_BO_MAGAZINE_MAX_BO_SIZE   (256 * 1024)
+#define MOS_BO_MAGAZINE_MAX_BYTES     (4 * 1024 * 1024)
+#define MOS_BO_CACHE_BUCKET_COUNT     (14 * 4)
 
 struct mos_gem_bo_bucket {
     drmMMListHead head;
     unsigned long size;
 };
 
+struct mos_gem_bo_magazine {
+    /** Cached BOs of one bucket size, most recently freed last */
+    struct mos_bo_gem *bos[MOS_BO_MAGAZINE_DEPTH];
+    int count;
+};
+
+struct mos_gem_bo_thread_cache {
+    struct mos_bufmgr_gem *bufmgr_gem;
+    /** Link in bufmgr_gem->thread_caches, protected by bufmgr_gem->lock */
+    drmMMListHead link;
+    unsigned long bytes;
+    struct mos_gem_bo_magazine magazine[MOS_BO_CACHE_BUCKET_COUNT];
+};
+
 typedef struct mos_bufmgr_gem {
     struct mos_bufmgr bufmgr;
 
@@ -133,11 +156,75 @@ typedef struct mos_bufmgr_gem {
     int exec_size;
     int exec_count;
 
+    /** Validation list entries kept from the previous submission vs rewritten */
+    struct {
+        uint64_t reused;
+        uint64_t rebuilt;
+        uint64_t targets_merged;
+    } exec_stats;
+
     /** Array of lists of cached gem objects of power-of-two sizes */
-    struct mos_gem_bo_bucket cache_bucket[14 * 4];
+    struct mos_gem_bo_bucket cache_bucket[MOS_BO_CACHE_BUCKET_COUNT];
     int num_buckets;
+    int num_magazine_buckets;
     time_t time;
 
+    /** Per-thread magazines in front of cache_bucket */
+    pthread_key_t magazine_key;
+    bool has_magazine_key;
+    drmMMListHead thread_caches;
+    atomic_t reuse_hit;
+    atomic_t reuse_miss;
+    atomic_t reuse_evict;
+
+    /** Deferred destruction of freed buffer objects */
+    struct {
+        pthread_t thread;
+        pthread_mutex_t mutex;
+        pthread_cond_t cond;
+        drmMMListHead queue;
+        int count;
+        uint64_t bytes;
+        bool running;
+        bool stop;
+    } reaper;
+
+    /**
+     * Timeline syncobj signaled by every execbuffer2 submission, point n
+     * being the n-th successful one.
+     */
+    struct {
+        uint32_t handle;
+        uint64_t next_point;
+        /** Highest point known to be signaled, read without the mutex */
+        uint64_t signaled;
+        /** Point a thread is currently waiting on in the kernel, 0 if none */
+        uint64_t waiting;
+        pthread_mutex_t mutex;
+        pthread_cond_t cond;
+    } timeline;
+    bool has_timeline;
+
+    /** Signaled when the queued submission count of a bo drops to zero */
+    struct {
+        pthread_mutex_t mutex;
+        pthread_cond_t cond;
+    } queued;
+
+    /** Softpin target arrays recycled between bos, protected by lock */
+    struct {
+        struct mos_softpin_target *targets;
+        int *hash;
+        int capacity;
+    } softpin_pool[MOS_SOFTPIN_POOL_DEPTH];
+    int softpin_pool_count;
+
+    /** Mapped but unused buffer objects, least recently unmapped first */
+    drmMMListHead map_lru;
+    uint64_t map_lru_bytes;
+    /** Virtual address space kept in map_lru, 0 means unlimited */
+    uint64_t map_cache_budget;
+
     drmMMListHead managers;
 
     drmMMListHead named;
@@ -173,6 +260,15 @@ typedef struct mos_bufmgr_gem {
 
     BufmgrPrelim *prelim;
 
+    /** Persistent bos are bound with VM_BIND instead of listed in execbuffer */
+    bool use_vm_bind;
+    /** vm of the execbuffer being built, 0 when bindings are not used */
+    uint32_t exec_vm_id;
+    /** Bound bos of the execbuffer being built, left out of exec_bos */
+    struct mos_linux_bo **exec_bound_bos;
+    int exec_bound_size;
+    int exec_bound_count;
+
     #define MEM_PROFILER_BUFFER_SIZE 256
     char mem_profiler_buffer[MEM_PROFILER_BUFFER_SIZE];
     char* mem_profiler_path;
@@ -181,6 +277,12 @@ typedef struct mos_bufmgr_gem {
 
 #define DRM_INTEL_RELOC_FENCE (1<<0)
 
+/* Beyond these limits freeing falls back to the calling thread so that a
+ * slow reaper cannot hold an unbounded amount of memory.
+ */
+#define MOS_BO_REAPER_MAX_QUEUED   256
+#define MOS_BO_REAPER_MAX_BYTES    (64 * 1024 * 1024)
+
 struct mos_reloc_target {
     struct mos_linux_bo *bo;
     int flags;
@@ -235,6 +337,11 @@ struct mos_bo_gem {
     int softpin_target_count;
     /** Maximum amount of softpinned BOs that are referenced by this buffer */
     int max_softpin_target_count;
+    /**
+     * Open addressing table of 2 * max_softpin_target_count entries holding
+     * softpin_target indices + 1, all zero while there are no targets.
+     */
+    int *softpin_hash;
 
     /** Mapped address for the buffer, saved across map/unmap cycles */
     void *mem_virtual;
@@ -249,6 +356,41 @@ struct mos_bo_gem {
     void *user_virtual;
     int map_count;
 
+    /** Outstanding map calls not yet balanced by an unmap */
+    int map_refs;
+    /** Link in bufmgr_gem->map_lru while mapped with map_refs == 0 */
+    drmMMListHead map_lru;
+    bool in_map_lru;
+
+    /**
+     * Boolean of whether the mappings are kept regardless of the cache
+     * budget and the map synchronization is skipped while the GPU has not
+     * used the buffer since the last synchronized map.
+     */
+    bool map_hot;
+    /** Whether map has waited for the GPU since the last execbuffer using the bo */
+    bool map_synced;
+
+    /**
+     * Long-lived buffer, see mos_gem_bo_set_persistent(). Once bound to a
+     * vm it stays bound until the bo is closed.
+     */
+    bool persistent;
+    /** vm the bo is bound to with VM_BIND, 0 if none */
+    uint32_t bound_vm_id;
+
+    /**
+     * Timeline point of the last execbuffer2 using the bo, 0 when the bo
+     * was last submitted without one and only implicit fencing is known.
+     */
+    uint64_t exec_point;
+
+    /**
+     * Submissions using the bo that are queued on a submission thread and
+     * not yet handed to the kernel, see mos_gem_bo_mark_queued().
+     */
+    int queued_submits;
+
     /** BO cache list */
     drmMMListHead head;
 
@@ -381,6 +523,8 @@ static void mos_gem_bo_unreference_locked_timed(struct mos_linux_bo *bo,
                               time_t time);
 
 static void mos_gem_bo_unreference(struct mos_linux_bo *bo);
+static void mos_gem_cleanup_bo_cache(struct mos_bufmgr_gem *bufmgr_gem, time_t time);
+static int mos_gem_bo_set_softpin_offset(struct mos_linux_bo *bo, uint64_t offset);
 
 static inline struct mos_bo_gem *to_bo_gem(struct mos_linux_bo *bo)
 {
@@ -565,14 +709,106 @@ mos_add_validate_buffer(struct mos_linux_bo *bo)
     bufmgr_gem->exec_count++;
 }
 
+/**
+ * Makes room for one more entry in exec2_objects. Slots beyond the last
+ * submission are zeroed so that they never match a cached entry.
+ */
+static bool
+mos_gem_exec2_reserve(struct mos_bufmgr_gem *bufmgr_gem)
+{
+    struct drm_i915_gem_exec_object2 *exec2_objects;
+    struct mos_linux_bo **exec_bos;
+
+    if (bufmgr_gem->exec_count < bufmgr_gem->exec_size)
+        return true;
+
+    int new_size = bufmgr_gem->exec_size * 2;
+
+    if (new_size == 0)
+        new_size = ARRAY_INIT_SIZE;
+    exec2_objects = (struct drm_i915_gem_exec_object2 *)
+            realloc(bufmgr_gem->exec2_objects,
+                sizeof(*bufmgr_gem->exec2_objects) * new_size);
+    if (!exec2_objects)
+    {
+        MOS_DBG("realloc exec2_objects failed!\n");
+        return false;
+    }
+    memset(&exec2_objects[bufmgr_gem->exec_size], 0,
+        sizeof(*exec2_objects) * (new_size - bufmgr_gem->exec_size));
+
+    bufmgr_gem->exec2_objects = exec2_objects;
+
+    exec_bos = (struct mos_linux_bo **)realloc(bufmgr_gem->exec_bos,
+            sizeof(*bufmgr_gem->exec_bos) * new_size);
+    if (!exec_bos)
+    {
+        MOS_DBG("realloc exec_bo failed!\n");
+        return false;
+    }
+
+    bufmgr_gem->exec_bos = exec_bos;
+    bufmgr_gem->exec_size = new_size;
+    return true;
+}
+
+/**
+ * Appends bo to the validation list.
+ *
+ * exec2_objects is kept across submissions and a steady stream of batches
+ * mostly validates the same buffers in the same order, so the entry left
+ * at this index by the previous submission is compared first and only
+ * rewritten when it differs.
+ */
+static void
+mos_gem_exec2_append(struct mos_bufmgr_gem *bufmgr_gem,
+               struct mos_linux_bo *bo,
+               uint64_t offset,
+               uint64_t flags)
+{
+    struct mos_bo_gem *bo_gem = (struct mos_bo_gem *)bo;
+    struct drm_i915_gem_exec_object2 *entry;
+    int index;
+
+    if (!mos_gem_exec2_reserve(bufmgr_gem))
+        return;
+
+    index = bufmgr_gem->exec_count;
+    bo_gem->validate_index = index;
+    entry = &bufmgr_gem->exec2_objects[index];
+
+    if (entry->handle == bo_gem->gem_handle &&
+        entry->relocation_count == (__u32)bo_gem->reloc_count &&
+        entry->relocs_ptr == (uintptr_t)bo_gem->relocs &&
+        entry->alignment == bo->align &&
+        entry->offset == offset &&
+        entry->flags == flags &&
+        entry->pad_to_size == bo_gem->pad_to_size &&
+        entry->rsvd1 == 0 &&
+        entry->rsvd2 == 0) {
+        bufmgr_gem->exec_stats.reused++;
+    } else {
+        /* Fill in array entry */
+        entry->handle           = bo_gem->gem_handle;
+        entry->relocation_count = bo_gem->reloc_count;
+        entry->relocs_ptr       = (uintptr_t)bo_gem->relocs;
+        entry->alignment        = bo->align;
+        entry->offset           = offset;
+        entry->flags            = flags;
+        entry->rsvd1            = 0;
+        entry->pad_to_size      = bo_gem->pad_to_size;
+        entry->rsvd2            = 0;
+        bufmgr_gem->exec_stats.rebuilt++;
+    }
+    bufmgr_gem->exec_bos[index] = bo;
+    bufmgr_gem->exec_count++;
+}
+
 static void
 mos_add_validate_buffer2(struct mos_linux_bo *bo, int need_fence)
 {
     struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *)bo->bufmgr;
     struct mos_bo_gem *bo_gem = (struct mos_bo_gem *)bo;
-    int index;
-    struct drm_i915_gem_exec_object2 *exec2_objects;
-    struct mos_linux_bo **exec_bos;
     int flags = 0;
 
     if (need_fence)
@@ -593,44 +829,7 @@ mos_add_validate_buffer2(struct mos_linux_bo *bo, int need_fence)
         return;
     }
 
-    /* Extend the array of validation entries as necessary. */
-    if (bufmgr_gem->exec_count == bufmgr_gem->exec_size) {
-        int new_size = bufmgr_gem->exec_size * 2;
-
-        if (new_size == 0)
-            new_size = ARRAY_INIT_SIZE;
-        exec2_objects = (struct drm_i915_gem_exec_object2 *)
-                realloc(bufmgr_gem->exec2_objects,
-                    sizeof(*bufmgr_gem->exec2_objects) * new_size);
-        if (!exec2_objects)
-            return;
-
-        bufmgr_gem->exec2_objects = exec2_objects;
-
-        exec_bos = (struct mos_linux_bo **)realloc(bufmgr_gem->exec_bos,
-                sizeof(*bufmgr_gem->exec_bos) * new_size);
-        if (!exec_bos)
-            return;
-
-        bufmgr_gem->exec_bos = exec_bos;
-        bufmgr_gem->exec_size = new_size;
-    }
-
-    index = bufmgr_gem->exec_count;
-    bo_gem->validate_index = index;
-    /* Fill in array entry */
-    bufmgr_gem->exec2_objects[index].handle = bo_gem->gem_handle;
-    bufmgr_gem->exec2_objects[index].relocation_count = bo_gem->reloc_count;
-    bufmgr_gem->exec2_objects[index].relocs_ptr = (uintptr_t)bo_gem->relocs;
-    bufmgr_gem->exec2_objects[index].alignment = bo->align;
-    bufmgr_gem->exec2_objects[index].offset = bo_gem->is_softpin ?
-        bo->offset64 : 0;
-    bufmgr_gem->exec_bos[index] = bo;
-    bufmgr_gem->exec2_objects[index].flags = flags;
-    bufmgr_gem->exec2_objects[index].rsvd1 = 0;
-    bufmgr_gem->exec2_objects[index].pad_to_size = bo_gem->pad_to_size;
-    bufmgr_gem->exec2_objects[index].rsvd2 = 0;
-    bufmgr_gem->exec_count++;
+    mos_gem_exec2_append(bufmgr_gem, bo, bo_gem->is_softpin ? bo->offset64 : 0, flags);
 }
 
 static void
@@ -638,58 +837,48 @@ mos_add_reloc_objects(struct mos_reloc_target reloc_target)
 {
     struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *)reloc_target.bo->bufmgr;
     struct mos_bo_gem *bo_gem = (struct mos_bo_gem *)reloc_target.bo;
-    int index;
-    struct drm_i915_gem_exec_object2 *exec2_objects;
-    struct mos_linux_bo **exec_bos;
 
     if (bo_gem->validate_index != -1) {
         bufmgr_gem->exec2_objects[bo_gem->validate_index].flags |= reloc_target.flags;
         return;
     }
 
-    /* Extend the array of validation entries as necessary. */
-    if (bufmgr_gem->exec_count == bufmgr_gem->exec_size) {
-        int new_size = bufmgr_gem->exec_size * 2;
+    mos_gem_exec2_append(bufmgr_gem, reloc_target.bo, 0, reloc_target.flags);
+}
 
-        if (new_size == 0)
-            new_size = ARRAY_INIT_SIZE;
-        exec2_objects = (struct drm_i915_gem_exec_object2 *)
-                realloc(bufmgr_gem->exec2_objects,
-                    sizeof(*bufmgr_gem->exec2_objects) * new_size);
-        if (!exec2_objects)
-        {
-            MOS_DBG("realloc exec2_objects failed!\n");
-            return;
-        }
+/**
+ * Binds a persistent softpinned bo to the vm of the execbuffer being built.
+ *
+ * Returns true if the bo is resident through its binding and can be left
+ * out of the object list.
+ */
+static bool
+mos_gem_bo_vm_bind_locked(struct mos_bufmgr_gem *bufmgr_gem, struct mos_bo_gem *bo_gem)
+{
+    uint32_t vm_id = bufmgr_gem->exec_vm_id;
 
-        bufmgr_gem->exec2_objects = exec2_objects;
+    if (vm_id == 0)
+        return false;
 
-        exec_bos = (struct mos_linux_bo **)realloc(bufmgr_gem->exec_bos,
-                sizeof(*bufmgr_gem->exec_bos) * new_size);
-        if (!exec_bos)
-        {
-            MOS_DBG("realloc exec_bo failed!\n");
-            return;
-        }
+    if (bo_gem->bound_vm_id != 0)
+        return bo_gem->bound_vm_id == vm_id;
 
-        bufmgr_gem->exec_bos = exec_bos;
-        bufmgr_gem->exec_size = new_size;
+    if (!bo_gem->persistent || !bo_gem->is_softpin || !bo_gem->reusable)
+        return false;
+
+    int ret = bufmgr_gem->prelim->VmBind(vm_id, bo_gem->gem_handle,
+                          bo_gem->bo.offset64, bo_gem->bo.size);
+    if (ret != 0) {
+        /* Most likely the vm is not in VM_BIND mode, stop trying */
+        MOS_DBG("VM_BIND %d (%s) failed: %s, disable vm bind\n",
+            bo_gem->gem_handle, bo_gem->name, strerror(-ret));
+        bufmgr_gem->use_vm_bind = false;
+        bufmgr_gem->exec_vm_id = 0;
+        return false;
     }
 
-    index = bufmgr_gem->exec_count;
-    bo_gem->validate_index = index;
-    /* Fill in array entry */
-    bufmgr_gem->exec2_objects[index].handle           = bo_gem->gem_handle;
-    bufmgr_gem->exec2_objects[index].relocation_count = bo_gem->reloc_count;
-    bufmgr_gem->exec2_objects[index].relocs_ptr       = (uintptr_t)bo_gem->relocs;
-    bufmgr_gem->exec2_objects[index].alignment        = reloc_target.bo->align;
-    bufmgr_gem->exec2_objects[index].offset           = 0;
-    bufmgr_gem->exec_bos[index]                       = reloc_target.bo;
-    bufmgr_gem->exec2_objects[index].flags            = reloc_target.flags;
-    bufmgr_gem->exec2_objects[index].rsvd1            = 0;
-    bufmgr_gem->exec2_objects[index].pad_to_size      = bo_gem->pad_to_size;
-    bufmgr_gem->exec2_objects[index].rsvd2            = 0;
-    bufmgr_gem->exec_count++;
+    bo_gem->bound_vm_id = vm_id;
+    return true;
 }
 
 static void
@@ -697,58 +886,34 @@ mos_add_softpin_objects(struct mos_softpin_target softpin_target)
 {
     struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *)softpin_target.bo->bufmgr;
     struct mos_bo_gem *bo_gem = (struct mos_bo_gem *)softpin_target.bo;
-    int index;
-    struct drm_i915_gem_exec_object2 *exec2_objects;
-    struct mos_linux_bo **exec_bos;
 
-    if (bo_gem->validate_index != -1) {
-        bufmgr_gem->exec2_objects[bo_gem->validate_index].flags |= softpin_target.flags;
+    if (mos_gem_bo_vm_bind_locked(bufmgr_gem, bo_gem)) {
+        /* Not in the list, so account the GPU use here */
+        bo_gem->idle = false;
+        bo_gem->map_synced = false;
+        bo_gem->exec_point = 0;
+
+        /* Remembered to receive the timeline point of the submission */
+        if (bufmgr_gem->exec_bound_count == bufmgr_gem->exec_bound_size) {
+            int new_size = bufmgr_gem->exec_bound_size ? bufmgr_gem->exec_bound_size * 2 : 64;
+            struct mos_linux_bo **bound_bos = (struct mos_linux_bo **)
+                realloc(bufmgr_gem->exec_bound_bos, sizeof(*bound_bos) * new_size);
+            if (bound_bos == nullptr)
+                return;
+            bufmgr_gem->exec_bound_bos = bound_bos;
+            bufmgr_gem->exec_bound_size = new_size;
+        }
+        bufmgr_gem->exec_bound_bos[bufmgr_gem->exec_bound_count++] = softpin_target.bo;
         return;
     }
 
-    /* Extend the array of validation entries as necessary. */
-    if (bufmgr_gem->exec_count == bufmgr_gem->exec_size) {
-        int new_size = bufmgr_gem->exec_size * 2;
-
-        if (new_size == 0)
-            new_size = ARRAY_INIT_SIZE;
-        exec2_objects = (struct drm_i915_gem_exec_object2 *)
-                realloc(bufmgr_gem->exec2_objects,
-                    sizeof(*bufmgr_gem->exec2_objects) * new_size);
-        if (!exec2_objects)
-        {
-            MOS_DBG("realloc exec2_objects failed!\n");
-            return;
-        }
-
-        bufmgr_gem->exec2_objects = exec2_objects;
-
-        exec_bos = (struct mos_linux_bo **)realloc(bufmgr_gem->exec_bos,
-                sizeof(*bufmgr_gem->exec_bos) * new_size);
-        if (!exec_bos)
-        {
-            MOS_DBG("realloc exec_bo failed!\n");
-            return;
-        }
-
-        bufmgr_gem->exec_bos = exec_bos;
-        bufmgr_gem->exec_size = new_size;
+    if (bo_gem->validate_index != -1) {
+        bufmgr_gem->exec2_objects[bo_gem->validate_index].flags |= softpin_target.flags;
+        return;
     }
 
-    index = bufmgr_gem->exec_count;
-    bo_gem->validate_index = index;
-    /* Fill in array entry */
-    bufmgr_gem->exec2_objects[index].handle           = bo_gem->gem_handle;
-    bufmgr_gem->exec2_objects[index].relocation_count = bo_gem->reloc_count;
-    bufmgr_gem->exec2_objects[index].relocs_ptr       = (uintptr_t)bo_gem->relocs;
-    bufmgr_gem->exec2_objects[index].alignment        = softpin_target.bo->align;
-    bufmgr_gem->exec2_objects[index].offset           = softpin_target.bo->offset64;
-    bufmgr_gem->exec2_objects[index].flags            = softpin_target.flags;
-    bufmgr_gem->exec2_objects[index].pad_to_size      = bo_gem->pad_to_size;
-    bufmgr_gem->exec2_objects[index].rsvd1            = 0;
-    bufmgr_gem->exec2_objects[index].rsvd2            = 0;
-    bufmgr_gem->exec_bos[index]                       = softpin_target.bo;
-    bufmgr_gem->exec_count++;
+    mos_gem_exec2_append(bufmgr_gem, softpin_target.bo, softpin_target.bo->offset64,
+                 softpin_target.flags);
 }
 
 #define RELOC_BUF_SIZE(x) ((I915_RELOC_HEADER + x * I915_RELOC0_STRIDE) * \
@@ -803,6 +968,186 @@ mos_setup_reloc_list(struct mos_linux_bo *bo)
     return 0;
 }
 
+static void
+mos_gem_timeline_init(struct mos_bufmgr_gem *bufmgr_gem)
+{
+    struct drm_syncobj_create create;
+    pthread_condattr_t attr;
+
+    memclear(create);
+    if (drmIoctl(bufmgr_gem->fd, DRM_IOCTL_SYNCOBJ_CREATE, &create) != 0) {
+        MOS_DBG("%s:%d: Failed to create timeline syncobj: %s\n",
+            __FILE__, __LINE__, strerror(errno));
+        return;
+    }
+
+    bufmgr_gem->timeline.handle = create.handle;
+    bufmgr_gem->timeline.next_point = 0;
+    bufmgr_gem->timeline.signaled = 0;
+    bufmgr_gem->timeline.waiting = 0;
+    pthread_mutex_init(&bufmgr_gem->timeline.mutex, nullptr);
+    /* Kernel syncobj timeouts are absolute CLOCK_MONOTONIC values */
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&bufmgr_gem->timeline.cond, &attr);
+    pthread_condattr_destroy(&attr);
+    bufmgr_gem->has_timeline = true;
+}
+
+static void
+mos_gem_timeline_fini(struct mos_bufmgr_gem *bufmgr_gem)
+{
+    struct drm_syncobj_destroy destroy;
+
+    /* The timeline may have been disabled after a rejected execbuffer */
+    if (bufmgr_gem->timeline.handle == 0)
+        return;
+
+    memclear(destroy);
+    destroy.handle = bufmgr_gem->timeline.handle;
+    drmIoctl(bufmgr_gem->fd, DRM_IOCTL_SYNCOBJ_DESTROY, &destroy);
+
+    pthread_cond_destroy(&bufmgr_gem->timeline.cond);
+    pthread_mutex_destroy(&bufmgr_gem->timeline.mutex);
+    bufmgr_gem->has_timeline = false;
+}
+
+/**
+ * Waits for a point of the submission timeline.
+ *
+ * Points up to the highest one already seen signaled return without an
+ * ioctl. Only one thread at a time waits in the kernel, the others sleep
+ * on the condition variable when that wait covers their point.
+ *
+ * Returns 0 once signaled, -ETIME on timeout. A negative timeout waits
+ * forever.
+ */
+static int
+mos_gem_timeline_wait(struct mos_bufmgr_gem *bufmgr_gem, uint64_t point,
+              int64_t timeout_ns)
+{
+    struct drm_syncobj_timeline_wait wait;
+    struct timespec now;
+    int64_t deadline = INT64_MAX;
+    int ret = 0;
+
+    if (__atomic_load_n(&bufmgr_gem->timeline.signaled, __ATOMIC_ACQUIRE) >= point)
+        return 0;
+
+    if (timeout_ns >= 0) {
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        deadline = (int64_t)now.tv_sec * 1000000000ll + now.tv_nsec;
+        deadline = timeout_ns > INT64_MAX - deadline ? INT64_MAX : deadline + timeout_ns;
+    }
+
+    pthread_mutex_lock(&bufmgr_gem->timeline.mutex);
+    while (bufmgr_gem->timeline.signaled < point) {
+        if (bufmgr_gem->timeline.waiting >= point) {
+            struct timespec abs;
+
+            if (timeout_ns == 0) {
+                ret = -ETIME;
+                break;
+            }
+            if (deadline == INT64_MAX) {
+                pthread_cond_wait(&bufmgr_gem->timeline.cond,
+                          &bufmgr_gem->timeline.mutex);
+                continue;
+            }
+            abs.tv_sec = deadline / 1000000000ll;
+            abs.tv_nsec = deadline % 1000000000ll;
+            if (pthread_cond_timedwait(&bufmgr_gem->timeline.cond,
+                           &bufmgr_gem->timeline.mutex, &abs) == ETIMEDOUT &&
+                bufmgr_gem->timeline.signaled < point) {
+                ret = -ETIME;
+                break;
+            }
+            continue;
+        }
+
+        bufmgr_gem->timeline.waiting = point;
+        pthread_mutex_unlock(&bufmgr_gem->timeline.mutex);
+
+        memclear(wait);
+        wait.handles = (uintptr_t)&bufmgr_gem->timeline.handle;
+        wait.points = (uintptr_t)&point;
+        wait.timeout_nsec = timeout_ns == 0 ? 0 : deadline;
+        wait.count_handles = 1;
+        wait.flags = DRM_SYNCOBJ_WAIT_FLAGS_WAIT_FOR_SUBMIT;
+        ret = drmIoctl(bufmgr_gem->fd, DRM_IOCTL_SYNCOBJ_TIMELINE_WAIT, &wait);
+        if (ret != 0)
+            ret = -errno;
+
+        pthread_mutex_lock(&bufmgr_gem->timeline.mutex);
+        if (bufmgr_gem->timeline.waiting == point)
+            bufmgr_gem->timeline.waiting = 0;
+        if (ret == 0 && bufmgr_gem->timeline.signaled < point)
+            __atomic_store_n(&bufmgr_gem->timeline.signaled, point, __ATOMIC_RELEASE);
+        pthread_cond_broadcast(&bufmgr_gem->timeline.cond);
+        if (ret != 0)
+            break;
+    }
+    pthread_mutex_unlock(&bufmgr_gem->timeline.mutex);
+
+    return ret;
+}
+
+/**
+ * Waits until submissions queued on a submission thread for the bo reached
+ * the kernel, so the kernel side busy tracking and the timeline point of
+ * the bo are current.
+ *
+ * Returns 0 when nothing is queued anymore, -ETIME on timeout. A negative
+ * timeout waits forever.
+ */
+static int
+mos_gem_bo_wait_queued(struct mos_bufmgr_gem *bufmgr_gem, struct mos_bo_gem *bo_gem,
+              int64_t timeout_ns)
+{
+    struct timespec abs;
+    int ret = 0;
+
+    if (__atomic_load_n(&bo_gem->queued_submits, __ATOMIC_ACQUIRE) == 0)
+        return 0;
+    if (timeout_ns == 0)
+        return -ETIME;
+
+    if (timeout_ns > 0) {
+        clock_gettime(CLOCK_MONOTONIC, &abs);
+        abs.tv_sec += timeout_ns / 1000000000ll;
+        abs.tv_nsec += timeout_ns % 1000000000ll;
+        if (abs.tv_nsec >= 1000000000l) {
+            abs.tv_sec++;
+            abs.tv_nsec -= 1000000000l;
+        }
+    }
+
+    pthread_mutex_lock(&bufmgr_gem->queued.mutex);
+    while (__atomic_load_n(&bo_gem->queued_submits, __ATOMIC_ACQUIRE) != 0) {
+        if (timeout_ns < 0) {
+            pthread_cond_wait(&bufmgr_gem->queued.cond, &bufmgr_gem->queued.mutex);
+        } else if (pthread_cond_timedwait(&bufmgr_gem->queued.cond,
+                          &bufmgr_gem->queued.mutex, &abs) == ETIMEDOUT) {
+            if (__atomic_load_n(&bo_gem->queued_submits, __ATOMIC_ACQUIRE) != 0)
+                ret = -ETIME;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&bufmgr_gem->queued.mutex);
+
+    return ret;
+}
+
+/**
+ * Whether waits on the bo can use its timeline point. Shared buffers may be
+ * used by submissions the timeline does not know about.
+ */
+static inline bool
+mos_gem_bo_has_exec_point(struct mos_bufmgr_gem *bufmgr_gem, struct mos_bo_gem *bo_gem)
+{
+    return bufmgr_gem->has_timeline && bo_gem->reusable && bo_gem->exec_point != 0;
+}
+
 static int
 mos_gem_bo_busy(struct mos_linux_bo *bo)
 {
@@ -811,9 +1156,15 @@ mos_gem_bo_busy(struct mos_linux_bo *bo)
     struct drm_i915_gem_busy busy;
     int ret;
 
+    if (__atomic_load_n(&bo_gem->queued_submits, __ATOMIC_ACQUIRE) != 0)
+        return true;
+
     if (bo_gem->reusable && bo_gem->idle)
         return false;
 
+    if (mos_gem_bo_has_exec_point(bufmgr_gem, bo_gem))
+        return mos_gem_timeline_wait(bufmgr_gem, bo_gem->exec_point, 0) != 0;
+
     memclear(busy);
     busy.handle = bo_gem->gem_handle;
 
@@ -827,47 +1178,418 @@ mos_gem_bo_busy(struct mos_linux_bo *bo)
     return (ret == 0 && busy.busy);
 }
 
-static int
-mos_gem_bo_madvise_internal(struct mos_bufmgr_gem *bufmgr_gem,
-                 struct mos_bo_gem *bo_gem, int state)
-{
-    struct drm_i915_gem_madvise madv;
+static int
+mos_gem_bo_madvise_internal(struct mos_bufmgr_gem *bufmgr_gem,
+                 struct mos_bo_gem *bo_gem, int state)
+{
+    struct drm_i915_gem_madvise madv;
+
+    memclear(madv);
+    madv.handle = bo_gem->gem_handle;
+    madv.madv = state;
+    madv.retained = 1;
+    drmIoctl(bufmgr_gem->fd, DRM_IOCTL_I915_GEM_MADVISE, &madv);
+
+    return madv.retained;
+}
+
+static int
+mos_gem_bo_madvise(struct mos_linux_bo *bo, int madv)
+{
+    return mos_gem_bo_madvise_internal
+        ((struct mos_bufmgr_gem *) bo->bufmgr,
+         (struct mos_bo_gem *) bo,
+         madv);
+}
+
+/* drop the oldest entries that have been purged by the kernel */
+static void
+mos_gem_bo_cache_purge_bucket(struct mos_bufmgr_gem *bufmgr_gem,
+                    struct mos_gem_bo_bucket *bucket)
+{
+    while (!DRMLISTEMPTY(&bucket->head)) {
+        struct mos_bo_gem *bo_gem;
+
+        bo_gem = DRMLISTENTRY(struct mos_bo_gem,
+                      bucket->head.next, head);
+        if (mos_gem_bo_madvise_internal
+            (bufmgr_gem, bo_gem, I915_MADV_DONTNEED))
+            break;
+
+        DRMLISTDEL(&bo_gem->head);
+        mos_gem_bo_free(&bo_gem->bo);
+    }
+}
+
+/* move a BO from a thread magazine into the shared bucket, called with lock held */
+static void
+mos_gem_bo_magazine_evict_locked(struct mos_bufmgr_gem *bufmgr_gem,
+                    struct mos_gem_bo_bucket *bucket,
+                    struct mos_bo_gem *bo_gem,
+                    time_t time)
+{
+    atomic_inc(&bufmgr_gem->reuse_evict);
+
+    if (mos_gem_bo_madvise_internal(bufmgr_gem, bo_gem, I915_MADV_DONTNEED)) {
+        bo_gem->free_time = time;
+        DRMLISTADDTAIL(&bo_gem->head, &bucket->head);
+    } else {
+        mos_gem_bo_free(&bo_gem->bo);
+    }
+}
+
+static void
+mos_gem_bo_thread_cache_flush_locked(struct mos_gem_bo_thread_cache *cache,
+                    time_t time)
+{
+    struct mos_bufmgr_gem *bufmgr_gem = cache->bufmgr_gem;
+    int i, j;
+
+    for (i = 0; i < bufmgr_gem->num_magazine_buckets; i++) {
+        struct mos_gem_bo_magazine *magazine = &cache->magazine[i];
+
+        for (j = 0; j < magazine->count; j++)
+            mos_gem_bo_magazine_evict_locked(bufmgr_gem,
+                        &bufmgr_gem->cache_bucket[i],
+                        magazine->bos[j], time);
+        magazine->count = 0;
+    }
+    cache->bytes = 0;
+}
+
+/* pthread key destructor: hand the exiting thread's BOs back to the shared buckets */
+static void
+mos_gem_bo_thread_cache_destroy(void *data)
+{
+    struct mos_gem_bo_thread_cache *cache = (struct mos_gem_bo_thread_cache *)data;
+    struct mos_bufmgr_gem *bufmgr_gem = cache->bufmgr_gem;
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    pthread_mutex_lock(&bufmgr_gem->lock);
+    mos_gem_bo_thread_cache_flush_locked(cache, time.tv_sec);
+    DRMLISTDEL(&cache->link);
+    pthread_mutex_unlock(&bufmgr_gem->lock);
+
+    free(cache);
+}
+
+static struct mos_gem_bo_thread_cache *
+mos_gem_bo_thread_cache_get(struct mos_bufmgr_gem *bufmgr_gem, bool create)
+{
+    struct mos_gem_bo_thread_cache *cache;
+
+    if (!bufmgr_gem->has_magazine_key)
+        return nullptr;
+
+    cache = (struct mos_gem_bo_thread_cache *)pthread_getspecific(bufmgr_gem->magazine_key);
+    if (cache != nullptr || !create)
+        return cache;
+
+    cache = (struct mos_gem_bo_thread_cache *)calloc(1, sizeof(*cache));
+    if (cache == nullptr)
+        return nullptr;
+
+    cache->bufmgr_gem = bufmgr_gem;
+    if (pthread_setspecific(bufmgr_gem->magazine_key, cache) != 0) {
+        free(cache);
+        return nullptr;
+    }
+
+    pthread_mutex_lock(&bufmgr_gem->lock);
+    DRMLISTADDTAIL(&cache->link, &bufmgr_gem->thread_caches);
+    pthread_mutex_unlock(&bufmgr_gem->lock);
+
+    return cache;
+}
+
+/**
+ * Takes a BO of the given bucket size from the calling thread's magazine.
+ *
+ * BOs in a magazine are kept WILLNEED and keep their softpin address, so a
+ * hit costs neither the global lock nor a madvise ioctl.
+ */
+static struct mos_bo_gem *
+mos_gem_bo_magazine_pop(struct mos_bufmgr_gem *bufmgr_gem,
+                    struct mos_gem_bo_bucket *bucket,
+                    bool for_render,
+                    uint32_t tiling_mode,
+                    unsigned long stride,
+                    int mem_type)
+{
+    struct mos_gem_bo_thread_cache *cache;
+    struct mos_gem_bo_magazine *magazine;
+    struct mos_bo_gem *bo_gem;
+    int index = bucket - bufmgr_gem->cache_bucket;
+
+    if (!bufmgr_gem->bo_reuse || index >= bufmgr_gem->num_magazine_buckets)
+        return nullptr;
+
+    cache = mos_gem_bo_thread_cache_get(bufmgr_gem, false);
+    if (cache == nullptr)
+        return nullptr;
+
+    magazine = &cache->magazine[index];
+    if (magazine->count == 0) {
+        atomic_inc(&bufmgr_gem->reuse_miss);
+        return nullptr;
+    }
+
+    bo_gem = magazine->bos[magazine->count - 1];
+
+    /* Same policy as the shared buckets: only render targets may be
+     * handed out while the GPU is still using them.
+     */
+    if (!for_render && mos_gem_bo_busy(&bo_gem->bo)) {
+        atomic_inc(&bufmgr_gem->reuse_miss);
+        return nullptr;
+    }
+
+    magazine->count--;
+    cache->bytes -= bo_gem->bo.size;
+
+    if (mos_gem_bo_set_tiling_internal(&bo_gem->bo, tiling_mode, stride) ||
+        (bufmgr_gem->has_lmem && mos_gem_bo_check_mem_region_internal(&bo_gem->bo, mem_type))) {
+        pthread_mutex_lock(&bufmgr_gem->lock);
+        mos_gem_bo_free(&bo_gem->bo);
+        pthread_mutex_unlock(&bufmgr_gem->lock);
+        atomic_inc(&bufmgr_gem->reuse_miss);
+        return nullptr;
+    }
+
+    atomic_inc(&bufmgr_gem->reuse_hit);
+    return bo_gem;
+}
+
+static inline uint32_t
+mos_gem_softpin_hash(struct mos_linux_bo *target_bo, int mask)
+{
+    uint64_t key = (uintptr_t)target_bo >> 4;
+
+    return (uint32_t)((key * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+}
+
+/**
+ * Looks up target_bo in the softpin targets of bo_gem.
+ *
+ * Returns its index in softpin_target, or -1 with the free hash slot for it
+ * stored in hash_slot.
+ */
+static int
+mos_gem_bo_softpin_find(struct mos_bo_gem *bo_gem, struct mos_linux_bo *target_bo,
+             int *hash_slot)
+{
+    int mask = bo_gem->max_softpin_target_count * 2 - 1;
+    uint32_t h;
+
+    if (bo_gem->softpin_hash == nullptr)
+        return -1;
+
+    for (h = mos_gem_softpin_hash(target_bo, mask);
+         bo_gem->softpin_hash[h] != 0; h = (h + 1) & mask) {
+        int index = bo_gem->softpin_hash[h] - 1;
+
+        if (bo_gem->softpin_target[index].bo == target_bo)
+            return index;
+    }
+
+    if (hash_slot)
+        *hash_slot = h;
+    return -1;
+}
+
+/** Drops all targets, the caller has unreferenced them already */
+static void
+mos_gem_bo_softpin_reset(struct mos_bo_gem *bo_gem)
+{
+    if (bo_gem->softpin_target_count != 0)
+        memset(bo_gem->softpin_hash, 0,
+               bo_gem->max_softpin_target_count * 2 * sizeof(int));
+    bo_gem->softpin_target_count = 0;
+}
+
+static void
+mos_gem_bo_softpin_free(struct mos_bo_gem *bo_gem)
+{
+    free(bo_gem->softpin_target);
+    free(bo_gem->softpin_hash);
+    bo_gem->softpin_target = nullptr;
+    bo_gem->softpin_hash = nullptr;
+    bo_gem->max_softpin_target_count = 0;
+}
+
+/** Returns the empty target array of bo_gem to the pool */
+static void
+mos_gem_bo_softpin_release_locked(struct mos_bufmgr_gem *bufmgr_gem,
+                  struct mos_bo_gem *bo_gem)
+{
+    int n = bufmgr_gem->softpin_pool_count;
+
+    if (bo_gem->softpin_target == nullptr)
+        return;
+
+    if (n == MOS_SOFTPIN_POOL_DEPTH) {
+        mos_gem_bo_softpin_free(bo_gem);
+        return;
+    }
+
+    bufmgr_gem->softpin_pool[n].targets = bo_gem->softpin_target;
+    bufmgr_gem->softpin_pool[n].hash = bo_gem->softpin_hash;
+    bufmgr_gem->softpin_pool[n].capacity = bo_gem->max_softpin_target_count;
+    bufmgr_gem->softpin_pool_count++;
+
+    bo_gem->softpin_target = nullptr;
+    bo_gem->softpin_hash = nullptr;
+    bo_gem->max_softpin_target_count = 0;
+}
+
+/**
+ * Makes room for more softpin targets. A bo without targets takes a
+ * recycled array from the pool before anything is allocated.
+ */
+static int
+mos_gem_bo_softpin_grow(struct mos_bufmgr_gem *bufmgr_gem, struct mos_bo_gem *bo_gem)
+{
+    struct mos_softpin_target *targets;
+    int capacity = bo_gem->max_softpin_target_count * 2;
+    int *hash;
+    int i;
+
+    if (capacity == 0) {
+        pthread_mutex_lock(&bufmgr_gem->lock);
+        if (bufmgr_gem->softpin_pool_count > 0) {
+            int n = --bufmgr_gem->softpin_pool_count;
+
+            bo_gem->softpin_target = bufmgr_gem->softpin_pool[n].targets;
+            bo_gem->softpin_hash = bufmgr_gem->softpin_pool[n].hash;
+            bo_gem->max_softpin_target_count = bufmgr_gem->softpin_pool[n].capacity;
+        }
+        pthread_mutex_unlock(&bufmgr_gem->lock);
+
+        if (bo_gem->softpin_target != nullptr)
+            return 0;
+        capacity = INITIAL_SOFTPIN_TARGET_COUNT;
+    }
+
+    hash = (int *)calloc(capacity * 2, sizeof(int));
+    if (hash == nullptr)
+        return -ENOMEM;
+
+    targets = (struct mos_softpin_target *)realloc(bo_gem->softpin_target,
+                capacity * sizeof(struct mos_softpin_target));
+    if (targets == nullptr) {
+        free(hash);
+        return -ENOMEM;
+    }
+
+    free(bo_gem->softpin_hash);
+    bo_gem->softpin_target = targets;
+    bo_gem->softpin_hash = hash;
+    bo_gem->max_softpin_target_count = capacity;
+
+    for (i = 0; i < bo_gem->softpin_target_count; i++) {
+        int slot = -1;
+
+        mos_gem_bo_softpin_find(bo_gem, targets[i].bo, &slot);
+        hash[slot] = i + 1;
+    }
+
+    return 0;
+}
+
+/**
+ * Puts a BO whose last reference is being dropped into the calling thread's
+ * magazine. Only plain BOs qualify: not shared by name/prime, without
+ * relocation or softpin targets and small enough for a magazine bucket.
+ *
+ * Returns true if the BO was taken over by the magazine.
+ */
+static bool
+mos_gem_bo_magazine_push(struct mos_bufmgr_gem *bufmgr_gem,
+                    struct mos_bo_gem *bo_gem)
+{
+    struct mos_gem_bo_thread_cache *cache;
+    struct mos_gem_bo_magazine *magazine;
+    struct mos_gem_bo_bucket *bucket;
+    int index;
+
+    if (!bufmgr_gem->bo_reuse || !bo_gem->reusable || bo_gem->global_name != 0 ||
+        bo_gem->reloc_count != 0 || bo_gem->softpin_target_count != 0 ||
+        bo_gem->map_count != 0 || bo_gem->bo.size > MOS_BO_MAGAZINE_MAX_BO_SIZE)
+        return false;
+
+    bucket = mos_gem_bo_bucket_for_size(bufmgr_gem, bo_gem->bo.size);
+    if (bucket == nullptr || bucket->size != bo_gem->bo.size)
+        return false;
+
+    index = bucket - bufmgr_gem->cache_bucket;
+    if (index >= bufmgr_gem->num_magazine_buckets)
+        return false;
+
+    cache = mos_gem_bo_thread_cache_get(bufmgr_gem, true);
+    if (cache == nullptr)
+        return false;
+
+    /* Unnamed BOs cannot be looked up by anybody else, so once we are
+     * the last holder nobody can take a new reference behind our back.
+     */
+    if (!atomic_dec_and_test(&bo_gem->refcount)) {
+        /* somebody else still holds a reference, nothing to cache */
+        return true;
+    }
+
+    bo_gem->used_as_reloc_target = false;
+    bo_gem->exec_async = false;
+    bo_gem->pad_to_size = 0;
+    bo_gem->name = nullptr;
+    bo_gem->validate_index = -1;
+    bo_gem->map_refs = 0;
+    bo_gem->map_hot = false;
+    if (bo_gem->reloc_target_info) {
+        free(bo_gem->reloc_target_info);
+        bo_gem->reloc_target_info = nullptr;
+    }
+    if (bo_gem->relocs) {
+        free(bo_gem->relocs);
+        bo_gem->relocs = nullptr;
+    }
+    mos_gem_bo_softpin_free(bo_gem);
+
+    magazine = &cache->magazine[index];
+    if (magazine->count == MOS_BO_MAGAZINE_DEPTH ||
+        cache->bytes + bo_gem->bo.size > MOS_BO_MAGAZINE_MAX_BYTES) {
+        struct timespec time;
+        int i, evict = magazine->count > 0 ? (magazine->count + 1) / 2 : 0;
 
-    memclear(madv);
-    madv.handle = bo_gem->gem_handle;
-    madv.madv = state;
-    madv.retained = 1;
-    drmIoctl(bufmgr_gem->fd, DRM_IOCTL_I915_GEM_MADVISE, &madv);
+        clock_gettime(CLOCK_MONOTONIC, &time);
 
-    return madv.retained;
-}
+        /* hand the oldest half back to the shared bucket in one lock round trip */
+        pthread_mutex_lock(&bufmgr_gem->lock);
+        for (i = 0; i < evict; i++) {
+            cache->bytes -= magazine->bos[i]->bo.size;
+            mos_gem_bo_magazine_evict_locked(bufmgr_gem, bucket,
+                        magazine->bos[i], time.tv_sec);
+        }
+        if (cache->bytes + bo_gem->bo.size > MOS_BO_MAGAZINE_MAX_BYTES) {
+            mos_gem_bo_magazine_evict_locked(bufmgr_gem, bucket, bo_gem, time.tv_sec);
+            bo_gem = nullptr;
+        }
+        mos_gem_cleanup_bo_cache(bufmgr_gem, time.tv_sec);
+        pthread_mutex_unlock(&bufmgr_gem->lock);
 
-static int
-mos_gem_bo_madvise(struct mos_linux_bo *bo, int madv)
-{
-    return mos_gem_bo_madvise_internal
-        ((struct mos_bufmgr_gem *) bo->bufmgr,
-         (struct mos_bo_gem *) bo,
-         madv);
-}
+        memmove(&magazine->bos[0], &magazine->bos[evict],
+            (magazine->count - evict) * sizeof(magazine->bos[0]));
+        magazine->count -= evict;
 
-/* drop the oldest entries that have been purged by the kernel */
-static void
-mos_gem_bo_cache_purge_bucket(struct mos_bufmgr_gem *bufmgr_gem,
-                    struct mos_gem_bo_bucket *bucket)
-{
-    while (!DRMLISTEMPTY(&bucket->head)) {
-        struct mos_bo_gem *bo_gem;
+        if (bo_gem == nullptr)
+            return true;
+    }
 
-        bo_gem = DRMLISTENTRY(struct mos_bo_gem,
-                      bucket->head.next, head);
-        if (mos_gem_bo_madvise_internal
-            (bufmgr_gem, bo_gem, I915_MADV_DONTNEED))
-            break;
+    magazine->bos[magazine->count++] = bo_gem;
+    cache->bytes += bo_gem->bo.size;
 
-        DRMLISTDEL(&bo_gem->head);
-        mos_gem_bo_free(&bo_gem->bo);
-    }
+    return true;
 }
 
 static int
@@ -1071,6 +1793,17 @@ mos_gem_bo_alloc_internal(struct mos_bufmgr *bufmgr,
         bo_size = bucket->size;
     }
 
+    /* Try the lock-free per-thread magazine first */
+    bo_gem = nullptr;
+    if (bucket != nullptr)
+        bo_gem = mos_gem_bo_magazine_pop(bufmgr_gem, bucket, for_render,
+                            tiling_mode, stride, mem_type);
+    alloc_from_cache = (bo_gem != nullptr);
+    if (alloc_from_cache) {
+        bo_gem->bo.align = alignment;
+        goto cached;
+    }
+
     pthread_mutex_lock(&bufmgr_gem->lock);
     /* Get a buffer out of the cache if available */
 retry:
@@ -1130,6 +1863,7 @@ retry:
     }
     pthread_mutex_unlock(&bufmgr_gem->lock);
 
+cached:
     if (!alloc_from_cache) {
 
         bo_gem = (struct mos_bo_gem *)calloc(1, sizeof(*bo_gem));
@@ -1210,7 +1944,7 @@ retry:
 
     mos_bo_gem_set_in_aperture_size(bufmgr_gem, bo_gem, alignment);
 
-    if (bufmgr_gem->use_softpin)
+    if (bufmgr_gem->use_softpin && !(flags & BO_ALLOC_NO_SOFTPIN))
     {
         mos_bo_set_softpin(&bo_gem->bo);
     }
@@ -1245,14 +1979,13 @@ mos_gem_bo_alloc(struct mos_bufmgr *bufmgr,
                            I915_TILING_NONE, 0, 0, mem_type);
 }
 
-static struct mos_linux_bo *
-mos_gem_bo_alloc_tiled(struct mos_bufmgr *bufmgr, const char *name,
+/* Compute the pitch and size of a tiled allocation of x by y * cpp bytes */
+static void
+mos_gem_bo_tiled_geometry(struct mos_bufmgr_gem *bufmgr_gem,
                  int x, int y, int cpp, uint32_t *tiling_mode,
-                 unsigned long *pitch, unsigned long flags,
-                 int mem_type)
+                 unsigned long *pitch, unsigned long *size,
+                 unsigned long *stride)
 {
-    struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *)bufmgr;
-    unsigned long size, stride;
     uint32_t tiling;
 
     do {
@@ -1282,18 +2015,144 @@ mos_gem_bo_alloc_tiled(struct mos_bufmgr *bufmgr, const char *name,
             height_alignment = 32;
         aligned_y = ALIGN(y, height_alignment);
 
-        stride = x * cpp;
-        stride = mos_gem_bo_tile_pitch(bufmgr_gem, stride, tiling_mode);
-        size = stride * aligned_y;
-        size = mos_gem_bo_tile_size(bufmgr_gem, size, tiling_mode);
+        *stride = x * cpp;
+        *stride = mos_gem_bo_tile_pitch(bufmgr_gem, *stride, tiling_mode);
+        *size = *stride * aligned_y;
+        *size = mos_gem_bo_tile_size(bufmgr_gem, *size, tiling_mode);
     } while (*tiling_mode != tiling);
-    *pitch = stride;
+    *pitch = *stride;
 
     if (tiling == I915_TILING_NONE)
-        stride = 0;
+        *stride = 0;
+}
+
+static struct mos_linux_bo *
+mos_gem_bo_alloc_tiled(struct mos_bufmgr *bufmgr, const char *name,
+                 int x, int y, int cpp, uint32_t *tiling_mode,
+                 unsigned long *pitch, unsigned long flags,
+                 int mem_type)
+{
+    struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *)bufmgr;
+    unsigned long size, stride;
+
+    mos_gem_bo_tiled_geometry(bufmgr_gem, x, y, cpp, tiling_mode,
+                 pitch, &size, &stride);
 
     return mos_gem_bo_alloc_internal(bufmgr, name, size, flags,
-                           tiling, stride, 0, mem_type);
+                           *tiling_mode, stride, 0, mem_type);
+}
+
+/**
+ * Allocates count identically shaped buffer objects in one pass.
+ *
+ * Cached objects are reused as in mos_gem_bo_alloc_internal(). Softpin
+ * addresses for the newly created objects are carved from the VMA heap
+ * with a single allocation under one lock acquisition instead of one per
+ * object.
+ *
+ * Returns the number of objects stored in bos, which is less than count
+ * only if an allocation failed.
+ */
+drm_export int
+mos_gem_bo_alloc_batch(struct mos_bufmgr *bufmgr,
+                const char *name,
+                unsigned long size,
+                unsigned long flags,
+                uint32_t tiling_mode,
+                unsigned long stride,
+                unsigned int alignment,
+                int mem_type,
+                struct mos_linux_bo **bos,
+                int count)
+{
+    struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *)bufmgr;
+    int i, allocated, pending = 0, region = -1;
+    uint64_t vma_alignment, vma_stride, base;
+
+    CHK_CONDITION(bufmgr_gem == nullptr || bos == nullptr || count <= 0, "invalid parameter.\n", 0);
+
+    for (allocated = 0; allocated < count; allocated++) {
+        bos[allocated] = mos_gem_bo_alloc_internal(bufmgr, name, size,
+                            flags | BO_ALLOC_NO_SOFTPIN, tiling_mode,
+                            stride, alignment, mem_type);
+        if (bos[allocated] == nullptr)
+            break;
+    }
+
+    if (!bufmgr_gem->use_softpin || allocated == 0)
+        return allocated;
+
+    /* All objects of one batch share size and memory type, so the
+     * ones without an address yet can be placed back to back.
+     */
+    for (i = 0; i < allocated; i++) {
+        struct mos_bo_gem *bo_gem = (struct mos_bo_gem *)bos[i];
+
+        if (mos_gem_bo_is_softpin(bos[i]))
+            continue;
+        if (region == -1)
+            region = bo_gem->mem_region;
+        if (bo_gem->mem_region != region || bos[i]->size != bos[0]->size)
+            region = -2;
+        pending++;
+    }
+
+    vma_alignment = (bufmgr_gem->softpin_va1Malign) ? PAGE_SIZE_1M : PAGE_SIZE_64K;
+    vma_stride    = ALIGN((uint64_t)bos[0]->size, vma_alignment);
+    base          = 0;
+
+    if (pending > 1 && region >= 0) {
+        pthread_mutex_lock(&bufmgr_gem->lock);
+        base = mos_gem_bo_vma_alloc(bufmgr, (enum mos_memory_zone)region,
+                    vma_stride * pending, vma_alignment);
+        if (base != 0) {
+            uint64_t offset = base;
+
+            for (i = 0; i < allocated; i++) {
+                if (mos_gem_bo_is_softpin(bos[i]))
+                    continue;
+                mos_gem_bo_set_softpin_offset(bos[i], offset);
+                /* give the alignment padding back right away, each object
+                 * returns exactly its own size when it is freed */
+                if (vma_stride > bos[i]->size)
+                    mos_gem_bo_vma_free(bufmgr, offset + bos[i]->size,
+                                vma_stride - bos[i]->size);
+                offset += vma_stride;
+            }
+        }
+        pthread_mutex_unlock(&bufmgr_gem->lock);
+    }
+
+    for (i = 0; i < allocated; i++) {
+        if (mos_gem_bo_is_softpin(bos[i]))
+            mos_bo_use_48b_address_range(bos[i], 1);
+        else
+            mos_bo_set_softpin(bos[i]);
+    }
+
+    return allocated;
+}
+
+/**
+ * Tiled variant of mos_gem_bo_alloc_batch(), the geometry is computed once
+ * for the whole batch.
+ */
+drm_export int
+mos_gem_bo_alloc_tiled_batch(struct mos_bufmgr *bufmgr, const char *name,
+                 int x, int y, int cpp, uint32_t *tiling_mode,
+                 unsigned long *pitch, unsigned long flags,
+                 int mem_type, struct mos_linux_bo **bos, int count)
+{
+    struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *)bufmgr;
+    unsigned long size, stride;
+
+    CHK_CONDITION(bufmgr_gem == nullptr || tiling_mode == nullptr || pitch == nullptr, "invalid parameter.\n", 0);
+
+    mos_gem_bo_tiled_geometry(bufmgr_gem, x, y, cpp, tiling_mode,
+                 pitch, &size, &stride);
+
+    return mos_gem_bo_alloc_batch(bufmgr, name, size, flags,
+                           *tiling_mode, stride, 0, mem_type, bos, count);
 }
 
 static struct mos_linux_bo *
@@ -1559,19 +2418,85 @@ mos_bo_gem_create_from_name(struct mos_bufmgr *bufmgr,
     return &bo_gem->bo;
 }
 
-drm_export void
-mos_gem_bo_free(struct mos_linux_bo *bo)
+static void
+mos_gem_bo_map_lru_remove_locked(struct mos_bufmgr_gem *bufmgr_gem, struct mos_bo_gem *bo_gem)
 {
-    struct mos_bufmgr_gem *bufmgr_gem = nullptr;
-    struct mos_bo_gem *bo_gem = (struct mos_bo_gem *) bo;
-    struct drm_gem_close close;
-    int ret;
+    if (!bo_gem->in_map_lru)
+        return;
 
-    CHK_CONDITION(bo_gem == nullptr, "bo_gem == nullptr\n", );
+    DRMLISTDEL(&bo_gem->map_lru);
+    bo_gem->in_map_lru = false;
+    bufmgr_gem->map_lru_bytes -= bo_gem->bo.size;
+}
 
-    bufmgr_gem = (struct mos_bufmgr_gem *) bo->bufmgr;
+/** Unmaps all the CPU mappings of an unused buffer object. */
+static void
+mos_gem_bo_drop_mappings(struct mos_bo_gem *bo_gem)
+{
+    if (bo_gem->mem_virtual) {
+        VG(VALGRIND_FREELIKE_BLOCK(bo_gem->mem_virtual, 0));
+        drm_munmap(bo_gem->mem_virtual, bo_gem->bo.size);
+        bo_gem->mem_virtual = nullptr;
+    }
+    if (bo_gem->gtt_virtual) {
+        drm_munmap(bo_gem->gtt_virtual, bo_gem->bo.size);
+        bo_gem->gtt_virtual = nullptr;
+    }
+    if (bo_gem->mem_wc_virtual) {
+        VG(VALGRIND_FREELIKE_BLOCK(bo_gem->mem_wc_virtual, 0));
+        drm_munmap(bo_gem->mem_wc_virtual, bo_gem->bo.size);
+        bo_gem->mem_wc_virtual = nullptr;
+    }
+#ifdef __cplusplus
+    bo_gem->bo.virt = nullptr;
+#else
+    bo_gem->bo.virtual = nullptr;
+#endif
+}
 
-    CHK_CONDITION(bufmgr_gem == nullptr, "bufmgr_gem == nullptr\n", );
+/**
+ * Puts a buffer object whose last map was released on the mapping LRU and
+ * unmaps the oldest unused buffers while the budget is exceeded. Hot
+ * buffers keep their mappings and never enter the LRU.
+ */
+static void
+mos_gem_bo_map_lru_add_locked(struct mos_bufmgr_gem *bufmgr_gem, struct mos_bo_gem *bo_gem)
+{
+    if (bo_gem->map_hot || bo_gem->in_map_lru)
+        return;
+
+    if (!bo_gem->mem_virtual && !bo_gem->gtt_virtual && !bo_gem->mem_wc_virtual)
+        return;
+
+    DRMLISTADDTAIL(&bo_gem->map_lru, &bufmgr_gem->map_lru);
+    bo_gem->in_map_lru = true;
+    bufmgr_gem->map_lru_bytes += bo_gem->bo.size;
+
+    if (bufmgr_gem->map_cache_budget == 0)
+        return;
+
+    while (bufmgr_gem->map_lru_bytes > bufmgr_gem->map_cache_budget &&
+           !DRMLISTEMPTY(&bufmgr_gem->map_lru)) {
+        struct mos_bo_gem *victim = DRMLISTENTRY(struct mos_bo_gem,
+                                    bufmgr_gem->map_lru.next, map_lru);
+
+        MOS_DBG("bo_map_lru: unmap %d (%s), %lu bytes cached\n",
+            victim->gem_handle, victim->name, (unsigned long)bufmgr_gem->map_lru_bytes);
+        mos_gem_bo_map_lru_remove_locked(bufmgr_gem, victim);
+        mos_gem_bo_drop_mappings(victim);
+    }
+}
+
+/**
+ * Drops the CPU mappings and the kernel handle of a buffer object. This is
+ * the expensive part of freeing and may be run from the reaper thread.
+ */
+static void
+mos_gem_bo_release_handle(struct mos_bufmgr_gem *bufmgr_gem, struct mos_bo_gem *bo_gem)
+{
+    struct mos_linux_bo *bo = &bo_gem->bo;
+    struct drm_gem_close close;
+    int ret;
 
     if (bo_gem->mem_virtual) {
         VG(VALGRIND_FREELIKE_BLOCK(bo_gem->mem_virtual, 0));
@@ -1590,31 +2515,167 @@ mos_gem_bo_free(struct mos_linux_bo *bo)
         bufmgr_gem->bufmgr.bo_wait_rendering(bo);
     }
 
-    /* Close this object */
-    memclear(close);
-    close.handle = bo_gem->gem_handle;
-    ret = drmIoctl(bufmgr_gem->fd, DRM_IOCTL_GEM_CLOSE, &close);
-    if (ret != 0) {
-        MOS_DBG("DRM_IOCTL_GEM_CLOSE %d failed (%s): %s\n",
-            bo_gem->gem_handle, bo_gem->name, strerror(errno));
-    }
-    if (bufmgr_gem->mem_profiler_fd != -1)
-    {
-        snprintf(bufmgr_gem->mem_profiler_buffer, MEM_PROFILER_BUFFER_SIZE, "GEM_CLOSE, %d, %d, %lu, %d\n", getpid(), bo->handle,bo->size,bo_gem->mem_region);
-        ret = write(bufmgr_gem->mem_profiler_fd, bufmgr_gem->mem_profiler_buffer, strnlen(bufmgr_gem->mem_profiler_buffer, MEM_PROFILER_BUFFER_SIZE));
-        if (ret == -1)
-        {
-            MOS_DBG("Failed to write to %s: %s\n", bufmgr_gem->mem_profiler_path, strerror(errno));
-        }
-    }
+    /* The binding holds its own reference on the object */
+    if (bo_gem->bound_vm_id != 0) {
+        ret = bufmgr_gem->prelim->VmUnbind(bo_gem->bound_vm_id, bo->offset64, bo->size);
+        if (ret != 0) {
+            MOS_DBG("VM_UNBIND %d (%s) failed: %s\n",
+                bo_gem->gem_handle, bo_gem->name, strerror(-ret));
+        }
+        bo_gem->bound_vm_id = 0;
+    }
+
+    /* Close this object */
+    memclear(close);
+    close.handle = bo_gem->gem_handle;
+    ret = drmIoctl(bufmgr_gem->fd, DRM_IOCTL_GEM_CLOSE, &close);
+    if (ret != 0) {
+        MOS_DBG("DRM_IOCTL_GEM_CLOSE %d failed (%s): %s\n",
+            bo_gem->gem_handle, bo_gem->name, strerror(errno));
+    }
+}
+
+/**
+ * Returns the address range of a released buffer object and frees its
+ * memory. Must run with the same locking as the synchronous free path.
+ */
+static void
+mos_gem_bo_release_memory(struct mos_bufmgr_gem *bufmgr_gem, struct mos_bo_gem *bo_gem)
+{
+    struct mos_linux_bo *bo = &bo_gem->bo;
+    int ret;
+
+    if (bufmgr_gem->mem_profiler_fd != -1)
+    {
+        snprintf(bufmgr_gem->mem_profiler_buffer, MEM_PROFILER_BUFFER_SIZE, "GEM_CLOSE, %d, %d, %lu, %d\n", getpid(), bo->handle,bo->size,bo_gem->mem_region);
+        ret = write(bufmgr_gem->mem_profiler_fd, bufmgr_gem->mem_profiler_buffer, strnlen(bufmgr_gem->mem_profiler_buffer, MEM_PROFILER_BUFFER_SIZE));
+        if (ret == -1)
+        {
+            MOS_DBG("Failed to write to %s: %s\n", bufmgr_gem->mem_profiler_path, strerror(errno));
+        }
+    }
+
+    if (bufmgr_gem->use_softpin)
+    {
+        /* Return the VMA for reuse */
+        mos_gem_bo_vma_free(bo->bufmgr, bo->offset64, bo->size);
+    }
+
+    free(bo);
+}
+
+/**
+ * Hands a buffer object over to the reaper thread.
+ *
+ * Returns false if the reaper is not running or its queue is full, in which
+ * case the caller has to free the object itself.
+ */
+static bool
+mos_gem_bo_reaper_queue(struct mos_bufmgr_gem *bufmgr_gem, struct mos_bo_gem *bo_gem)
+{
+    bool queued = false;
+
+    if (!bufmgr_gem->reaper.running)
+        return false;
+
+    pthread_mutex_lock(&bufmgr_gem->reaper.mutex);
+    if (!bufmgr_gem->reaper.stop &&
+        bufmgr_gem->reaper.count < MOS_BO_REAPER_MAX_QUEUED &&
+        bufmgr_gem->reaper.bytes + bo_gem->bo.size <= MOS_BO_REAPER_MAX_BYTES) {
+        DRMLISTADDTAIL(&bo_gem->head, &bufmgr_gem->reaper.queue);
+        bufmgr_gem->reaper.count++;
+        bufmgr_gem->reaper.bytes += bo_gem->bo.size;
+        pthread_cond_signal(&bufmgr_gem->reaper.cond);
+        queued = true;
+    }
+    pthread_mutex_unlock(&bufmgr_gem->reaper.mutex);
+
+    return queued;
+}
+
+static void *
+mos_gem_bo_reaper_main(void *arg)
+{
+    struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *)arg;
+    drmMMListHead batch;
+
+    pthread_mutex_lock(&bufmgr_gem->reaper.mutex);
+    for (;;) {
+        while (DRMLISTEMPTY(&bufmgr_gem->reaper.queue) && !bufmgr_gem->reaper.stop)
+            pthread_cond_wait(&bufmgr_gem->reaper.cond, &bufmgr_gem->reaper.mutex);
+
+        if (DRMLISTEMPTY(&bufmgr_gem->reaper.queue))
+            break;
+
+        /* Take the whole queue so producers are not blocked while closing */
+        DRMINITLISTHEAD(&batch);
+        DRMLISTJOIN(&bufmgr_gem->reaper.queue, &batch);
+        DRMINITLISTHEAD(&bufmgr_gem->reaper.queue);
+        bufmgr_gem->reaper.count = 0;
+        bufmgr_gem->reaper.bytes = 0;
+        pthread_mutex_unlock(&bufmgr_gem->reaper.mutex);
+
+        struct mos_bo_gem *bo_gem, *next;
+        DRMLISTFOREACHENTRYSAFE(bo_gem, next, &batch, head) {
+            mos_gem_bo_release_handle(bufmgr_gem, bo_gem);
+        }
+
+        /* Return all the address ranges under a single lock */
+        pthread_mutex_lock(&bufmgr_gem->lock);
+        DRMLISTFOREACHENTRYSAFE(bo_gem, next, &batch, head) {
+            DRMLISTDEL(&bo_gem->head);
+            mos_gem_bo_release_memory(bufmgr_gem, bo_gem);
+        }
+        pthread_mutex_unlock(&bufmgr_gem->lock);
+
+        pthread_mutex_lock(&bufmgr_gem->reaper.mutex);
+    }
+    pthread_mutex_unlock(&bufmgr_gem->reaper.mutex);
+
+    return nullptr;
+}
+
+/**
+ * Stops the reaper thread once everything queued has been freed.
+ */
+static void
+mos_gem_bo_reaper_stop(struct mos_bufmgr_gem *bufmgr_gem)
+{
+    if (!bufmgr_gem->reaper.running)
+        return;
+
+    pthread_mutex_lock(&bufmgr_gem->reaper.mutex);
+    bufmgr_gem->reaper.stop = true;
+    pthread_cond_signal(&bufmgr_gem->reaper.cond);
+    pthread_mutex_unlock(&bufmgr_gem->reaper.mutex);
+
+    pthread_join(bufmgr_gem->reaper.thread, nullptr);
+    bufmgr_gem->reaper.running = false;
+
+    pthread_cond_destroy(&bufmgr_gem->reaper.cond);
+    pthread_mutex_destroy(&bufmgr_gem->reaper.mutex);
+}
+
+drm_export void
+mos_gem_bo_free(struct mos_linux_bo *bo)
+{
+    struct mos_bufmgr_gem *bufmgr_gem = nullptr;
+    struct mos_bo_gem *bo_gem = (struct mos_bo_gem *) bo;
+
+    CHK_CONDITION(bo_gem == nullptr, "bo_gem == nullptr\n", );
+
+    bufmgr_gem = (struct mos_bufmgr_gem *) bo->bufmgr;
+
+    CHK_CONDITION(bufmgr_gem == nullptr, "bufmgr_gem == nullptr\n", );
 
-    if (bufmgr_gem->use_softpin)
-    {
-        /* Return the VMA for reuse */
-        mos_gem_bo_vma_free(bo->bufmgr, bo->offset64, bo->size);
-    }
+    /* The bufmgr lock is held by every caller while the bo can be in the LRU */
+    mos_gem_bo_map_lru_remove_locked(bufmgr_gem, bo_gem);
 
-    free(bo);
+    if (mos_gem_bo_reaper_queue(bufmgr_gem, bo_gem))
+        return;
+
+    mos_gem_bo_release_handle(bufmgr_gem, bo_gem);
+    mos_gem_bo_release_memory(bufmgr_gem, bo_gem);
 }
 
 static void
@@ -1685,7 +2746,7 @@ mos_gem_bo_unreference_final(struct mos_linux_bo *bo, time_t time)
                                   time);
     bo_gem->reloc_count = 0;
     bo_gem->used_as_reloc_target = false;
-    bo_gem->softpin_target_count = 0;
+    mos_gem_bo_softpin_reset(bo_gem);
     bo_gem->exec_async = false;
 
     MOS_DBG("bo_unreference final: %d (%s)\n",
@@ -1701,11 +2762,7 @@ mos_gem_bo_unreference_final(struct mos_linux_bo *bo, time_t time)
         free(bo_gem->relocs);
         bo_gem->relocs = nullptr;
     }
-    if (bo_gem->softpin_target) {
-        free(bo_gem->softpin_target);
-        bo_gem->softpin_target = nullptr;
-        bo_gem->max_softpin_target_count = 0;
-    }
+    mos_gem_bo_softpin_release_locked(bufmgr_gem, bo_gem);
 
     /* Clear any left-over mappings */
     if (bo_gem->map_count) {
@@ -1713,6 +2770,9 @@ mos_gem_bo_unreference_final(struct mos_linux_bo *bo, time_t time)
         bo_gem->map_count = 0;
         mos_gem_bo_mark_mmaps_incoherent(bo);
     }
+    bo_gem->map_refs = 0;
+    bo_gem->map_hot = false;
+    mos_gem_bo_map_lru_add_locked(bufmgr_gem, bo_gem);
 
     DRMLISTDEL(&bo_gem->name_list);
 
@@ -1753,6 +2813,9 @@ static void mos_gem_bo_unreference(struct mos_linux_bo *bo)
             (struct mos_bufmgr_gem *) bo->bufmgr;
         struct timespec time;
 
+        if (mos_gem_bo_magazine_push(bufmgr_gem, bo_gem))
+            return;
+
         clock_gettime(CLOCK_MONOTONIC, &time);
 
         pthread_mutex_lock(&bufmgr_gem->lock);
@@ -1779,6 +2842,8 @@ map_wc(struct mos_linux_bo *bo)
     if (!bufmgr_gem->has_ext_mmap)
         return -EINVAL;
 
+    mos_gem_bo_map_lru_remove_locked(bufmgr_gem, bo_gem);
+
     /* Get a mapping of the buffer if we haven't before. */
     if (bo_gem->mem_wc_virtual == nullptr && bufmgr_gem->has_mmap_offset) {
         struct drm_i915_gem_mmap_offset mmap_arg;
@@ -1855,6 +2920,7 @@ map_wc(struct mos_linux_bo *bo)
     MOS_DBG("bo_map_wc: %d (%s) -> %p\n", bo_gem->gem_handle, bo_gem->name,
         bo_gem->mem_wc_virtual);
 
+    bo_gem->map_refs++;
     return 0;
 }
 
@@ -1867,6 +2933,8 @@ mos_gem_bo_map_wc(struct mos_linux_bo *bo) {
     struct drm_i915_gem_wait wait;
     int ret;
 
+    mos_gem_bo_wait_queued(bufmgr_gem, bo_gem, -1);
+
     pthread_mutex_lock(&bufmgr_gem->lock);
 
     ret = map_wc(bo);
@@ -1875,7 +2943,9 @@ mos_gem_bo_map_wc(struct mos_linux_bo *bo) {
         return ret;
     }
 
-    if (bufmgr_gem->has_lmem) {
+    if (bo_gem->map_hot && bo_gem->map_synced) {
+        /* Not used by the GPU since the last synchronized map */
+    } else if (bufmgr_gem->has_lmem) {
         assert(bufmgr_gem->has_wait_timeout);
         memclear(wait);
         wait.bo_handle = bo_gem->gem_handle;
@@ -1907,6 +2977,7 @@ mos_gem_bo_map_wc(struct mos_linux_bo *bo) {
                 strerror(errno));
         }
     }
+    bo_gem->map_synced = bo_gem->map_hot;
 
     mos_gem_bo_mark_mmaps_incoherent(bo);
     VG(VALGRIND_MAKE_MEM_DEFINED(bo_gem->mem_wc_virtual, bo->size));
@@ -1952,8 +3023,12 @@ drm_export int mos_gem_bo_map(struct mos_linux_bo *bo, int write_enable)
         return 0;
     }
 
+    mos_gem_bo_wait_queued(bufmgr_gem, bo_gem, -1);
+
     pthread_mutex_lock(&bufmgr_gem->lock);
 
+    mos_gem_bo_map_lru_remove_locked(bufmgr_gem, bo_gem);
+
     if (bufmgr_gem->has_mmap_offset) {
         struct drm_i915_gem_wait wait;
 
@@ -1998,14 +3073,16 @@ drm_export int mos_gem_bo_map(struct mos_linux_bo *bo, int write_enable)
             }
         }
 
-        assert(bufmgr_gem->has_wait_timeout);
-        memclear(wait);
-        wait.bo_handle = bo_gem->gem_handle;
-        wait.timeout_ns = -1; // infinite wait
-        ret = drmIoctl(bufmgr_gem->fd, DRM_IOCTL_I915_GEM_WAIT, &wait);
-        if (ret == -1) {
-            MOS_DBG("%s:%d: DRM_IOCTL_I915_GEM_WAIT failed (%d)\n",
-                __FILE__, __LINE__, errno);
+        if (!bo_gem->map_hot || !bo_gem->map_synced) {
+            assert(bufmgr_gem->has_wait_timeout);
+            memclear(wait);
+            wait.bo_handle = bo_gem->gem_handle;
+            wait.timeout_ns = -1; // infinite wait
+            ret = drmIoctl(bufmgr_gem->fd, DRM_IOCTL_I915_GEM_WAIT, &wait);
+            if (ret == -1) {
+                MOS_DBG("%s:%d: DRM_IOCTL_I915_GEM_WAIT failed (%d)\n",
+                    __FILE__, __LINE__, errno);
+            }
         }
     } else { /*!has_mmap_offset*/
         struct drm_i915_gem_set_domain set_domain;
@@ -2034,22 +3111,26 @@ drm_export int mos_gem_bo_map(struct mos_linux_bo *bo, int write_enable)
             bo_gem->mem_virtual = (void *)(uintptr_t) mmap_arg.addr_ptr;
         }
 
-        memclear(set_domain);
-        set_domain.handle = bo_gem->gem_handle;
-        set_domain.read_domains = I915_GEM_DOMAIN_CPU;
-        if (write_enable)
-            set_domain.write_domain = I915_GEM_DOMAIN_CPU;
-        else
-            set_domain.write_domain = 0;
-        ret = drmIoctl(bufmgr_gem->fd,
-            DRM_IOCTL_I915_GEM_SET_DOMAIN,
-            &set_domain);
-        if (ret != 0) {
-            MOS_DBG("%s:%d: Error setting to CPU domain %d: %s\n",
-            __FILE__, __LINE__, bo_gem->gem_handle,
-            strerror(errno));
+        if (!bo_gem->map_hot || !bo_gem->map_synced) {
+            memclear(set_domain);
+            set_domain.handle = bo_gem->gem_handle;
+            set_domain.read_domains = I915_GEM_DOMAIN_CPU;
+            if (write_enable)
+                set_domain.write_domain = I915_GEM_DOMAIN_CPU;
+            else
+                set_domain.write_domain = 0;
+            ret = drmIoctl(bufmgr_gem->fd,
+                DRM_IOCTL_I915_GEM_SET_DOMAIN,
+                &set_domain);
+            if (ret != 0) {
+                MOS_DBG("%s:%d: Error setting to CPU domain %d: %s\n",
+                __FILE__, __LINE__, bo_gem->gem_handle,
+                strerror(errno));
+            }
         }
     }
+    bo_gem->map_synced = bo_gem->map_hot;
+    bo_gem->map_refs++;
     MOS_DBG("bo_map: %d (%s) -> %p\n", bo_gem->gem_handle, bo_gem->name,
         bo_gem->mem_virtual);
 #ifdef __cplusplus
@@ -2078,6 +3159,8 @@ map_gtt(struct mos_linux_bo *bo)
     if (bo_gem->is_userptr)
         return -EINVAL;
 
+    mos_gem_bo_map_lru_remove_locked(bufmgr_gem, bo_gem);
+
     /* Get a mapping of the buffer if we haven't before. */
     if (bo_gem->gtt_virtual == nullptr) {
         __u64 offset = 0;
@@ -2149,6 +3232,7 @@ map_gtt(struct mos_linux_bo *bo)
     MOS_DBG("bo_map_gtt: %d (%s) -> %p\n", bo_gem->gem_handle, bo_gem->name,
         bo_gem->gtt_virtual);
 
+    bo_gem->map_refs++;
     return 0;
 }
 
@@ -2161,6 +3245,8 @@ mos_gem_bo_map_gtt(struct mos_linux_bo *bo)
     struct drm_i915_gem_wait wait;
     int ret;
 
+    mos_gem_bo_wait_queued(bufmgr_gem, bo_gem, -1);
+
     pthread_mutex_lock(&bufmgr_gem->lock);
 
     ret = map_gtt(bo);
@@ -2169,7 +3255,9 @@ mos_gem_bo_map_gtt(struct mos_linux_bo *bo)
         return ret;
     }
 
-    if (bufmgr_gem->has_lmem) {
+    if (bo_gem->map_hot && bo_gem->map_synced) {
+        /* Not used by the GPU since the last synchronized map */
+    } else if (bufmgr_gem->has_lmem) {
         assert(bufmgr_gem->has_wait_timeout);
         memclear(wait);
         wait.bo_handle = bo_gem->gem_handle;
@@ -2202,6 +3290,8 @@ mos_gem_bo_map_gtt(struct mos_linux_bo *bo)
                 strerror(errno));
         }
     }
+    bo_gem->map_synced = bo_gem->map_hot;
+
     mos_gem_bo_mark_mmaps_incoherent(bo);
     VG(VALGRIND_MAKE_MEM_DEFINED(bo_gem->gtt_virtual, bo->size));
     pthread_mutex_unlock(&bufmgr_gem->lock);
@@ -2271,6 +3361,9 @@ drm_export int mos_gem_bo_unmap(struct mos_linux_bo *bo)
 
     pthread_mutex_lock(&bufmgr_gem->lock);
 
+    if (bo_gem->map_refs > 0 && --bo_gem->map_refs == 0)
+        mos_gem_bo_map_lru_add_locked(bufmgr_gem, bo_gem);
+
     if (bo_gem->map_count <= 0) {
         MOS_DBG("attempted to unmap an unmapped bo\n");
         pthread_mutex_unlock(&bufmgr_gem->lock);
@@ -2430,6 +3523,9 @@ mos_gem_bo_wait_rendering(struct mos_linux_bo *bo)
  * handle. Userspace must make sure this race does not occur if such precision
  * is important.
  *
+ * Buffers last submitted with a timeline point wait on that point instead
+ * of the implicit fences of the object.
+ *
  * Note that some kernels have broken the inifite wait for negative values
  * promise, upgrade to latest stable kernels if this is the case.
  */
@@ -2442,6 +3538,13 @@ mos_gem_bo_wait(struct mos_linux_bo *bo, int64_t timeout_ns)
     struct drm_i915_gem_wait wait;
     int ret;
 
+    ret = mos_gem_bo_wait_queued(bufmgr_gem, bo_gem, timeout_ns);
+    if (ret != 0)
+        return ret;
+
+    if (mos_gem_bo_has_exec_point(bufmgr_gem, bo_gem))
+        return mos_gem_timeline_wait(bufmgr_gem, bo_gem->exec_point, timeout_ns);
+
     if (!bufmgr_gem->has_wait_timeout) {
         MOS_DBG("%s:%d: Timed wait is not supported. Falling back to "
             "infinite wait\n", __FILE__, __LINE__);
@@ -2479,6 +3582,8 @@ mos_gem_bo_start_gtt_access(struct mos_linux_bo *bo, int write_enable)
     struct drm_i915_gem_wait wait;
     int ret;
 
+    mos_gem_bo_wait_queued(bufmgr_gem, bo_gem, -1);
+
     if (bufmgr_gem->has_lmem) {
         assert(bufmgr_gem->has_wait_timeout);
         memclear(wait);
@@ -2513,10 +3618,42 @@ mos_bufmgr_gem_destroy(struct mos_bufmgr *bufmgr)
     struct drm_gem_close close_bo;
     int i, ret;
 
+    /* Drain the deferred frees, everything below is freed synchronously */
+    mos_gem_bo_reaper_stop(bufmgr_gem);
+    mos_gem_timeline_fini(bufmgr_gem);
+
     free(bufmgr_gem->exec2_objects);
     free(bufmgr_gem->exec_objects);
     free(bufmgr_gem->exec_bos);
+    free(bufmgr_gem->exec_bound_bos);
+    for (i = 0; i < bufmgr_gem->softpin_pool_count; i++) {
+        free(bufmgr_gem->softpin_pool[i].targets);
+        free(bufmgr_gem->softpin_pool[i].hash);
+    }
+
+    /* Move all per-thread magazines back to the shared buckets */
+    if (bufmgr_gem->has_magazine_key) {
+        pthread_key_delete(bufmgr_gem->magazine_key);
+        bufmgr_gem->has_magazine_key = false;
+
+        while (!DRMLISTEMPTY(&bufmgr_gem->thread_caches)) {
+            struct mos_gem_bo_thread_cache *cache;
+
+            cache = DRMLISTENTRY(struct mos_gem_bo_thread_cache,
+                          bufmgr_gem->thread_caches.next, link);
+            mos_gem_bo_thread_cache_flush_locked(cache, 0);
+            DRMLISTDEL(&cache->link);
+            free(cache);
+        }
+    }
+    MOS_DBG("bo reuse: %d magazine hits, %d misses, %d evictions\n",
+        atomic_read(&bufmgr_gem->reuse_hit),
+        atomic_read(&bufmgr_gem->reuse_miss),
+        atomic_read(&bufmgr_gem->reuse_evict));
+
     pthread_mutex_destroy(&bufmgr_gem->lock);
+    pthread_cond_destroy(&bufmgr_gem->queued.cond);
+    pthread_mutex_destroy(&bufmgr_gem->queued.mutex);
 
     /* Free any cached buffer objects we were going to reuse */
     for (i = 0; i < bufmgr_gem->num_buckets; i++) {
@@ -2761,14 +3898,9 @@ mos_gem_bo_set_exec_object_async(struct mos_linux_bo *bo, struct mos_linux_bo *t
         }
     }
 
-    for (i = 0; i < bo_gem->softpin_target_count; i++)
-    {
-        if (bo_gem->softpin_target[i].bo == target_bo)
-        {
-            bo_gem->softpin_target[i].flags |= EXEC_OBJECT_ASYNC;
-            break;
-        }
-    }
+    i = mos_gem_bo_softpin_find(bo_gem, target_bo, nullptr);
+    if (i >= 0)
+        bo_gem->softpin_target[i].flags |= EXEC_OBJECT_ASYNC;
 }
 
 static void
@@ -2808,22 +3940,6 @@ mos_gem_bo_add_softpin_target(struct mos_linux_bo *bo, struct mos_linux_bo *targ
     if (target_bo_gem == bo_gem)
         return -EINVAL;
 
-    if (bo_gem->softpin_target_count == bo_gem->max_softpin_target_count) {
-        int max_softpin_target_count = bo_gem->max_softpin_target_count * 2;
-
-        /* initial softpin target count*/
-        if (max_softpin_target_count == 0){
-            max_softpin_target_count = INITIAL_SOFTPIN_TARGET_COUNT;
-        }
-
-        bo_gem->softpin_target = (struct mos_softpin_target *)realloc(bo_gem->softpin_target, max_softpin_target_count *
-                sizeof(struct mos_softpin_target));
-        if (!bo_gem->softpin_target)
-            return -ENOMEM;
-
-        bo_gem->max_softpin_target_count = max_softpin_target_count;
-    }
-
     int flags = EXEC_OBJECT_PINNED;
     if (target_bo_gem->pad_to_size)
         flags |= EXEC_OBJECT_PAD_TO_SIZE;
@@ -2836,6 +3952,24 @@ mos_gem_bo_add_softpin_target(struct mos_linux_bo *bo, struct mos_linux_bo *targ
     if (write_flag)
         flags |= EXEC_OBJECT_WRITE;
 
+    /* Command buffers patch the same resource many times, keep a single
+     * target per bo.
+     */
+    int hash_slot = -1;
+    int index = mos_gem_bo_softpin_find(bo_gem, target_bo, &hash_slot);
+    if (index >= 0) {
+        bo_gem->softpin_target[index].flags |= flags;
+        bufmgr_gem->exec_stats.targets_merged++;
+        return 0;
+    }
+
+    if (bo_gem->softpin_target_count == bo_gem->max_softpin_target_count) {
+        if (mos_gem_bo_softpin_grow(bufmgr_gem, bo_gem) != 0)
+            return -ENOMEM;
+        mos_gem_bo_softpin_find(bo_gem, target_bo, &hash_slot);
+    }
+
+    bo_gem->softpin_hash[hash_slot] = bo_gem->softpin_target_count + 1;
     bo_gem->softpin_target[bo_gem->softpin_target_count].bo = target_bo;
     bo_gem->softpin_target[bo_gem->softpin_target_count].flags = flags;
     mos_gem_bo_reference(target_bo);
@@ -3018,7 +4152,8 @@ mos_gem_bo_clear_relocs(struct mos_linux_bo *bo, int start)
         struct mos_bo_gem *target_bo_gem = (struct mos_bo_gem *) bo_gem->softpin_target[i].bo;
         mos_gem_bo_unreference_locked_timed(&target_bo_gem->bo, time.tv_sec);
     }
-    bo_gem->softpin_target_count = 0;
+    /* The target array stays with the bo for its next command buffer */
+    mos_gem_bo_softpin_reset(bo_gem);
 
     pthread_mutex_unlock(&bufmgr_gem->lock);
 
@@ -3214,6 +4349,8 @@ mos_gem_bo_exec(struct mos_linux_bo *bo, int used,
     for (i = 0; i < bufmgr_gem->exec_count; i++) {
         struct mos_bo_gem *bo_gem = to_bo_gem(bufmgr_gem->exec_bos[i]);
         bo_gem->idle = false;
+        bo_gem->map_synced = false;
+        bo_gem->exec_point = 0;
 
         /* Disconnect the buffer from the validate list */
         bo_gem->validate_index = -1;
@@ -3234,6 +4371,9 @@ do_exec2(struct mos_linux_bo *bo, int used, struct mos_linux_context *ctx,
 
     struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *)bo->bufmgr;
     struct drm_i915_gem_execbuffer2 execbuf;
+    struct drm_i915_gem_exec_fence timeline_fence;
+    struct drm_i915_gem_execbuffer_ext_timeline_fences timeline_ext;
+    uint64_t timeline_point = 0;
     int ret = 0;
     int i;
 
@@ -3261,8 +4401,12 @@ do_exec2(struct mos_linux_bo *bo, int used, struct mos_linux_context *ctx,
     }
 
     pthread_mutex_lock(&bufmgr_gem->lock);
+    if (bufmgr_gem->use_vm_bind && ctx != nullptr && ctx->vm != nullptr)
+        bufmgr_gem->exec_vm_id = ctx->vm->vm_id;
+
     /* Update indices and set up the validate list. */
     mos_gem_bo_process_reloc2(bo);
+    bufmgr_gem->exec_vm_id = 0;
 
     /* Add the batch buffer to the validation list.  There are no relocations
      * pointing to it.
@@ -3296,10 +4440,42 @@ do_exec2(struct mos_linux_bo *bo, int used, struct mos_linux_context *ctx,
     if (bufmgr_gem->no_exec)
         goto skip_execution;
 
+    /* Signal the next timeline point, cliprects_ptr carries the extension */
+    if (bufmgr_gem->has_timeline && cliprects == nullptr &&
+        !(flags & (I915_EXEC_FENCE_ARRAY | I915_EXEC_USE_EXTENSIONS))) {
+        timeline_point = bufmgr_gem->timeline.next_point + 1;
+
+        memclear(timeline_fence);
+        timeline_fence.handle = bufmgr_gem->timeline.handle;
+        timeline_fence.flags = I915_EXEC_FENCE_SIGNAL;
+
+        memclear(timeline_ext);
+        timeline_ext.base.name = DRM_I915_GEM_EXECBUFFER_EXT_TIMELINE_FENCES;
+        timeline_ext.fence_count = 1;
+        timeline_ext.handles_ptr = (uintptr_t)&timeline_fence;
+        timeline_ext.values_ptr = (uintptr_t)&timeline_point;
+
+        execbuf.flags |= I915_EXEC_USE_EXTENSIONS;
+        execbuf.cliprects_ptr = (uintptr_t)&timeline_ext;
+        execbuf.num_cliprects = 0;
+    }
+
     ret = drmIoctl(bufmgr_gem->fd,
                DRM_IOCTL_I915_GEM_EXECBUFFER2_WR,
                &execbuf);
+    if (ret != 0 && errno == EINVAL && timeline_point != 0) {
+        MOS_DBG("Execbuffer rejected the timeline fence, disable timeline\n");
+        bufmgr_gem->has_timeline = false;
+        timeline_point = 0;
+        execbuf.flags = flags;
+        execbuf.cliprects_ptr = (uintptr_t)cliprects;
+        execbuf.num_cliprects = num_cliprects;
+        ret = drmIoctl(bufmgr_gem->fd,
+                   DRM_IOCTL_I915_GEM_EXECBUFFER2_WR,
+                   &execbuf);
+    }
     if (ret != 0) {
+        timeline_point = 0;
         ret = -errno;
         if (ret == -ENOSPC) {
             MOS_DBG("Execbuffer fails to pin. "
@@ -3311,6 +4487,8 @@ do_exec2(struct mos_linux_bo *bo, int used, struct mos_linux_context *ctx,
                 (unsigned int) bufmgr_gem->gtt_size);
         }
     }
+    if (timeline_point != 0)
+        bufmgr_gem->timeline.next_point = timeline_point;
 
     if (ctx != nullptr)
     {
@@ -3330,12 +4508,20 @@ skip_execution:
         struct mos_bo_gem *bo_gem = to_bo_gem(bufmgr_gem->exec_bos[i]);
 
         bo_gem->idle = false;
+        bo_gem->map_synced = false;
+        bo_gem->exec_point = timeline_point;
 
         /* Disconnect the buffer from the validate list */
         bo_gem->validate_index = -1;
         bufmgr_gem->exec_bos[i] = nullptr;
     }
     bufmgr_gem->exec_count = 0;
+
+    for (i = 0; i < bufmgr_gem->exec_bound_count; i++) {
+        to_bo_gem(bufmgr_gem->exec_bound_bos[i])->exec_point = timeline_point;
+        bufmgr_gem->exec_bound_bos[i] = nullptr;
+    }
+    bufmgr_gem->exec_bound_count = 0;
     pthread_mutex_unlock(&bufmgr_gem->lock);
 
     return ret;
@@ -3463,6 +4649,8 @@ do_exec3(struct mos_linux_bo **bo, int _num_bo, struct mos_linux_context *ctx,
             if(bo_gem)
             {
                 bo_gem->idle = false;
+                bo_gem->map_synced = false;
+                bo_gem->exec_point = 0;
 
                 /* Disconnect the buffer from the validate list */
                 bo_gem->validate_index = -1;
@@ -3889,6 +5077,7 @@ mos_bo_gem_export_to_prime(struct mos_linux_bo *bo, int *prime_fd)
         return -errno;
 
     bo_gem->reusable = false;
+    bo_gem->map_hot = false;
 
     return 0;
 }
@@ -3916,6 +5105,7 @@ mos_gem_bo_flink(struct mos_linux_bo *bo, uint32_t * name)
 
         bo_gem->global_name = flink.name;
         bo_gem->reusable = false;
+        bo_gem->map_hot = false;
 
                 if (DRMLISTEMPTY(&bo_gem->name_list))
                         DRMLISTADDTAIL(&bo_gem->name_list, &bufmgr_gem->named);
@@ -4225,6 +5415,12 @@ init_cache_buckets(struct mos_bufmgr_gem *bufmgr_gem)
         add_bucket(bufmgr_gem, size + size * 2 / 4);
         add_bucket(bufmgr_gem, size + size * 3 / 4);
     }
+
+    /* Only the small size classes get per-thread magazines */
+    bufmgr_gem->num_magazine_buckets = 0;
+    while (bufmgr_gem->num_magazine_buckets < bufmgr_gem->num_buckets &&
+           bufmgr_gem->cache_bucket[bufmgr_gem->num_magazine_buckets].size <= MOS_BO_MAGAZINE_MAX_BO_SIZE)
+        bufmgr_gem->num_magazine_buckets++;
 }
 
 /**
@@ -4724,6 +5920,47 @@ mos_bufmgr_gem_get_memory_info(struct mos_bufmgr *bufmgr, char *info, uint32_t l
     return 0;
 }
 
+void
+mos_bufmgr_gem_get_reuse_stats(struct mos_bufmgr *bufmgr, struct mos_bufmgr_reuse_stats *stats)
+{
+    struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *)bufmgr;
+
+    CHK_CONDITION(bufmgr_gem == nullptr || stats == nullptr, "invalid parameter.\n", );
+
+    stats->magazine_hit   = atomic_read(&bufmgr_gem->reuse_hit);
+    stats->magazine_miss  = atomic_read(&bufmgr_gem->reuse_miss);
+    stats->magazine_evict = atomic_read(&bufmgr_gem->reuse_evict);
+}
+
+void
+mos_bufmgr_gem_get_exec_stats(struct mos_bufmgr *bufmgr, struct mos_bufmgr_exec_stats *stats)
+{
+    struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *)bufmgr;
+
+    CHK_CONDITION(bufmgr_gem == nullptr || stats == nullptr, "invalid parameter.\n", );
+
+    pthread_mutex_lock(&bufmgr_gem->lock);
+    stats->exec_objects_reused  = bufmgr_gem->exec_stats.reused;
+    stats->exec_objects_rebuilt = bufmgr_gem->exec_stats.rebuilt;
+    stats->targets_merged       = bufmgr_gem->exec_stats.targets_merged;
+    pthread_mutex_unlock(&bufmgr_gem->lock);
+}
+
+int
+mos_bufmgr_gem_get_vma_stats(struct mos_bufmgr *bufmgr, enum mos_memory_zone memzone, struct _mos_vma_heap_stats *stats)
+{
+    struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *)bufmgr;
+
+    CHK_CONDITION(bufmgr_gem == nullptr || stats == nullptr, "invalid parameter.\n", -EINVAL);
+    CHK_CONDITION(memzone != MEMZONE_SYS && memzone != MEMZONE_DEVICE, "invalid memory zone.\n", -EINVAL);
+
+    pthread_mutex_lock(&bufmgr_gem->lock);
+    mos_vma_heap_get_stats(&bufmgr_gem->vma_heap[memzone], stats);
+    pthread_mutex_unlock(&bufmgr_gem->lock);
+
+    return 0;
+}
+
 void mos_bufmgr_gem_enable_softpin(struct mos_bufmgr *bufmgr, bool va1m_align)
 {
     struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *)bufmgr;
@@ -4731,8 +5968,221 @@ void mos_bufmgr_gem_enable_softpin(struct mos_bufmgr *bufmgr, bool va1m_align)
     bufmgr_gem->softpin_va1Malign     = va1m_align;
 }
 
+/**
+ * Enables binding persistent buffers to the context vm with VM_BIND so that
+ * they no longer need to be revalidated by every execbuffer. Needs softpin
+ * and a prelim kernel reporting VM_BIND support.
+ */
 void mos_bufmgr_gem_enable_vmbind(struct mos_bufmgr *bufmgr)
 {
+    struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *)bufmgr;
+
+    CHK_CONDITION(bufmgr_gem == nullptr, "invalid parameter.\n", );
+
+    if (!bufmgr_gem->use_softpin || !BufmgrPrelim::IsPrelimSupported() ||
+        bufmgr_gem->prelim == nullptr || !bufmgr_gem->prelim->IsVmBindSupported()) {
+        MOS_DBG("vm bind is not supported\n");
+        return;
+    }
+
+    bufmgr_gem->use_vm_bind = true;
+}
+
+/**
+ * Tags a long-lived buffer object such as a reference frame, a state heap or
+ * the HuC firmware. With VM_BIND enabled such buffers are bound to the vm
+ * once and no longer passed in the execbuffer object list. The upstream i915
+ * uapi has no VM_BIND, so this build only records the hint.
+ */
+void
+mos_gem_bo_set_persistent(struct mos_linux_bo *bo)
+{
+    struct mos_bo_gem *bo_gem = (struct mos_bo_gem *)bo;
+
+    CHK_CONDITION(bo_gem == nullptr, "invalid parameter.\n", );
+
+    bo_gem->persistent = true;
+}
+
+/**
+ * Records that a submission using the bo was queued on a submission thread.
+ * Until the matching mos_gem_bo_mark_submitted(), waits, busy queries and
+ * synchronized maps of the bo first wait for the submission to reach the
+ * kernel; before that the kernel would report the bo idle.
+ */
+void
+mos_gem_bo_mark_queued(struct mos_linux_bo *bo)
+{
+    struct mos_bo_gem *bo_gem = (struct mos_bo_gem *)bo;
+
+    CHK_CONDITION(bo_gem == nullptr, "invalid parameter.\n", );
+
+    __atomic_add_fetch(&bo_gem->queued_submits, 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * Records that a submission queued with mos_gem_bo_mark_queued() was handed
+ * to the kernel, or dropped.
+ */
+void
+mos_gem_bo_mark_submitted(struct mos_linux_bo *bo)
+{
+    struct mos_bufmgr_gem *bufmgr_gem;
+    struct mos_bo_gem *bo_gem = (struct mos_bo_gem *)bo;
+
+    CHK_CONDITION(bo_gem == nullptr, "invalid parameter.\n", );
+
+    bufmgr_gem = (struct mos_bufmgr_gem *)bo->bufmgr;
+    if (__atomic_sub_fetch(&bo_gem->queued_submits, 1, __ATOMIC_ACQ_REL) == 0) {
+        pthread_mutex_lock(&bufmgr_gem->queued.mutex);
+        pthread_cond_broadcast(&bufmgr_gem->queued.cond);
+        pthread_mutex_unlock(&bufmgr_gem->queued.mutex);
+    }
+}
+
+/**
+ * Limits the virtual address space kept mapped for buffer objects that are
+ * not currently mapped by anybody, in MB. A negative limit means unlimited.
+ * Buffers tagged with mos_gem_bo_set_map_hot() are not accounted.
+ */
+void
+mos_bufmgr_gem_set_vma_cache_size(struct mos_bufmgr *bufmgr, int limit)
+{
+    struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *)bufmgr;
+
+    CHK_CONDITION(bufmgr_gem == nullptr, "invalid parameter.\n", );
+
+    pthread_mutex_lock(&bufmgr_gem->lock);
+    bufmgr_gem->map_cache_budget = limit < 0 ? 0 : ((uint64_t)limit << 20);
+    pthread_mutex_unlock(&bufmgr_gem->lock);
+}
+
+/**
+ * Tags a buffer object which is mapped by the CPU every frame, e.g. coded
+ * buffers and status reports. Its mappings are kept across unmap and map
+ * skips the wait/set_domain as long as no execbuffer used the buffer since
+ * the last synchronized map.
+ */
+void
+mos_gem_bo_set_map_hot(struct mos_linux_bo *bo, bool hot)
+{
+    struct mos_bo_gem *bo_gem = (struct mos_bo_gem *)bo;
+    struct mos_bufmgr_gem *bufmgr_gem = nullptr;
+
+    CHK_CONDITION(bo_gem == nullptr, "invalid parameter.\n", );
+    bufmgr_gem = (struct mos_bufmgr_gem *)bo->bufmgr;
+
+    /* Shared buffers may be written by somebody we don't track */
+    if (!bo_gem->reusable)
+        return;
+
+    pthread_mutex_lock(&bufmgr_gem->lock);
+    bo_gem->map_hot = hot;
+    bo_gem->map_synced = false;
+    if (hot)
+        mos_gem_bo_map_lru_remove_locked(bufmgr_gem, bo_gem);
+    pthread_mutex_unlock(&bufmgr_gem->lock);
+}
+
+/**
+ * Exports a sync_file that signals once the last submission using the bo
+ * has completed, for callers waiting through poll/epoll instead of
+ * mos_bo_wait(). Blocks only while submissions using the bo are still
+ * queued on a submission thread.
+ *
+ * Bos with a timeline point export that point. Idle bos export an already
+ * signaled fence. Busy bos only known through implicit fencing return
+ * -ENOTSUP and must be waited on with mos_bo_wait().
+ *
+ * Returns 0 and the fd in *fd, which the caller owns, or a negative errno.
+ */
+int
+mos_gem_bo_export_sync_file(struct mos_linux_bo *bo, int *fd)
+{
+    struct mos_bo_gem *bo_gem = (struct mos_bo_gem *)bo;
+    struct mos_bufmgr_gem *bufmgr_gem = nullptr;
+    struct drm_syncobj_create create;
+    struct drm_syncobj_transfer transfer;
+    struct drm_syncobj_handle handle;
+    struct drm_syncobj_destroy destroy;
+    int ret = 0;
+
+    CHK_CONDITION(bo_gem == nullptr || fd == nullptr, "invalid parameter.\n", -EINVAL);
+    bufmgr_gem = (struct mos_bufmgr_gem *)bo->bufmgr;
+    *fd = -1;
+
+    /* The timeline point is only assigned once the kernel got the submission */
+    mos_gem_bo_wait_queued(bufmgr_gem, bo_gem, -1);
+
+    memclear(create);
+    if (mos_gem_bo_has_exec_point(bufmgr_gem, bo_gem)) {
+        if (drmIoctl(bufmgr_gem->fd, DRM_IOCTL_SYNCOBJ_CREATE, &create) != 0)
+            return -errno;
+
+        /* A sync_file holds a single fence, so move the point to a binary syncobj */
+        memclear(transfer);
+        transfer.src_handle = bufmgr_gem->timeline.handle;
+        transfer.src_point = bo_gem->exec_point;
+        transfer.dst_handle = create.handle;
+        transfer.flags = DRM_SYNCOBJ_WAIT_FLAGS_WAIT_FOR_SUBMIT;
+        if (drmIoctl(bufmgr_gem->fd, DRM_IOCTL_SYNCOBJ_TRANSFER, &transfer) != 0)
+            ret = -errno;
+    } else if (!mos_gem_bo_busy(bo)) {
+        create.flags = DRM_SYNCOBJ_CREATE_SIGNALED;
+        if (drmIoctl(bufmgr_gem->fd, DRM_IOCTL_SYNCOBJ_CREATE, &create) != 0)
+            return -errno;
+    } else {
+        return -ENOTSUP;
+    }
+
+    if (ret == 0) {
+        memclear(handle);
+        handle.handle = create.handle;
+        handle.flags = DRM_SYNCOBJ_HANDLE_TO_FD_FLAGS_EXPORT_SYNC_FILE;
+        handle.fd = -1;
+        if (drmIoctl(bufmgr_gem->fd, DRM_IOCTL_SYNCOBJ_HANDLE_TO_FD, &handle) != 0)
+            ret = -errno;
+        else
+            *fd = handle.fd;
+    }
+
+    memclear(destroy);
+    destroy.handle = create.handle;
+    drmIoctl(bufmgr_gem->fd, DRM_IOCTL_SYNCOBJ_DESTROY, &destroy);
+
+    return ret;
+}
+
+/**
+ * Enables freeing of buffer objects on a background thread.
+ *
+ * The munmap, idle wait and GEM_CLOSE of the last unreference are moved off
+ * the calling thread. When the queue is full, frees are synchronous again.
+ */
+void
+mos_bufmgr_gem_enable_async_destroy(struct mos_bufmgr *bufmgr)
+{
+    struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *)bufmgr;
+
+    CHK_CONDITION(bufmgr_gem == nullptr, "invalid parameter.\n", );
+
+    if (bufmgr_gem->reaper.running)
+        return;
+
+    DRMINITLISTHEAD(&bufmgr_gem->reaper.queue);
+    bufmgr_gem->reaper.count = 0;
+    bufmgr_gem->reaper.bytes = 0;
+    bufmgr_gem->reaper.stop = false;
+    pthread_mutex_init(&bufmgr_gem->reaper.mutex, nullptr);
+    pthread_cond_init(&bufmgr_gem->reaper.cond, nullptr);
+
+    if (pthread_create(&bufmgr_gem->reaper.thread, nullptr, mos_gem_bo_reaper_main, bufmgr_gem) != 0) {
+        MOS_DBG("failed to create bo reaper thread: %s\n", strerror(errno));
+        pthread_cond_destroy(&bufmgr_gem->reaper.cond);
+        pthread_mutex_destroy(&bufmgr_gem->reaper.mutex);
+        return;
+    }
+    bufmgr_gem->reaper.running = true;
 }
 
 void mos_bufmgr_gem_disable_object_capture(struct mos_bufmgr *bufmgr)
@@ -4778,6 +6228,16 @@ mos_bufmgr_gem_init(int fd, int batch_size)
         goto exit;
     }
 
+    {
+        pthread_condattr_t attr;
+
+        pthread_mutex_init(&bufmgr_gem->queued.mutex, nullptr);
+        pthread_condattr_init(&attr);
+        pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+        pthread_cond_init(&bufmgr_gem->queued.cond, &attr);
+        pthread_condattr_destroy(&attr);
+    }
+
     bufmgr_gem->mem_profiler_path = getenv("MEDIA_MEMORY_PROFILER_LOG");
     if (bufmgr_gem->mem_profiler_path != nullptr)
     {
@@ -4822,6 +6282,8 @@ mos_bufmgr_gem_init(int fd, int batch_size)
 
     if (bufmgr_gem->pci_device == 0) {
         pthread_mutex_destroy(&bufmgr_gem->lock);
+        pthread_cond_destroy(&bufmgr_gem->queued.cond);
+        pthread_mutex_destroy(&bufmgr_gem->queued.mutex);
         if (bufmgr_gem->mem_profiler_fd != -1)
         {
             close(bufmgr_gem->mem_profiler_fd);
@@ -4898,6 +6360,11 @@ mos_bufmgr_gem_init(int fd, int batch_size)
         bufmgr_gem->object_capture_disabled = true;
     }
 
+    gp.param = I915_PARAM_HAS_EXEC_TIMELINE_FENCES;
+    ret = drmIoctl(bufmgr_gem->fd, DRM_IOCTL_I915_GETPARAM, &gp);
+    if (ret == 0 && *gp.value > 0)
+        mos_gem_timeline_init(bufmgr_gem);
+
     gp.param = I915_PARAM_MMAP_GTT_VERSION;
     ret =  drmIoctl(fd, DRM_IOCTL_I915_GETPARAM, &gp);
     bufmgr_gem->has_mmap_offset  =  (ret == 0) && (*gp.value >= 4);
@@ -4974,6 +6441,11 @@ mos_bufmgr_gem_init(int fd, int batch_size)
     DRMINITLISTHEAD(&bufmgr_gem->named);
     init_cache_buckets(bufmgr_gem);
 
+    DRMINITLISTHEAD(&bufmgr_gem->thread_caches);
+    DRMINITLISTHEAD(&bufmgr_gem->map_lru);
+    bufmgr_gem->has_magazine_key =
+        pthread_key_create(&bufmgr_gem->magazine_key, mos_gem_bo_thread_cache_destroy) == 0;
+
     DRMLISTADD(&bufmgr_gem->managers, &bufmgr_list);
 
     bufmgr_gem->use_softpin = false;
@@ -5363,6 +6835,20 @@ fini:
 int mos_set_context_param_load_balance(struct mos_linux_context *ctx,
                      struct i915_engine_class_instance *ci,
                      unsigned int count)
+{
+    return mos_set_context_param_load_balance_ext(ctx, ci, count, false);
+}
+
+/**
+ * Sets up a load balanced virtual engine over @ci at engine index 0. With
+ * @expose_siblings the physical engines are also placed at indices 1 to
+ * @count, so a submission can target one of them directly while keeping
+ * the timeline of the context.
+ */
+int mos_set_context_param_load_balance_ext(struct mos_linux_context *ctx,
+                     struct i915_engine_class_instance *ci,
+                     unsigned int count,
+                     bool expose_siblings)
 {
     int ret;
     uint32_t size;
@@ -5386,7 +6872,7 @@ int mos_set_context_param_load_balance(struct mos_linux_context *ctx,
     memcpy(balancer->engines, ci, count * sizeof(*ci));
 
     /* I915_DEFINE_CONTEXT_PARAM_ENGINES */
-    size = sizeof(uint64_t) + sizeof(*ci);
+    size = sizeof(uint64_t) + (expose_siblings ? count + 1 : 1) * sizeof(*ci);
     set_engines = (struct i915_context_param_engines*) malloc(size);
     if (nullptr == set_engines)
     {
@@ -5396,6 +6882,8 @@ int mos_set_context_param_load_balance(struct mos_linux_context *ctx,
     set_engines->extensions = (uintptr_t)(balancer);
     set_engines->engines[0].engine_class = I915_ENGINE_CLASS_INVALID;
     set_engines->engines[0].engine_instance = I915_ENGINE_CLASS_INVALID_NONE;
+    if (expose_siblings)
+        memcpy(&set_engines->engines[1], ci, count * sizeof(*ci));
 
     ret = mos_set_context_param(ctx,
                           size,
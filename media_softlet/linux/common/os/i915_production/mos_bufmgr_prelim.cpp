@@ -817,3 +817,55 @@ int BufmgrPrelim::GetMemoryInfo(bool hasLmem, char *info, uint32_t length)
 
     return 0;
 }
+
+bool BufmgrPrelim::IsVmBindSupported()
+{
+    struct drm_i915_getparam gp;
+    int value = 0;
+
+    memclear(gp);
+    gp.param = PRELIM_I915_PARAM_HAS_VM_BIND;
+    gp.value = &value;
+    if (drmIoctl(m_fd, DRM_IOCTL_I915_GETPARAM, &gp) != 0)
+    {
+        return false;
+    }
+
+    return value != 0;
+}
+
+int BufmgrPrelim::VmBind(uint32_t vmId, uint32_t handle, uint64_t start, uint64_t length)
+{
+    struct prelim_drm_i915_gem_vm_bind bind;
+
+    memclear(bind);
+    bind.vm_id  = vmId;
+    bind.handle = handle;
+    bind.start  = start;
+    bind.offset = 0;
+    bind.length = length;
+    // Bound objects stay resident for every execution on the vm
+    bind.flags  = PRELIM_I915_GEM_VM_BIND_IMMEDIATE | PRELIM_I915_GEM_VM_BIND_MAKE_RESIDENT;
+
+    if (drmIoctl(m_fd, PRELIM_DRM_IOCTL_I915_GEM_VM_BIND, &bind) != 0)
+    {
+        return -errno;
+    }
+    return 0;
+}
+
+int BufmgrPrelim::VmUnbind(uint32_t vmId, uint64_t start, uint64_t length)
+{
+    struct prelim_drm_i915_gem_vm_bind unbind;
+
+    memclear(unbind);
+    unbind.vm_id  = vmId;
+    unbind.start  = start;
+    unbind.length = length;
+
+    if (drmIoctl(m_fd, PRELIM_DRM_IOCTL_I915_GEM_VM_UNBIND, &unbind) != 0)
+    {
+        return -errno;
+    }
+    return 0;
+}
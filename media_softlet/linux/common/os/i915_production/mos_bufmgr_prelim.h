@@ -82,6 +82,9 @@ public:
     void WaDisableSingleTimeline(bool hasLmem, uint32_t &flags);
 
     int GetMemoryInfo(bool hasLmem, char *info, uint32_t length);
+    bool IsVmBindSupported();
+    int VmBind(uint32_t vmId, uint32_t handle, uint64_t start, uint64_t length);
+    int VmUnbind(uint32_t vmId, uint64_t start, uint64_t length);
 
 private:
     BufmgrPrelim(int fd);
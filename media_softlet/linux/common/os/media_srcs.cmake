@@ -49,6 +49,7 @@ set(TMP_SOURCES_
     ${CMAKE_CURRENT_LIST_DIR}/mos_vma.c
     ${CMAKE_CURRENT_LIST_DIR}/mos_oca_specific.cpp
     ${CMAKE_CURRENT_LIST_DIR}/mos_auxtable_mgr.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/mos_engine_load_tracker.cpp
     ${CMAKE_CURRENT_LIST_DIR}/mos_interface.cpp
 )
 
@@ -66,7 +67,9 @@ set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/mos_oca_defs_specific.h
     ${CMAKE_CURRENT_LIST_DIR}/mos_oca_interface_specific.h
     ${CMAKE_CURRENT_LIST_DIR}/mos_auxtable_mgr.h
+    ${CMAKE_CURRENT_LIST_DIR}/mos_engine_load_tracker.h
     ${CMAKE_CURRENT_LIST_DIR}/mos_vma.h
+    ${CMAKE_CURRENT_LIST_DIR}/mos_init_trace_specific.h
 )
 
 if(${Media_Scalability_Supported} STREQUAL "yes")
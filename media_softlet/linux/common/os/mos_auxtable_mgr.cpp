@@ -179,10 +179,15 @@ MOS_STATUS  AuxTableMgr::MapResource(GMM_RESOURCE_INFO *gmmResInfo, MOS_LINUX_BO
         return MOS_STATUS_NULL_POINTER;
     }
 
+    // Most allocations of a submission were mapped by an earlier one
+    if (bo->aux_mapped)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
     GMM_RESOURCE_FLAG flags = gmmResInfo->GetResFlags(); 
     if ((flags.Info.MediaCompressed || flags.Info.RenderCompressed) && 
-        (flags.Gpu.MMC && flags.Gpu.CCS)                            &&
-        (bo->aux_mapped == false))
+        (flags.Gpu.MMC && flags.Gpu.CCS))
     {
         int ret = 0;
 
@@ -247,6 +252,7 @@ MOS_STATUS  AuxTableMgr::EmitAuxTableBOList(MOS_LINUX_BO *cmd_bo)
             MOS_OS_ASSERTMESSAGE("Error patching alloc_bo = 0x%x, cmd_bo = 0x%x.",
                 (uintptr_t)boList[i],
                 (uintptr_t)cmd_bo);
+            MOS_FreeMemory(boList);
             return MOS_STATUS_UNKNOWN;
         }
     }
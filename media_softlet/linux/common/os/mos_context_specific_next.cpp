@@ -47,6 +47,7 @@
 #include "mos_gpucontextmgr_next.h"
 #include "mos_cmdbufmgr_next.h"
 #include "mos_oca_rtlog_mgr.h"
+#include "mos_init_trace_specific.h"
 #define BATCH_BUFFER_SIZE 0x80000
 
 OsContextSpecificNext::OsContextSpecificNext()
@@ -106,6 +107,7 @@ MOS_STATUS OsContextSpecificNext::Init(DDI_DEVICE_CONTEXT ddiDriverContext)
         eStatus = NullHwInit((MOS_CONTEXT_HANDLE)osDriverContext);
         if (!GetNullHwIsEnabled())
         {
+            MosInitStepTrace gfxInfoTrace(MOS_INIT_STEP_GFX_INFO);
             eStatus = HWInfo_GetGfxInfo(m_fd, m_bufmgr, &m_platformInfo, &m_skuTable, &m_waTable, &m_gtSystemInfo, userSettingPtr);
         }
         else
@@ -152,6 +154,34 @@ MOS_STATUS OsContextSpecificNext::Init(DDI_DEVICE_CONTEXT ddiDriverContext)
             }
         }
 
+        ReadUserSetting(
+            userSettingPtr,
+            value,
+            __MEDIA_USER_FEATURE_VALUE_ENABLE_ASYNC_BO_DESTROY,
+            MediaUserSetting::Group::Device);
+
+        if (value)
+        {
+            mos_bufmgr_gem_enable_async_destroy(m_bufmgr);
+        }
+
+        ReadUserSetting(
+            userSettingPtr,
+            m_asyncSubmission,
+            __MEDIA_USER_FEATURE_VALUE_ENABLE_ASYNC_SUBMISSION,
+            MediaUserSetting::Group::Device);
+
+        ReadUserSetting(
+            userSettingPtr,
+            value,
+            __MEDIA_USER_FEATURE_VALUE_ENABLE_LOAD_AWARE_ENGINE_SELECTION,
+            MediaUserSetting::Group::Device);
+
+        if (value)
+        {
+            m_engineLoadTracker = MOS_New(EngineLoadTracker);
+        }
+
         uint64_t isRecoverableContextEnabled = 0;
         MOS_LINUX_CONTEXT *intel_context = mos_gem_context_create_ext(m_bufmgr, 0, false);
         int ret = mos_get_context_param(intel_context, 0, I915_CONTEXT_PARAM_RECOVERABLE, &isRecoverableContextEnabled);
@@ -305,6 +335,8 @@ void OsContextSpecificNext::Destroy()
             m_auxTableMgr = nullptr;
         }
 
+        MOS_Delete(m_engineLoadTracker);
+
         m_skuTable.reset();
         m_waTable.reset();
 
@@ -29,6 +29,7 @@
 
 #include "mos_context_next.h"
 #include "mos_auxtable_mgr.h"
+#include "mos_engine_load_tracker.h"
 
 class GraphicsResourceSpecificNext;
 class CmdBufMgrNext;
@@ -95,6 +96,16 @@ public:
     bool UseSwSwizzling() { return m_useSwSwizzling; }
     bool GetTileYFlag() { return m_tileYFlag; }
 
+    //!
+    //! \brief  Return whether GPU contexts submit from a worker thread
+    //!
+    bool IsAsyncSubmissionEnabled() { return m_asyncSubmission; }
+
+    //!
+    //! \brief  Return the engine load tracker, nullptr if load aware selection is off
+    //!
+    EngineLoadTracker *GetEngineLoadTracker() { return m_engineLoadTracker; }
+
     MOS_BUFMGR *GetBufMgr()
     {
         return m_bufmgr;
@@ -126,6 +137,11 @@ private:
     //!
     bool                m_tileYFlag     = true;
 
+    //!
+    //! \brief  execbuffer calls issued by a per GPU context worker thread
+    //!
+    bool                m_asyncSubmission = false;
+
     //!
     //! \brief  ptr to DRM bufmgr
     //!
@@ -137,6 +153,11 @@ private:
     int32_t             m_fd            = -1;
 
     AuxTableMgr         *m_auxTableMgr = nullptr;
+
+    //!
+    //! \brief  Engine occupancy shared by the GPU contexts of the device
+    //!
+    EngineLoadTracker   *m_engineLoadTracker = nullptr;
     PERF_DATA           *m_perfData =   nullptr;
 MEDIA_CLASS_DEFINE_END(OsContextSpecificNext)
 };
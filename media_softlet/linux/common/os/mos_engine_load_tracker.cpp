@@ -0,0 +1,224 @@
+/*
+* Copyright (c) 2024, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file    mos_engine_load_tracker.cpp
+//! \brief   Per device engine occupancy used to place single pipe submissions
+//!
+
+#include <dirent.h>
+#include <stdio.h>
+#include <string.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "mos_engine_load_tracker.h"
+#include "mos_utilities.h"
+
+//!
+//! \brief    Read the first integer of a sysfs file
+//! \return   bool
+//!           true if a value was read
+//!
+static bool ReadSysfsInt(const char *path, int32_t &value)
+{
+    FILE *file = fopen(path, "r");
+    if (file == nullptr)
+    {
+        return false;
+    }
+    bool ok = fscanf(file, "%d", &value) == 1;
+    fclose(file);
+    return ok;
+}
+
+EngineLoadTracker::EngineLoadTracker()
+{
+    m_mutex = MosUtilities::MosCreateMutex();
+}
+
+EngineLoadTracker::~EngineLoadTracker()
+{
+    for (uint32_t i = 0; i < m_engineCount; i++)
+    {
+        if (m_engines[i].pmuFd >= 0)
+        {
+            close(m_engines[i].pmuFd);
+        }
+    }
+    MosUtilities::MosDestroyMutex(m_mutex);
+    m_mutex = nullptr;
+}
+
+EngineLoadTracker::EngineLoad *EngineLoadTracker::GetEngineLoad(const struct i915_engine_class_instance &engine)
+{
+    for (uint32_t i = 0; i < m_engineCount; i++)
+    {
+        if (m_engines[i].engine.engine_class == engine.engine_class &&
+            m_engines[i].engine.engine_instance == engine.engine_instance)
+        {
+            return &m_engines[i];
+        }
+    }
+
+    if (m_engineCount == m_maxEngines)
+    {
+        return nullptr;
+    }
+
+    EngineLoad &load = m_engines[m_engineCount++];
+    load.engine      = engine;
+    load.pmuFd       = OpenBusyCounter(engine);
+    return &load;
+}
+
+int EngineLoadTracker::OpenBusyCounter(const struct i915_engine_class_instance &engine)
+{
+    if (m_pmuType == -1)
+    {
+        // integrated parts register "i915", discrete ones "i915_<pci address>"
+        char    path[256];
+        int32_t type = -1;
+        m_pmuType    = -2;
+
+        DIR *dir = opendir("/sys/bus/event_source/devices");
+        if (dir == nullptr)
+        {
+            return -1;
+        }
+        struct dirent *entry = nullptr;
+        while ((entry = readdir(dir)) != nullptr)
+        {
+            if (strncmp(entry->d_name, "i915", 4) != 0)
+            {
+                continue;
+            }
+            snprintf(path, sizeof(path), "/sys/bus/event_source/devices/%s/type", entry->d_name);
+            if (ReadSysfsInt(path, type))
+            {
+                m_pmuType = type;
+                snprintf(path, sizeof(path), "/sys/bus/event_source/devices/%s/cpumask", entry->d_name);
+                ReadSysfsInt(path, m_pmuCpu);
+                break;
+            }
+        }
+        closedir(dir);
+    }
+
+    if (m_pmuType < 0)
+    {
+        return -1;
+    }
+
+    struct perf_event_attr attr;
+    MosUtilities::MosZeroMemory(&attr, sizeof(attr));
+    attr.type        = m_pmuType;
+    attr.size        = sizeof(attr);
+    attr.config      = I915_PMU_ENGINE_BUSY(engine.engine_class, engine.engine_instance);
+    attr.read_format = 0;
+
+    int fd = (int)syscall(__NR_perf_event_open, &attr, -1, m_pmuCpu, -1, 0);
+    if (fd < 0)
+    {
+        // usually perf_event_paranoid, the in flight count is used alone
+        MOS_OS_NORMALMESSAGE("i915 PMU busy counter is not available, errno %d.", errno);
+        return -1;
+    }
+
+    return fd;
+}
+
+void EngineLoadTracker::SampleBusy(EngineLoad &load, uint64_t now)
+{
+    if (load.pmuFd < 0 || now - load.lastSampleUs < m_sampleIntervalUs)
+    {
+        return;
+    }
+
+    uint64_t busyNs = 0;
+    if (read(load.pmuFd, &busyNs, sizeof(busyNs)) != sizeof(busyNs))
+    {
+        return;
+    }
+
+    if (load.lastSampleUs != 0 && busyNs >= load.lastBusyNs)
+    {
+        uint64_t elapsedNs = (now - load.lastSampleUs) * 1000;
+        load.busyPermille  = (uint32_t)MOS_MIN((busyNs - load.lastBusyNs) * 1000 / elapsedNs, 1000);
+    }
+    load.lastBusyNs   = busyNs;
+    load.lastSampleUs = now;
+}
+
+void EngineLoadTracker::OnSubmit(const struct i915_engine_class_instance &engine)
+{
+    MosUtilities::MosLockMutex(m_mutex);
+    EngineLoad *load = GetEngineLoad(engine);
+    if (load)
+    {
+        load->inflight++;
+    }
+    MosUtilities::MosUnlockMutex(m_mutex);
+}
+
+void EngineLoadTracker::OnRetire(const struct i915_engine_class_instance &engine)
+{
+    MosUtilities::MosLockMutex(m_mutex);
+    EngineLoad *load = GetEngineLoad(engine);
+    if (load && load->inflight > 0)
+    {
+        load->inflight--;
+    }
+    MosUtilities::MosUnlockMutex(m_mutex);
+}
+
+uint32_t EngineLoadTracker::SelectEngine(const struct i915_engine_class_instance *engines, uint32_t count)
+{
+    if (engines == nullptr || count <= 1)
+    {
+        return 0;
+    }
+
+    uint64_t now       = (uint64_t)MosUtilities::MosGetCurTime();
+    uint32_t selected  = 0;
+    uint64_t bestScore = UINT64_MAX;
+
+    MosUtilities::MosLockMutex(m_mutex);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        EngineLoad *load = GetEngineLoad(engines[i]);
+        if (load == nullptr)
+        {
+            continue;
+        }
+        SampleBusy(*load, now);
+
+        uint64_t score = load->busyPermille + (uint64_t)load->inflight * m_inflightWeight;
+        if (score < bestScore)
+        {
+            bestScore = score;
+            selected  = i;
+        }
+    }
+    MosUtilities::MosUnlockMutex(m_mutex);
+
+    return selected;
+}
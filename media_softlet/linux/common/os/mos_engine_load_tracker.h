@@ -0,0 +1,127 @@
+/*
+* Copyright (c) 2024, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file    mos_engine_load_tracker.h
+//! \brief   Per device engine occupancy used to place single pipe submissions
+//!
+
+#ifndef MOS_ENGINE_LOAD_TRACKER_H
+#define MOS_ENGINE_LOAD_TRACKER_H
+
+#include "i915_drm.h"
+#include "mos_os.h"
+
+//!
+//! \class  EngineLoadTracker
+//! \brief  Engine Load Tracker
+//! \details Combines the submissions each GPU context has in flight on an
+//!          engine, retired through GPU status tags, with the busy time the
+//!          i915 PMU reports for it, which also covers other processes.
+//!          PMU counters are optional, without them only the in flight
+//!          submissions of this device are considered.
+//!
+class EngineLoadTracker
+{
+public:
+    //!
+    //! \brief  Constructor
+    //!
+    EngineLoadTracker();
+
+    //!
+    //! \brief  Destructor
+    //!
+    virtual ~EngineLoadTracker();
+
+    //!
+    //! \brief    Account a submission placed on the engine
+    //! \param    [in] engine
+    //!           Engine class and instance
+    //! \return   void
+    //!
+    void OnSubmit(const struct i915_engine_class_instance &engine);
+
+    //!
+    //! \brief    Account the completion of a submission placed on the engine
+    //! \param    [in] engine
+    //!           Engine class and instance
+    //! \return   void
+    //!
+    void OnRetire(const struct i915_engine_class_instance &engine);
+
+    //!
+    //! \brief    Select the least busy engine
+    //! \param    [in] engines
+    //!           Candidate engines
+    //! \param    [in] count
+    //!           Number of candidate engines
+    //! \return   uint32_t
+    //!           Index of the selected engine in engines
+    //!
+    uint32_t SelectEngine(const struct i915_engine_class_instance *engines, uint32_t count);
+
+private:
+    struct EngineLoad
+    {
+        struct i915_engine_class_instance engine = {};
+        int32_t  inflight       = 0;    //!< submissions of this device not yet retired
+        int      pmuFd          = -1;   //!< I915_PMU_ENGINE_BUSY counter, -1 if unavailable
+        uint64_t lastBusyNs     = 0;
+        uint64_t lastSampleUs   = 0;
+        uint32_t busyPermille   = 0;    //!< busy ratio over the last sample interval
+    };
+
+    //!
+    //! \brief    Find or add the load entry of the engine, m_mutex held
+    //! \return   EngineLoad *
+    //!           nullptr if the table is full
+    //!
+    EngineLoad *GetEngineLoad(const struct i915_engine_class_instance &engine);
+
+    //!
+    //! \brief    Refresh the PMU busy ratio of the engine, m_mutex held
+    //! \return   void
+    //!
+    void SampleBusy(EngineLoad &load, uint64_t now);
+
+    //!
+    //! \brief    Open the i915 PMU busy counter of the engine
+    //! \return   int
+    //!           File descriptor, -1 if the PMU can not be used
+    //!
+    int OpenBusyCounter(const struct i915_engine_class_instance &engine);
+
+    static constexpr uint32_t m_maxEngines       = 16;
+    //! \brief    PMU counters are read at most once per interval
+    static constexpr uint64_t m_sampleIntervalUs = 5000;
+    //! \brief    Weight of one in flight submission against the busy ratio
+    static constexpr uint32_t m_inflightWeight   = 250;
+
+    EngineLoad  m_engines[m_maxEngines];
+    uint32_t    m_engineCount = 0;
+    int32_t     m_pmuType     = -1;     //!< perf event type of the i915 PMU, -1 unknown, -2 unavailable
+    int32_t     m_pmuCpu      = 0;
+    PMOS_MUTEX  m_mutex       = nullptr;
+MEDIA_CLASS_DEFINE_END(EngineLoadTracker)
+};
+
+#endif //MOS_ENGINE_LOAD_TRACKER_H
@@ -36,6 +36,9 @@
 #include "mos_os_cp_interface_specific.h"
 
 #define MI_BATCHBUFFER_END 0x05000000
+#define MI_BATCHBUFFER_START_PPGTT 0x18800101
+#define MI_NOOP 0x00000000
+#define MI_BATCHBUFFER_CHAIN_DW 3
 static pthread_mutex_t command_dump_mutex = PTHREAD_MUTEX_INITIALIZER;
 
 void GpuContextSpecificNext::StoreCreateOptions(PMOS_GPUCTX_CREATOPTIONS createoption)
@@ -203,12 +206,31 @@ MOS_STATUS GpuContextSpecificNext::Init(OsContextNext *osContext,
         m_commandBufferSize = COMMAND_BUFFER_SIZE;
     }
 
+    // start from what earlier workloads on the same node needed, so the
+    // first frames do not have to grow their command buffers
+    if (m_cmdBufMgr != nullptr)
+    {
+        m_cmdBufHighWaterMark = MOS_MAX(m_commandBufferSize, m_cmdBufMgr->GetHighWaterMark(m_nodeOrdinal));
+        if (m_cmdBufMgr->PrewarmCmdBufs(m_cmdBufHighWaterMark, m_cmdBufPrewarmNum) != MOS_STATUS_SUCCESS)
+        {
+            MOS_OS_NORMALMESSAGE("Failed to prewarm command buffers.");
+        }
+    }
+
     m_nextFetchIndex = 0;
 
     m_cmdBufFlushed = true;
 
     m_osContext = osContext;
 
+    m_engineLoadTracker = static_cast<OsContextSpecificNext *>(osContext)->GetEngineLoadTracker();
+
+    if (static_cast<OsContextSpecificNext *>(osContext)->IsAsyncSubmissionEnabled() &&
+        StartSubmissionThread() != MOS_STATUS_SUCCESS)
+    {
+        MOS_OS_NORMALMESSAGE("Failed to start submission thread, submit synchronously.");
+    }
+
     MOS_OS_CHK_STATUS_RETURN(AllocateGPUStatusBuf());
 
     m_commandBuffer = (PMOS_COMMAND_BUFFER)MOS_AllocAndZeroMemory(sizeof(MOS_COMMAND_BUFFER));
@@ -358,90 +380,112 @@ MOS_STATUS GpuContextSpecificNext::Init(OsContextNext *osContext,
 #if (_DEBUG || _RELEASE_INTERNAL)
             isEngineSelectEnable = SelectEngineInstanceByUser(engine_map, &nengine, m_engineInstanceSelect, gpuNode);
 #endif
-            if (mos_set_context_param_load_balance(m_i915Context[0], engine_map, nengine))
+            // with load aware selection single pipe submissions may also
+            // target a sibling directly, see SelectSiblingEngine()
+            bool exposeSiblings = m_engineLoadTracker != nullptr && nengine >= 2 && nengine <= MAX_ENGINE_INSTANCE_NUM;
+            if (mos_set_context_param_load_balance_ext(m_i915Context[0], engine_map, nengine, exposeSiblings))
             {
                 MOS_OS_ASSERTMESSAGE("Failed to set balancer extension.\n");
                 MOS_SafeFreeMemory(engine_map);
                 return MOS_STATUS_UNKNOWN;
             }
+            if (exposeSiblings)
+            {
+                MosUtilities::MosSecureMemcpy(m_engineSiblings, sizeof(m_engineSiblings), engine_map, nengine * sizeof(*engine_map));
+                m_engineSiblingCount = nengine;
+            }
 
             if (nengine >= 2)
             {
                 int i;
-                //master queue
-                m_i915Context[1] = mos_gem_context_create_shared(osParameters->bufmgr,
-                                                                    osParameters->intel_context,
-                                                                    I915_CONTEXT_CREATE_FLAGS_SINGLE_TIMELINE,
-                                                                    m_bProtectedContext);
-                if (m_i915Context[1] == nullptr)
+                // Parallel submission is preferred for multi-pipe whenever the kernel
+                // supports it (one execbuf for all pipes), probe it before bonding.
+                for (i = 1; i < nengine; i++)
                 {
-                    MOS_OS_ASSERTMESSAGE("Failed to create master context.\n");
-                    MOS_SafeFreeMemory(engine_map);
-                    return MOS_STATUS_UNKNOWN;
+                    unsigned int ctxWidth = i + 1;
+                    m_i915Context[i] = mos_gem_context_create_shared(osParameters->bufmgr,
+                                                                 osParameters->intel_context,
+                                                                 0, // I915_CONTEXT_CREATE_FLAGS_SINGLE_TIMELINE not allowed for parallel submission
+                                                                 m_bProtectedContext);
+                    if (m_i915Context[i] == nullptr)
+                    {
+                        MOS_OS_NORMALMESSAGE("Failed to create parallel context with width %d.\n", ctxWidth);
+                        break;
+                    }
+                    m_i915Context[i]->pOsContext = osParameters;
+
+                    if (mos_set_context_param_parallel(m_i915Context[i], engine_map, ctxWidth) != S_SUCCESS)
+                    {
+                        MOS_OS_NORMALMESSAGE("Failed to set parallel extension with width %d. errno=%d\n", ctxWidth, errno);
+                        mos_gem_context_destroy(m_i915Context[i]);
+                        m_i915Context[i] = nullptr;
+                        break;
+                    }
                 }
-                m_i915Context[1]->pOsContext = osParameters;
 
-                if (mos_set_context_param_load_balance(m_i915Context[1], engine_map, 1))
+                if (i > 1)
                 {
-                    MOS_OS_ASSERTMESSAGE("Failed to set master context bond extension.\n");
-                    MOS_SafeFreeMemory(engine_map);
-                    return MOS_STATUS_UNKNOWN;
+                    streamState->bGucSubmission = true;
                 }
-
-                //slave queue
-                for (i=1; i<nengine; i++)
+                else
                 {
-                    m_i915Context[i+1] = mos_gem_context_create_shared(osParameters->bufmgr,
+                    streamState->bGucSubmission = false;
+
+                    //master queue
+                    m_i915Context[1] = mos_gem_context_create_shared(osParameters->bufmgr,
                                                                         osParameters->intel_context,
                                                                         I915_CONTEXT_CREATE_FLAGS_SINGLE_TIMELINE,
                                                                         m_bProtectedContext);
-                    if (m_i915Context[i+1] == nullptr)
+                    if (m_i915Context[1] == nullptr)
                     {
-                        MOS_OS_ASSERTMESSAGE("Failed to create slave context.\n");
+                        MOS_OS_ASSERTMESSAGE("Failed to create master context.\n");
                         MOS_SafeFreeMemory(engine_map);
                         return MOS_STATUS_UNKNOWN;
                     }
-                    m_i915Context[i+1]->pOsContext = osParameters;
+                    m_i915Context[1]->pOsContext = osParameters;
 
-                    if (mos_set_context_param_bond(m_i915Context[i+1], engine_map[0], &engine_map[i], 1) != S_SUCCESS)
+                    if (mos_set_context_param_load_balance(m_i915Context[1], engine_map, 1))
                     {
-                        int err = errno;
-                        if (err == ENODEV)
-                        {
-                            mos_gem_context_destroy(m_i915Context[1]);
-                            mos_gem_context_destroy(m_i915Context[i+1]);
-                            m_i915Context[i+1] = nullptr;
-                            break;
-                        }
-                        else
+                        MOS_OS_ASSERTMESSAGE("Failed to set master context bond extension.\n");
+                        MOS_SafeFreeMemory(engine_map);
+                        return MOS_STATUS_UNKNOWN;
+                    }
+
+                    //slave queue
+                    for (i=1; i<nengine; i++)
+                    {
+                        m_i915Context[i+1] = mos_gem_context_create_shared(osParameters->bufmgr,
+                                                                            osParameters->intel_context,
+                                                                            I915_CONTEXT_CREATE_FLAGS_SINGLE_TIMELINE,
+                                                                            m_bProtectedContext);
+                        if (m_i915Context[i+1] == nullptr)
                         {
-                            MOS_OS_ASSERTMESSAGE("Failed to set slave context bond extension. errno=%d\n",err);
+                            MOS_OS_ASSERTMESSAGE("Failed to create slave context.\n");
                             MOS_SafeFreeMemory(engine_map);
                             return MOS_STATUS_UNKNOWN;
                         }
-                    }
-                }
-                if (i == nengine)
-                {
-                    streamState->bGucSubmission = false;
-                }
-                else
-                {
-                    streamState->bGucSubmission = true;
-                    //create context with different width
-                    for(i = 1; i < nengine; i++)
-                    {
-                        unsigned int ctxWidth = i + 1;
-                        m_i915Context[i] = mos_gem_context_create_shared(osParameters->bufmgr,
-                                                                     osParameters->intel_context,
-                                                                     0, // I915_CONTEXT_CREATE_FLAGS_SINGLE_TIMELINE not allowed for parallel submission
-                                                                     m_bProtectedContext);
-                        if (mos_set_context_param_parallel(m_i915Context[i], engine_map, ctxWidth) != S_SUCCESS)
+                        m_i915Context[i+1]->pOsContext = osParameters;
+
+                        if (mos_set_context_param_bond(m_i915Context[i+1], engine_map[0], &engine_map[i], 1) != S_SUCCESS)
                         {
-                            MOS_OS_ASSERTMESSAGE("Failed to set parallel extension since discontinuous logical engine.\n");
-                            mos_gem_context_destroy(m_i915Context[i]);
-                            m_i915Context[i] = nullptr;
-                            break;
+                            int err = errno;
+                            if (err == ENODEV)
+                            {
+                                // Neither parallel nor bonded submission, multi-pipe is not available
+                                MOS_OS_NORMALMESSAGE("Bond extension not supported, multi-pipe submission disabled.\n");
+                                for (int j = 1; j <= i + 1; j++)
+                                {
+                                    mos_gem_context_destroy(m_i915Context[j]);
+                                    m_i915Context[j] = nullptr;
+                                }
+                                break;
+                            }
+                            else
+                            {
+                                MOS_OS_ASSERTMESSAGE("Failed to set slave context bond extension. errno=%d\n",err);
+                                MOS_SafeFreeMemory(engine_map);
+                                return MOS_STATUS_UNKNOWN;
+                            }
                         }
                     }
                 }
@@ -491,6 +535,15 @@ void GpuContextSpecificNext::Clear()
 
     MOS_TraceEventExt(EVENT_GPU_CONTEXT_DESTROY, EVENT_TYPE_START,
                       m_i915Context, sizeof(void *), nullptr, 0);
+
+    m_submissionBatching = false;
+    if (FlushSubmissionBatch() != MOS_STATUS_SUCCESS)
+    {
+        MOS_OS_ASSERTMESSAGE("failed to submit the pending submission batch");
+    }
+    StopSubmissionThread();
+    RetireEngineSubmissions(true);
+
     // hanlde the status buf bundled w/ the specified gpucontext
     if (m_statusBufferResource && m_statusBufferResource->pGfxResourceNext)
     {
@@ -656,7 +709,7 @@ MOS_STATUS GpuContextSpecificNext::GetCommandBuffer(
         MosUtilities::MosLockMutex(m_cmdBufPoolMutex);
         if (m_cmdBufPool.size() < MAX_CMD_BUF_NUM)
         {
-            cmdBuf = m_cmdBufMgr->PickupOneCmdBuf(m_commandBufferSize);
+            cmdBuf = m_cmdBufMgr->PickupOneCmdBuf(m_commandBufferSize, m_cmdBufHighWaterMark);
             if (cmdBuf == nullptr)
             {
                 MOS_OS_ASSERTMESSAGE("Invalid (nullptr) Pointer.");
@@ -686,7 +739,7 @@ MOS_STATUS GpuContextSpecificNext::GetCommandBuffer(
             m_cmdBufMgr->ReleaseCmdBuf(cmdBufOld);  // here just return old command buffer to available pool
 
             //pick up new comamnd buffer
-            cmdBuf = m_cmdBufMgr->PickupOneCmdBuf(m_commandBufferSize);
+            cmdBuf = m_cmdBufMgr->PickupOneCmdBuf(m_commandBufferSize, m_cmdBufHighWaterMark);
             if (cmdBuf == nullptr)
             {
                 MOS_OS_ASSERTMESSAGE("Invalid (nullptr) Pointer.");
@@ -908,6 +961,7 @@ MOS_STATUS GpuContextSpecificNext::ResizeCommandBufferAndPatchList(
     {
         m_commandBufferSize = MOS_ALIGN_CEIL(requestedCommandBufferSize, 8);
     }
+    UpdateCmdBufHighWaterMark();
 
     if (requestedPatchListSize > m_maxPatchLocationsize)
     {
@@ -929,10 +983,25 @@ MOS_STATUS GpuContextSpecificNext::ResizeCommandBuffer(uint32_t requestedSize)
     MOS_OS_FUNCTION_ENTER;
 
     m_commandBufferSize = requestedSize;
+    UpdateCmdBufHighWaterMark();
 
     return MOS_STATUS_SUCCESS;
 }
 
+void GpuContextSpecificNext::UpdateCmdBufHighWaterMark()
+{
+    if (m_commandBufferSize <= m_cmdBufHighWaterMark)
+    {
+        return;
+    }
+
+    m_cmdBufHighWaterMark = m_commandBufferSize;
+    if (m_cmdBufMgr != nullptr)
+    {
+        m_cmdBufMgr->UpdateHighWaterMark(m_nodeOrdinal, m_cmdBufHighWaterMark);
+    }
+}
+
 MOS_VDBOX_NODE_IND GpuContextSpecificNext::GetVdboxNodeId(
     PMOS_COMMAND_BUFFER cmdBuffer)
 {
@@ -950,6 +1019,16 @@ MOS_VDBOX_NODE_IND GpuContextSpecificNext::GetVdboxNodeId(
         return idx;
     }
 
+    if (m_engineLoadTracker)
+    {
+        static const struct i915_engine_class_instance vdboxes[] = {
+            {I915_ENGINE_CLASS_VIDEO, 0},
+            {I915_ENGINE_CLASS_VIDEO, 1}};
+
+        RetireEngineSubmissions(false);
+        idx = m_engineLoadTracker->SelectEngine(vdboxes, 2) ? MOS_VDBOX_NODE_2 : MOS_VDBOX_NODE_1;
+    }
+
     return idx;
 }
 
@@ -1040,6 +1119,7 @@ MOS_STATUS GpuContextSpecificNext::MapResourcesToAuxTable(mos_linux_bo *cmd_bo)
     if (auxTableMgr)
     {
         // Map compress allocations to aux table if it is not mapped.
+        // Secondary command buffers share the allocation list, walk it once.
         for (uint32_t i = 0; i < m_numAllocations; i++)
         {
             auto res = (PMOS_RESOURCE)m_allocationList[i].hAllocation;
@@ -1047,6 +1127,10 @@ MOS_STATUS GpuContextSpecificNext::MapResourcesToAuxTable(mos_linux_bo *cmd_bo)
             MOS_OS_CHK_STATUS_RETURN(auxTableMgr->MapResource(res->pGmmResInfo, res->bo));
         }
         MOS_OS_CHK_STATUS_RETURN(auxTableMgr->EmitAuxTableBOList(cmd_bo));
+        for (auto &it : m_secondaryCmdBufs)
+        {
+            MOS_OS_CHK_STATUS_RETURN(auxTableMgr->EmitAuxTableBOList(it.second->OsResource.bo));
+        }
     }
     return MOS_STATUS_SUCCESS;
 }
@@ -1079,10 +1163,6 @@ MOS_STATUS GpuContextSpecificNext::SubmitCommandBuffer(
 
     // Map Resource to Aux if needed
     MapResourcesToAuxTable(cmd_bo);
-    for(auto it : m_secondaryCmdBufs)
-    {
-        MapResourcesToAuxTable(it.second->OsResource.bo);
-    }
 
     if (m_secondaryCmdBufs.size() >= 2)
     {
@@ -1090,6 +1170,17 @@ MOS_STATUS GpuContextSpecificNext::SubmitCommandBuffer(
         cmdBuffer->iSubmissionType = SUBMISSION_TYPE_MULTI_PIPE_MASTER;
     }
 
+    bool      batchable = IsBatchableSubmission(streamState, cmdBuffer, scalaEnabled, nullRendering);
+    uint32_t *chainSlot = nullptr;
+    // multi pipe and null rendering submissions are always issued from this thread
+    bool      asyncSubmit = m_submitThread != 0 && !nullRendering &&
+                            !(cmdBuffer->iSubmissionType & SUBMISSION_TYPE_MULTI_PIPE_MASK);
+    bool      submitQueued = false;
+    // engine index for submissions on m_i915Context[0], 0 is the virtual engine
+    uint32_t  ctxExecFlag  = m_i915ExecFlag;
+    bool      enginePlaced = false;
+    struct i915_engine_class_instance placedEngine = {};
+
     std::vector<PMOS_RESOURCE> mappedResList;
     std::vector<MOS_LINUX_BO *> skipSyncBoList;
 
@@ -1259,6 +1350,21 @@ MOS_STATUS GpuContextSpecificNext::SubmitCommandBuffer(
              it++;
          }
     }
+    else if (batchable)
+    {
+        // BB_END padded to MI_BATCH_BUFFER_START size, patched when the next
+        // command buffer is chained
+        uint32_t chainCmd[MI_BATCHBUFFER_CHAIN_DW] = {MI_BATCHBUFFER_END, MI_NOOP, MI_NOOP};
+        chainSlot = cmdBuffer->pCmdPtr;
+        if (MOS_FAILED(Mos_AddCommand(
+                cmdBuffer,
+                chainCmd,
+                sizeof(chainCmd))))
+        {
+            MOS_OS_ASSERTMESSAGE("Inserting BB_END failed!");
+            return MOS_STATUS_UNKNOWN;
+        }
+    }
     else
     {
         //Add Batch buffer End Command
@@ -1274,9 +1380,13 @@ MOS_STATUS GpuContextSpecificNext::SubmitCommandBuffer(
     }
 
     // Now, we can unmap the video command buffer, since we don't need CPU access anymore.
+    // A batched command buffer stays mapped until its chain slot is patched.
     MOS_OS_CHK_NULL_RETURN(cmdBuffer->OsResource.pGfxResourceNext);
 
-    cmdBuffer->OsResource.pGfxResourceNext->Unlock(m_osContext);
+    if (!batchable)
+    {
+        cmdBuffer->OsResource.pGfxResourceNext->Unlock(m_osContext);
+    }
 
     it = m_secondaryCmdBufs.begin();
     while(it != m_secondaryCmdBufs.end())
@@ -1310,6 +1420,12 @@ MOS_STATUS GpuContextSpecificNext::SubmitCommandBuffer(
             if (perStreamParameters->bPerCmdBufferBalancing)
             {
                 execFlag = GetVcsExecFlag(cmdBuffer, gpuNode);
+                if (m_engineLoadTracker && !streamState->ctxBasedScheduling)
+                {
+                    placedEngine.engine_class    = I915_ENGINE_CLASS_VIDEO;
+                    placedEngine.engine_instance = (cmdBuffer->iVdboxNodeIndex == MOS_VDBOX_NODE_2) ? 1 : 0;
+                    enginePlaced                 = true;
+                }
             }
             else if (gpuNode == MOS_GPU_NODE_VIDEO)
             {
@@ -1334,6 +1450,31 @@ MOS_STATUS GpuContextSpecificNext::SubmitCommandBuffer(
         }
     }
 
+    if (!batchable)
+    {
+        // Keep submission order, command buffers chained or queued so far go first
+        if (FlushSubmissionBatch() != MOS_STATUS_SUCCESS)
+        {
+            eStatus = MOS_STATUS_UNKNOWN;
+        }
+        if (!asyncSubmit)
+        {
+            DrainSubmissionQueue();
+        }
+    }
+
+    if (m_engineSiblingCount >= 2 && streamState->ctxBasedScheduling && m_i915Context[0] != nullptr &&
+        !(cmdBuffer->iSubmissionType & SUBMISSION_TYPE_MULTI_PIPE_MASK) && !nullRendering)
+    {
+        // a buffer chained to a pending batch runs where the batch runs
+        uint32_t sibling = (batchable && m_submissionBatch.headBo != nullptr && m_submissionBatch.execFlag > 0)
+                               ? m_submissionBatch.execFlag - 1
+                               : SelectSiblingEngine();
+        ctxExecFlag  = sibling + 1;
+        placedEngine = m_engineSiblings[sibling];
+        enginePlaced = true;
+    }
+
 #if (_DEBUG || _RELEASE_INTERNAL)
  
     MOS_LINUX_BO *nop_cmd_bo = nullptr; 
@@ -1368,7 +1509,30 @@ MOS_STATUS GpuContextSpecificNext::SubmitCommandBuffer(
     else if (nullRendering == false)
     {
         UnlockPendingOcaBuffers(cmdBuffer, perStreamParameters);
-        if (streamState->ctxBasedScheduling && m_i915Context[0] != nullptr)
+        if (batchable)
+        {
+            bool ctxBased = streamState->ctxBasedScheduling && m_i915Context[0] != nullptr;
+            ret = MOS_FAILED(AddToSubmissionBatch(
+                      cmdBuffer,
+                      chainSlot,
+                      ctxBased ? m_i915Context[0] : perStreamParameters->intel_context,
+                      ctxBased ? ctxExecFlag : execFlag,
+                      DR4)) ? -1 : 0;
+        }
+        else if (asyncSubmit)
+        {
+            bool          ctxBased = streamState->ctxBasedScheduling && m_i915Context[0] != nullptr;
+            SubmissionJob job;
+            job.cmdBo       = cmd_bo;
+            job.size        = m_commandBufferSize;
+            job.i915Context = ctxBased ? m_i915Context[0] : perStreamParameters->intel_context;
+            job.execFlag    = ctxBased ? ctxExecFlag : execFlag;
+            job.dr4         = DR4;
+            CollectSubmissionBos(job, cmd_bo);
+            ret          = QueueSubmission(job);
+            submitQueued = true;
+        }
+        else if (streamState->ctxBasedScheduling && m_i915Context[0] != nullptr)
         {
             if (cmdBuffer->iSubmissionType & SUBMISSION_TYPE_MULTI_PIPE_MASK)
             {
@@ -1421,7 +1585,7 @@ MOS_STATUS GpuContextSpecificNext::SubmitCommandBuffer(
                     cliprects,
                     num_cliprects,
                     DR4,
-                    m_i915ExecFlag,
+                    ctxExecFlag,
                     nullptr);
             }
         }
@@ -1440,6 +1604,10 @@ MOS_STATUS GpuContextSpecificNext::SubmitCommandBuffer(
         {
             eStatus = MOS_STATUS_UNKNOWN;
         }
+        else if (enginePlaced)
+        {
+            TrackEngineSubmission(placedEngine);
+        }
     }
 
     if (eStatus != MOS_STATUS_SUCCESS)
@@ -1487,10 +1655,30 @@ if (streamState->dumpCommandBuffer)
         auto currentPatch = &m_patchLocationList[patchIndex];
         MOS_OS_CHK_NULL_RETURN(currentPatch);
 
-        if(currentPatch->cmdBo)
+        if (currentPatch->cmdBo == nullptr)
+            continue;
+
+        if (batchable)
+            m_submissionBatch.cmdBos.push_back(currentPatch->cmdBo);
+        else if (!submitQueued)
             mos_gem_bo_clear_relocs(currentPatch->cmdBo, 0);
     }
 
+    if (batchable && m_submitThread != 0)
+    {
+        SubmissionJob used;
+        CollectSubmissionBos(used, cmd_bo);
+        m_submissionBatch.usedBos.insert(m_submissionBatch.usedBos.end(), used.usedBos.begin(), used.usedBos.end());
+    }
+
+    if (batchable && m_submissionBatch.count >= m_maxBatchedSubmissions)
+    {
+        if (FlushSubmissionBatch() != MOS_STATUS_SUCCESS)
+        {
+            eStatus = MOS_STATUS_UNKNOWN;
+        }
+    }
+
     it = m_secondaryCmdBufs.begin();
     while(it != m_secondaryCmdBufs.end())
     {
@@ -1514,6 +1702,403 @@ finish:
     return eStatus;
 }
 
+MOS_STATUS GpuContextSpecificNext::BeginSubmissionBatch()
+{
+    MOS_OS_FUNCTION_ENTER;
+
+    m_submissionBatching = true;
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS GpuContextSpecificNext::EndSubmissionBatch()
+{
+    MOS_OS_FUNCTION_ENTER;
+
+    m_submissionBatching = false;
+    return FlushSubmissionBatch();
+}
+
+bool GpuContextSpecificNext::IsBatchableSubmission(
+    MOS_STREAM_HANDLE   streamState,
+    PMOS_COMMAND_BUFFER cmdBuffer,
+    bool                scalaEnabled,
+    bool                nullRendering)
+{
+    if (!m_submissionBatching || scalaEnabled || nullRendering || !m_secondaryCmdBufs.empty())
+    {
+        return false;
+    }
+
+    if (cmdBuffer->iSubmissionType & SUBMISSION_TYPE_MULTI_PIPE_MASK)
+    {
+        return false;
+    }
+
+    // The chained buffer is addressed by its pinned GPU VA
+    if (cmdBuffer->OsResource.bo == nullptr || !mos_gem_bo_is_softpin(cmdBuffer->OsResource.bo))
+    {
+        return false;
+    }
+
+    if (cmdBuffer->iRemaining < (int32_t)(MI_BATCHBUFFER_CHAIN_DW * sizeof(uint32_t)))
+    {
+        return false;
+    }
+
+    if (OSKMGetGpuNode(m_gpuContext) != I915_EXEC_RENDER &&
+        streamState->osCpInterface->IsTearDownHappen())
+    {
+        return false;
+    }
+
+    return true;
+}
+
+MOS_STATUS GpuContextSpecificNext::AddToSubmissionBatch(
+    PMOS_COMMAND_BUFFER cmdBuffer,
+    uint32_t           *chainSlot,
+    MOS_LINUX_CONTEXT  *i915Context,
+    uint32_t            execFlag,
+    int32_t             dr4)
+{
+    MOS_OS_CHK_NULL_RETURN(cmdBuffer);
+    MOS_OS_CHK_NULL_RETURN(chainSlot);
+
+    MOS_STATUS    eStatus = MOS_STATUS_SUCCESS;
+    MOS_LINUX_BO *cmdBo   = cmdBuffer->OsResource.bo;
+
+    if (m_submissionBatch.headBo != nullptr)
+    {
+        bool compatible = m_submissionBatch.i915Context == i915Context &&
+                          m_submissionBatch.execFlag == execFlag &&
+                          m_submissionBatch.dr4 == dr4;
+
+        // The head execbuffer must carry the chained buffer and its targets
+        if (compatible && mos_bo_add_softpin_target(m_submissionBatch.headBo, cmdBo, false) == 0)
+        {
+            uint64_t gpuAddr = cmdBo->offset64;
+            m_submissionBatch.tailSlot[1] = (uint32_t)(gpuAddr & 0xffffffff);
+            m_submissionBatch.tailSlot[2] = (uint32_t)((gpuAddr >> 32) & 0xffff);
+            m_submissionBatch.tailSlot[0] = MI_BATCHBUFFER_START_PPGTT;
+            m_submissionBatch.tailRes->Unlock(m_osContext);
+
+            m_submissionBatch.tailSlot = chainSlot;
+            m_submissionBatch.tailRes  = cmdBuffer->OsResource.pGfxResourceNext;
+            m_submissionBatch.count++;
+            return MOS_STATUS_SUCCESS;
+        }
+
+        eStatus = FlushSubmissionBatch();
+    }
+
+    m_submissionBatch.headBo      = cmdBo;
+    m_submissionBatch.headSize    = m_commandBufferSize;
+    m_submissionBatch.tailSlot    = chainSlot;
+    m_submissionBatch.tailRes     = cmdBuffer->OsResource.pGfxResourceNext;
+    m_submissionBatch.i915Context = i915Context;
+    m_submissionBatch.execFlag    = execFlag;
+    m_submissionBatch.dr4         = dr4;
+    m_submissionBatch.count       = 1;
+    m_submissionBatch.cmdBos.push_back(cmdBo);
+
+    return eStatus;
+}
+
+MOS_STATUS GpuContextSpecificNext::FlushSubmissionBatch()
+{
+    if (m_submissionBatch.headBo == nullptr)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
+
+    if (m_submissionBatch.tailRes)
+    {
+        m_submissionBatch.tailRes->Unlock(m_osContext);
+    }
+
+    SubmissionJob job;
+    job.cmdBo       = m_submissionBatch.headBo;
+    job.size        = m_submissionBatch.headSize;
+    job.i915Context = m_submissionBatch.i915Context;
+    job.execFlag    = m_submissionBatch.execFlag;
+    job.dr4         = m_submissionBatch.dr4;
+    job.relocBos.swap(m_submissionBatch.cmdBos);
+    job.usedBos.swap(m_submissionBatch.usedBos);
+    if (QueueSubmission(job) != 0)
+    {
+        MOS_OS_ASSERTMESSAGE("Batched command buffer submission failed!");
+        eStatus = MOS_STATUS_UNKNOWN;
+    }
+
+    m_submissionBatch.cmdBos.clear();
+    m_submissionBatch.usedBos.clear();
+    m_submissionBatch.headBo   = nullptr;
+    m_submissionBatch.headSize = 0;
+    m_submissionBatch.tailSlot = nullptr;
+    m_submissionBatch.tailRes  = nullptr;
+    m_submissionBatch.count    = 0;
+
+    return eStatus;
+}
+
+void GpuContextSpecificNext::CollectSubmissionBos(SubmissionJob &job, MOS_LINUX_BO *cmdBo)
+{
+    for (uint32_t patchIndex = 0; patchIndex < m_currentNumPatchLocations; patchIndex++)
+    {
+        if (m_patchLocationList[patchIndex].cmdBo)
+        {
+            job.relocBos.push_back(m_patchLocationList[patchIndex].cmdBo);
+        }
+    }
+
+    if (m_submitThread == 0)
+    {
+        return;
+    }
+
+    // everything the command buffer references, so waits on these bos
+    // cannot pass before the kernel got the submission
+    job.usedBos.push_back(cmdBo);
+    for (uint32_t i = 0; i < m_numAllocations; i++)
+    {
+        auto res = (PMOS_RESOURCE)m_allocationList[i].hAllocation;
+        if (res && res->bo && res->bo != cmdBo)
+        {
+            job.usedBos.push_back(res->bo);
+        }
+    }
+}
+
+int32_t GpuContextSpecificNext::QueueSubmission(SubmissionJob &job)
+{
+    if (m_submitThread == 0)
+    {
+        return ExecSubmission(job);
+    }
+
+    for (auto bo : job.usedBos)
+    {
+        mos_bo_reference(bo);
+        mos_gem_bo_mark_queued(bo);
+    }
+
+    pthread_mutex_lock(&m_submitMutex);
+    while (m_submitCount == m_submitQueueDepth)
+    {
+        pthread_cond_wait(&m_submitCond, &m_submitMutex);
+    }
+    auto &slot       = m_submitQueue[(m_submitHead + m_submitCount) % m_submitQueueDepth];
+    slot.cmdBo       = job.cmdBo;
+    slot.size        = job.size;
+    slot.i915Context = job.i915Context;
+    slot.execFlag    = job.execFlag;
+    slot.dr4         = job.dr4;
+    slot.relocBos.swap(job.relocBos);
+    slot.usedBos.swap(job.usedBos);
+    m_submitCount++;
+    pthread_cond_broadcast(&m_submitCond);
+    pthread_mutex_unlock(&m_submitMutex);
+
+    return 0;
+}
+
+int32_t GpuContextSpecificNext::ExecSubmission(SubmissionJob &job)
+{
+    int32_t ret = mos_gem_bo_context_exec2(job.cmdBo,
+        job.size,
+        job.i915Context,
+        nullptr,
+        0,
+        job.dr4,
+        job.execFlag,
+        nullptr);
+
+    for (auto bo : job.relocBos)
+    {
+        mos_gem_bo_clear_relocs(bo, 0);
+    }
+
+    for (auto bo : job.usedBos)
+    {
+        mos_gem_bo_mark_submitted(bo);
+        mos_bo_unreference(bo);
+    }
+
+    job.relocBos.clear();
+    job.usedBos.clear();
+    return ret;
+}
+
+void *GpuContextSpecificNext::SubmissionThread(void *context)
+{
+    auto gpuContext = static_cast<GpuContextSpecificNext *>(context);
+
+    pthread_mutex_lock(&gpuContext->m_submitMutex);
+    while (true)
+    {
+        while (gpuContext->m_submitCount == 0 && !gpuContext->m_submitStop)
+        {
+            pthread_cond_wait(&gpuContext->m_submitCond, &gpuContext->m_submitMutex);
+        }
+        if (gpuContext->m_submitCount == 0)
+        {
+            break;
+        }
+
+        SubmissionJob job;
+        auto &slot      = gpuContext->m_submitQueue[gpuContext->m_submitHead];
+        job.cmdBo       = slot.cmdBo;
+        job.size        = slot.size;
+        job.i915Context = slot.i915Context;
+        job.execFlag    = slot.execFlag;
+        job.dr4         = slot.dr4;
+        job.relocBos.swap(slot.relocBos);
+        job.usedBos.swap(slot.usedBos);
+        gpuContext->m_submitHead = (gpuContext->m_submitHead + 1) % m_submitQueueDepth;
+        gpuContext->m_submitCount--;
+        gpuContext->m_submitBusy = true;
+        pthread_cond_broadcast(&gpuContext->m_submitCond);
+        pthread_mutex_unlock(&gpuContext->m_submitMutex);
+
+        if (gpuContext->ExecSubmission(job) != 0)
+        {
+            MOS_OS_ASSERTMESSAGE("Command buffer submission failed!");
+        }
+
+        pthread_mutex_lock(&gpuContext->m_submitMutex);
+        gpuContext->m_submitBusy = false;
+        pthread_cond_broadcast(&gpuContext->m_submitCond);
+    }
+    pthread_mutex_unlock(&gpuContext->m_submitMutex);
+
+    return nullptr;
+}
+
+MOS_STATUS GpuContextSpecificNext::StartSubmissionThread()
+{
+    if (m_submitThread != 0)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    pthread_mutex_init(&m_submitMutex, nullptr);
+    pthread_cond_init(&m_submitCond, nullptr);
+    m_submitHead  = 0;
+    m_submitCount = 0;
+    m_submitBusy  = false;
+    m_submitStop  = false;
+
+    m_submitThread = MosUtilities::MosCreateThread((void *)SubmissionThread, this);
+    if (m_submitThread == 0)
+    {
+        pthread_cond_destroy(&m_submitCond);
+        pthread_mutex_destroy(&m_submitMutex);
+        return MOS_STATUS_UNKNOWN;
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
+void GpuContextSpecificNext::StopSubmissionThread()
+{
+    if (m_submitThread == 0)
+    {
+        return;
+    }
+
+    // the thread submits what is still queued before it exits
+    pthread_mutex_lock(&m_submitMutex);
+    m_submitStop = true;
+    pthread_cond_broadcast(&m_submitCond);
+    pthread_mutex_unlock(&m_submitMutex);
+
+    MosUtilities::MosWaitThread(m_submitThread);
+    m_submitThread = 0;
+
+    pthread_cond_destroy(&m_submitCond);
+    pthread_mutex_destroy(&m_submitMutex);
+}
+
+void GpuContextSpecificNext::DrainSubmissionQueue()
+{
+    if (m_submitThread == 0)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&m_submitMutex);
+    while (m_submitCount != 0 || m_submitBusy)
+    {
+        pthread_cond_wait(&m_submitCond, &m_submitMutex);
+    }
+    pthread_mutex_unlock(&m_submitMutex);
+}
+
+uint32_t GpuContextSpecificNext::SelectSiblingEngine()
+{
+    if (m_engineLoadTracker == nullptr || m_engineSiblingCount < 2)
+    {
+        return 0;
+    }
+
+    RetireEngineSubmissions(false);
+    return m_engineLoadTracker->SelectEngine(m_engineSiblings, m_engineSiblingCount);
+}
+
+void GpuContextSpecificNext::TrackEngineSubmission(const struct i915_engine_class_instance &engine)
+{
+    if (m_engineLoadTracker == nullptr)
+    {
+        return;
+    }
+
+    // submissions which never write the status tag retire by age
+    if (m_engineSubmissionCount == m_maxEngineSubmissions)
+    {
+        m_engineLoadTracker->OnRetire(m_engineSubmissions[m_engineSubmissionHead].engine);
+        m_engineSubmissionHead = (m_engineSubmissionHead + 1) % m_maxEngineSubmissions;
+        m_engineSubmissionCount--;
+    }
+
+    auto &entry  = m_engineSubmissions[(m_engineSubmissionHead + m_engineSubmissionCount) % m_maxEngineSubmissions];
+    entry.tag    = m_GPUStatusTag;
+    entry.engine = engine;
+    m_engineSubmissionCount++;
+    m_engineLoadTracker->OnSubmit(engine);
+}
+
+void GpuContextSpecificNext::RetireEngineSubmissions(bool all)
+{
+    if (m_engineLoadTracker == nullptr || m_engineSubmissionCount == 0)
+    {
+        return;
+    }
+
+    uint32_t completedTag = 0;
+    if (!all)
+    {
+        if (m_statusBufferResource == nullptr || m_statusBufferResource->pData == nullptr)
+        {
+            return;
+        }
+        completedTag = ((volatile MOS_GPU_STATUS_DATA *)m_statusBufferResource->pData)->GPUTag;
+    }
+
+    while (m_engineSubmissionCount > 0)
+    {
+        auto &entry = m_engineSubmissions[m_engineSubmissionHead];
+        if (!all && (int32_t)(completedTag - entry.tag) < 0)
+        {
+            break;
+        }
+        m_engineLoadTracker->OnRetire(entry.engine);
+        m_engineSubmissionHead = (m_engineSubmissionHead + 1) % m_maxEngineSubmissions;
+        m_engineSubmissionCount--;
+    }
+}
+
 void GpuContextSpecificNext::UnlockPendingOcaBuffers(PMOS_COMMAND_BUFFER cmdBuffer, PMOS_CONTEXT mosContext)
 {
     MOS_OS_CHK_NULL_NO_STATUS_RETURN(cmdBuffer);
@@ -1524,6 +2109,11 @@ void GpuContextSpecificNext::UnlockPendingOcaBuffers(PMOS_COMMAND_BUFFER cmdBuff
         // Will come here for UMD_OCA not being enabled case.
         return;
     }
+    if (!((MosOcaInterfaceSpecific*)pOcaInterface)->HasPendingOcaBuffers())
+    {
+        // No oca buffer attached to this submission, skip building the exec list info.
+        return;
+    }
 
     int count = 0;
     struct MOS_OCA_EXEC_LIST_INFO *info = nullptr;
@@ -1602,6 +2192,7 @@ int32_t GpuContextSpecificNext::SubmitPipeCommands(
         }
         queue = m_i915Context[1];
     }
+    MOS_OS_CHK_NULL_RETURN(queue);
 
     ret = mos_gem_bo_context_exec2(cmdBo,
                                   cmdBo->size,
@@ -1783,8 +2374,11 @@ MOS_STATUS GpuContextSpecificNext::AllocateGPUStatusBuf()
 
     MOS_OS_CHK_STATUS_RETURN(graphicsResource->Allocate(m_osContext, params));
 
+    // Keep the status buffer mapped write-combined for the context lifetime so
+    // tag polling reads GPU writes coherently without any lock/unlock.
     GraphicsResourceNext::LockParams lockParams;
     lockParams.m_writeRequest = true;
+    lockParams.m_uncached     = true;
     auto gpuStatusData       = (MOS_GPU_STATUS_DATA *)graphicsResource->Lock(m_osContext, lockParams);
     if (gpuStatusData == nullptr)
     {
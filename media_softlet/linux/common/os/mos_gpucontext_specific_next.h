@@ -30,6 +30,7 @@
 #include "mos_gpucontext_next.h"
 #include "mos_graphicsresource_specific_next.h"
 #include "mos_oca_interface_specific.h"
+#include "mos_engine_load_tracker.h"
 
 #define ENGINE_INSTANCE_SELECT_ENABLE_MASK                   0xFF
 #define ENGINE_INSTANCE_SELECT_COMPUTE_INSTANCE_SHIFT        16
@@ -160,6 +161,24 @@ public:
         PMOS_COMMAND_BUFFER cmdBuffer,
         bool                nullRendering);
 
+    //!
+    //! \brief    Begin a submission batch
+    //! \details  Single pipe command buffers submitted until EndSubmissionBatch
+    //!           are chained with MI_BATCH_BUFFER_START and executed by one
+    //!           execbuffer call. Each command buffer still writes its own
+    //!           status report, so per workload status is kept.
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    MOS_STATUS BeginSubmissionBatch() override;
+
+    //!
+    //! \brief    End a submission batch and submit the pending chain
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    MOS_STATUS EndSubmissionBatch() override;
+
     MOS_STATUS ResizeCommandBufferAndPatchList(
         uint32_t requestedCommandBufferSize,
         uint32_t requestedPatchListSize,
@@ -218,6 +237,8 @@ public:
 protected:
     //!
     //! \brief    Map resources with aux plane to aux table
+    //! \details  Also attaches the aux table BOs to cmd_bo and to every
+    //!           secondary command buffer of this submission
     //! \return   MOS_STATUS
     //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
     //!
@@ -277,6 +298,118 @@ protected:
 
     void UnlockPendingOcaBuffers(PMOS_COMMAND_BUFFER cmdBuffer, PMOS_CONTEXT mosContext);
 
+    //!
+    //! \brief    Record m_commandBufferSize in the context and node high-water marks
+    //! \return   void
+    //!
+    void UpdateCmdBufHighWaterMark();
+
+    //!
+    //! \brief    Check whether the command buffer can join the submission batch
+    //! \return   bool
+    //!           true if it can be chained, otherwise false
+    //!
+    bool IsBatchableSubmission(
+        MOS_STREAM_HANDLE   streamState,
+        PMOS_COMMAND_BUFFER cmdBuffer,
+        bool                scalaEnabled,
+        bool                nullRendering);
+
+    //!
+    //! \brief    Chain the command buffer to the pending submission batch
+    //! \details  The command buffer must end with a batch buffer end slot
+    //!           large enough to be patched into MI_BATCH_BUFFER_START
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    MOS_STATUS AddToSubmissionBatch(
+        PMOS_COMMAND_BUFFER cmdBuffer,
+        uint32_t           *chainSlot,
+        MOS_LINUX_CONTEXT  *i915Context,
+        uint32_t            execFlag,
+        int32_t             dr4);
+
+    //!
+    //! \brief    Submit the pending submission batch
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    MOS_STATUS FlushSubmissionBatch();
+
+    //! \brief    One execbuffer call, possibly handed to the submission thread
+    struct SubmissionJob
+    {
+        MOS_LINUX_BO               *cmdBo       = nullptr;
+        uint32_t                    size        = 0;
+        MOS_LINUX_CONTEXT          *i915Context = nullptr;
+        uint32_t                    execFlag    = 0;
+        int32_t                     dr4         = 0;
+        std::vector<MOS_LINUX_BO *> relocBos;  //!< relocations cleared after the submit
+        std::vector<MOS_LINUX_BO *> usedBos;   //!< referenced and marked queued until the submit
+    };
+
+    //!
+    //! \brief    Add the bos of the current patch and allocation lists to the job
+    //! \return   void
+    //!
+    void CollectSubmissionBos(SubmissionJob &job, MOS_LINUX_BO *cmdBo);
+
+    //!
+    //! \brief    Submit the job on the submission thread if running, else directly
+    //! \return   int32_t
+    //!           Return 0 if successful, otherwise error code
+    //!
+    int32_t QueueSubmission(SubmissionJob &job);
+
+    //!
+    //! \brief    Issue the execbuffer call of the job and release its bos
+    //! \return   int32_t
+    //!           Return 0 if successful, otherwise error code
+    //!
+    int32_t ExecSubmission(SubmissionJob &job);
+
+    //!
+    //! \brief    Start the submission thread
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    MOS_STATUS StartSubmissionThread();
+
+    //!
+    //! \brief    Submit the queued jobs and stop the submission thread
+    //! \return   void
+    //!
+    void StopSubmissionThread();
+
+    //!
+    //! \brief    Wait until every queued job reached the kernel
+    //! \return   void
+    //!
+    void DrainSubmissionQueue();
+
+    static void *SubmissionThread(void *context);
+
+    //!
+    //! \brief    Pick the least busy engine of the virtual engine siblings
+    //! \return   uint32_t
+    //!           Index in m_engineSiblings
+    //!
+    uint32_t SelectSiblingEngine();
+
+    //!
+    //! \brief    Account a submission placed on a specific engine in the load tracker
+    //! \return   void
+    //!
+    void TrackEngineSubmission(const struct i915_engine_class_instance &engine);
+
+    //!
+    //! \brief    Retire tracked submissions whose status tag completed
+    //! \param    [in] all
+    //!           Retire everything, used when the context goes away
+    //! \return   void
+    //!
+    void RetireEngineSubmissions(bool all);
+
 private:
     //! \brief    internal command buffer pool per gpu context
     std::vector<CommandBufferNext *> m_cmdBufPool;
@@ -290,6 +423,69 @@ private:
     //! \brief    initialized comamnd buffer size
     uint32_t m_commandBufferSize = 0;
 
+    //! \brief    largest command buffer size used by this context, new
+    //!           command buffers are allocated at least that large
+    uint32_t m_cmdBufHighWaterMark = 0;
+
+    //! \brief    idle command buffers made ready when the context is created
+    static constexpr uint32_t m_cmdBufPrewarmNum = 2;
+
+    //! \brief    Command buffers submitted between BeginSubmissionBatch and
+    //!           EndSubmissionBatch are chained
+    bool m_submissionBatching = false;
+
+    //! \brief    Chained command buffers not yet handed to the kernel
+    struct
+    {
+        MOS_LINUX_BO              *headBo      = nullptr;  //!< first command buffer, passed to execbuffer
+        uint32_t                   headSize    = 0;
+        uint32_t                  *tailSlot    = nullptr;  //!< BB_END slot of the last command buffer
+        GraphicsResourceNext      *tailRes     = nullptr;  //!< kept locked so tailSlot can be patched
+        MOS_LINUX_CONTEXT         *i915Context = nullptr;
+        uint32_t                   execFlag    = 0;
+        int32_t                    dr4         = 0;
+        uint32_t                   count       = 0;
+        std::vector<MOS_LINUX_BO *> cmdBos;                //!< relocations cleared after the submit
+        std::vector<MOS_LINUX_BO *> usedBos;               //!< bos to mark queued, submission thread only
+    } m_submissionBatch;
+
+    //! \brief    Max command buffers chained in one submission; kept well under
+    //!           MAX_CMD_BUF_NUM so a pending buffer is never recycled
+    static constexpr uint32_t m_maxBatchedSubmissions = 16;
+
+    //! \brief    Worker issuing execbuffer calls, 0 when submitting synchronously
+    MOS_THREADHANDLE m_submitThread = 0;
+
+    //! \brief    Protects the submission ring, m_submitCond signals any change
+    pthread_mutex_t m_submitMutex;
+    pthread_cond_t  m_submitCond;
+
+    //! \brief    Bounded ring of jobs waiting for the submission thread
+    static constexpr uint32_t m_submitQueueDepth = 8;
+    SubmissionJob   m_submitQueue[m_submitQueueDepth];
+    uint32_t        m_submitHead  = 0;
+    uint32_t        m_submitCount = 0;
+    bool            m_submitBusy  = false;  //!< a dequeued job is being submitted
+    bool            m_submitStop  = false;
+
+    //! \brief    Device wide engine occupancy, nullptr when load aware selection is off
+    EngineLoadTracker *m_engineLoadTracker = nullptr;
+
+    //! \brief    Physical engines of the virtual engine, exposed at engine index 1..n
+    struct i915_engine_class_instance m_engineSiblings[MAX_ENGINE_INSTANCE_NUM] = {};
+    uint32_t        m_engineSiblingCount = 0;
+
+    //! \brief    Submissions placed on a specific engine, retired by status tag
+    struct EngineSubmission
+    {
+        uint32_t                          tag;
+        struct i915_engine_class_instance engine;
+    };
+    static constexpr uint32_t m_maxEngineSubmissions = 16;
+    EngineSubmission m_engineSubmissions[m_maxEngineSubmissions] = {};
+    uint32_t        m_engineSubmissionHead  = 0;
+    uint32_t        m_engineSubmissionCount = 0;
+
     //! \brief    Flag to indicate current command buffer flused or not, if not
     //!           re-use it
     volatile bool m_cmdBufFlushed;
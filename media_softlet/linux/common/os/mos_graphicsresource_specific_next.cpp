@@ -193,6 +193,9 @@ MOS_STATUS GraphicsResourceSpecificNext::Allocate(OsContextNext* osContextPtr, C
         gmmParams.Flags.Info.LocalOnly = MEDIA_IS_SKU(pOsContextSpecific->GetSkuTable(), FtrLocalMemory);
     }
 
+    // Each resource owns its GMM_RESOURCE_INFO: it is freed with the resource and
+    // carries per-resource state (e.g. MMC mode/hint set later), so it cannot be
+    // shared between identical descriptors.
     GMM_RESOURCE_INFO*  gmmResourceInfoPtr = pOsContextSpecific->GetGmmClientContext()->CreateResInfoObject(&gmmParams);
 
     if (gmmResourceInfoPtr == nullptr)
@@ -292,6 +295,11 @@ MOS_STATUS GraphicsResourceSpecificNext::Allocate(OsContextNext* osContextPtr, C
         m_name     = params.m_name;
         m_pData    = (uint8_t*) boPtr->virt;
 
+        if (params.m_isPersistent)
+        {
+            mos_gem_bo_set_persistent(boPtr);
+        }
+
         m_gmmResInfo    = gmmResourceInfoPtr;
         m_mapped        = false;
         m_mmapOperation = MOS_MMAP_OPERATION_NONE;
@@ -0,0 +1,89 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     mos_init_trace_specific.h
+//! \brief    Timing of the driver initialization steps
+//!
+
+#ifndef __MOS_INIT_TRACE_SPECIFIC_H__
+#define __MOS_INIT_TRACE_SPECIFIC_H__
+
+#include "mos_utilities.h"
+#include "mos_util_debug.h"
+
+//!
+//! \brief  Initialization steps reported through EVENT_VA_INIT_STEP
+//!
+enum MOS_INIT_STEP
+{
+    MOS_INIT_STEP_TOTAL = 0,            //!< Whole vaInitialize
+    MOS_INIT_STEP_OS_UTILITIES,         //!< MOS utilities, user setting registration and OCA
+    MOS_INIT_STEP_DEVICE_CONTEXT,       //!< bufmgr, GMM client context and device tables
+    MOS_INIT_STEP_GFX_INFO,             //!< HWInfo_GetGfxInfo
+    MOS_INIT_STEP_HEAPS,                //!< VA object heaps
+    MOS_INIT_STEP_MEDIA_INTERFACES,     //!< HW info, caps and media interface factories
+    MOS_INIT_STEP_COMPONENTS,           //!< Decode/encode/VP component list
+    MOS_INIT_STEP_OUTPUT,               //!< X11 and DRI output libraries
+    MOS_INIT_STEP_SOFTLET,              //!< Softlet initialization from the legacy DDI
+};
+
+//!
+//! \class  MosInitStepTrace
+//! \brief  Emits a start event on construction and an end event carrying the
+//!         step and its duration in us on End() or destruction, whichever
+//!         comes first, so early error returns are still reported
+//!
+class MosInitStepTrace
+{
+public:
+    MosInitStepTrace(MOS_INIT_STEP step) : m_step((uint32_t)step), m_start(MosUtilities::MosGetCurTime())
+    {
+        MOS_TraceEventExt(EVENT_VA_INIT_STEP, EVENT_TYPE_START, &m_step, sizeof(m_step), nullptr, 0);
+    }
+
+    ~MosInitStepTrace()
+    {
+        End();
+    }
+
+    void End()
+    {
+        if (m_ended)
+        {
+            return;
+        }
+        m_ended = true;
+
+        uint32_t data[2] = {m_step, (uint32_t)(MosUtilities::MosGetCurTime() - m_start)};
+        MOS_TraceEventExt(EVENT_VA_INIT_STEP, EVENT_TYPE_END, data, sizeof(data), nullptr, 0);
+        MOS_OS_NORMALMESSAGE("Init step %u took %u us", data[0], data[1]);
+    }
+
+private:
+    uint32_t m_step  = 0;
+    uint64_t m_start = 0;
+    bool     m_ended = false;
+
+MEDIA_CLASS_DEFINE_END(MosInitStepTrace)
+};
+
+#endif // __MOS_INIT_TRACE_SPECIFIC_H__
@@ -988,6 +988,28 @@ MOS_STATUS MosInterface::SubmitCommandBuffer(
     return (gpuContext->SubmitCommandBuffer(streamState, cmdBuffer, nullRendering));
 }
 
+MOS_STATUS MosInterface::BeginSubmissionBatch(
+    MOS_STREAM_HANDLE streamState)
+{
+    MOS_OS_CHK_NULL_RETURN(streamState);
+
+    auto gpuContext = MosInterface::GetGpuContext(streamState, streamState->currentGpuContextHandle);
+    MOS_OS_CHK_NULL_RETURN(gpuContext);
+
+    return gpuContext->BeginSubmissionBatch();
+}
+
+MOS_STATUS MosInterface::EndSubmissionBatch(
+    MOS_STREAM_HANDLE streamState)
+{
+    MOS_OS_CHK_NULL_RETURN(streamState);
+
+    auto gpuContext = MosInterface::GetGpuContext(streamState, streamState->currentGpuContextHandle);
+    MOS_OS_CHK_NULL_RETURN(gpuContext);
+
+    return gpuContext->EndSubmissionBatch();
+}
+
 MOS_STATUS MosInterface::ResetCommandBuffer(
     MOS_STREAM_HANDLE     streamState,
     COMMAND_BUFFER_HANDLE cmdBuffer)
@@ -2148,7 +2170,7 @@ MOS_STATUS MosInterface::SkipResourceSync(
     return MOS_STATUS_SUCCESS;
 }
 
-MOS_STATUS SyncOnResource(
+MOS_STATUS MosInterface::SyncOnResource(
     MOS_STREAM_HANDLE streamState,
     MOS_RESOURCE_HANDLE resource,
     bool writeOperation,
@@ -2156,7 +2178,8 @@ MOS_STATUS SyncOnResource(
 {
     MOS_OS_FUNCTION_ENTER;
 
-    // No need to do sync on resource
+    // No need to do sync on resource: the kernel driver tracks the last writer of
+    // each BO at exec time and orders cross-engine access with implicit fences
 
     return MOS_STATUS_SUCCESS;
 }
@@ -2597,6 +2620,37 @@ MOS_STATUS MosInterface::GetGpuStatusBufferResource(
     return MOS_STATUS_SUCCESS;
 }
 
+bool MosInterface::IsGpuStatusTagReached(
+    MOS_STREAM_HANDLE  streamState,
+    GPU_CONTEXT_HANDLE gpuContext,
+    uint32_t           tag)
+{
+    MOS_OS_FUNCTION_ENTER;
+
+    MOS_OS_CHK_NULL_RETURN_VALUE(streamState, false);
+
+    auto gpuContextIns = MosInterface::GetGpuContext(streamState, gpuContext);
+    MOS_OS_CHK_NULL_RETURN_VALUE(gpuContextIns, false);
+
+    return gpuContextIns->IsTagReached(tag);
+}
+
+MOS_STATUS MosInterface::WaitForGpuStatusTag(
+    MOS_STREAM_HANDLE  streamState,
+    GPU_CONTEXT_HANDLE gpuContext,
+    uint32_t           tag,
+    uint32_t           timeoutUs)
+{
+    MOS_OS_FUNCTION_ENTER;
+
+    MOS_OS_CHK_NULL_RETURN(streamState);
+
+    auto gpuContextIns = MosInterface::GetGpuContext(streamState, gpuContext);
+    MOS_OS_CHK_NULL_RETURN(gpuContextIns);
+
+    return gpuContextIns->WaitForTag(tag, timeoutUs);
+}
+
 GMM_CLIENT_CONTEXT *MosInterface::GetGmmClientContext(
     MOS_STREAM_HANDLE streamState)
 {
@@ -301,6 +301,15 @@ public:
         return m_ocaDumpExecListInfoEnabled;
     }
 
+    //!
+    //! \brief  return whether any oca buffer is waiting for UnlockPendingOcaBuffers.
+    //!
+    bool HasPendingOcaBuffers()
+    {
+        MosOcaAutoLock lock(m_mutexForOcaBufPool);
+        return !m_PendingOcaBuffersToUnlock.empty();
+    }
+
     static MosOcaInterface& GetInstance();
     
     static uint32_t IncreaseSize(uint32_t cmdBufSize);
@@ -52,5 +52,47 @@ MOS_STATUS MosUserSetting::InitMosUserSettingSpecific(MediaUserSettingSharedPtr
         0,
         true); //"Enable VM Bind."
 
+    DeclareUserSettingKey(
+        userSettingPtr,
+        __MEDIA_USER_FEATURE_VALUE_ENABLE_ASYNC_BO_DESTROY,
+        MediaUserSetting::Group::Device,
+        0,
+        true); //"Free buffer objects on a background thread."
+
+    DeclareUserSettingKey(
+        userSettingPtr,
+        __MEDIA_USER_FEATURE_VALUE_ENABLE_ASYNC_SUBMISSION,
+        MediaUserSetting::Group::Device,
+        0,
+        true); //"Issue execbuffer calls from a per GPU context submission thread."
+
+    DeclareUserSettingKey(
+        userSettingPtr,
+        __MEDIA_USER_FEATURE_VALUE_ENABLE_LOAD_AWARE_ENGINE_SELECTION,
+        MediaUserSetting::Group::Device,
+        0,
+        true); //"Place single pipe VCS/VECS submissions on the least busy engine."
+
+    DeclareUserSettingKey(
+        userSettingPtr,
+        __MEDIA_USER_FEATURE_VALUE_HW_SWIZZLE_THRESHOLD,
+        MediaUserSetting::Group::Device,
+        0x800000,
+        true); //"Surface size in bytes from which CPU access to tiled surfaces is detiled on the GPU, 0 to disable."
+
+    DeclareUserSettingKey(
+        userSettingPtr,
+        __MEDIA_USER_FEATURE_VALUE_DMABUF_IMPORT_CACHE_ENTRIES,
+        MediaUserSetting::Group::Device,
+        16,
+        true); //"Number of imported DMA-BUF buffer objects kept for reuse, 0 to disable."
+
+    DeclareUserSettingKey(
+        userSettingPtr,
+        __MEDIA_USER_FEATURE_VALUE_SHARE_DEVICE_CONTEXT,
+        MediaUserSetting::Group::Device,
+        0,
+        true); //"Share the MOS device context between VADisplays opened on the same DRM device in a process."
+
     return MOS_STATUS_SUCCESS;
 }
@@ -26,11 +26,192 @@
 
 #include "mos_vma.h"
 
+/* Holes are kept in two structures: an address ordered treap to find the
+ * neighbours of a freed range, and segregated free lists indexed by
+ * floor(log2(size)) to find a fitting hole. Both give O(log n) alloc and
+ * free instead of walking every hole.
+ */
+
+static uint32_t
+mos_vma_size_class(uint64_t size)
+{
+    assert(size > 0);
+    return 63 - __builtin_clzll(size);
+}
+
+static uint32_t
+mos_vma_heap_next_priority(mos_vma_heap *heap)
+{
+    /* xorshift32, good enough to keep the treap balanced */
+    uint32_t x = heap->seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    heap->seed = x;
+    return x;
+}
+
+static mos_vma_hole *
+mos_vma_treap_rotate_right(mos_vma_hole *node)
+{
+    mos_vma_hole *left = node->left;
+    node->left = left->right;
+    left->right = node;
+    return left;
+}
+
+static mos_vma_hole *
+mos_vma_treap_rotate_left(mos_vma_hole *node)
+{
+    mos_vma_hole *right = node->right;
+    node->right = right->left;
+    right->left = node;
+    return right;
+}
+
+static mos_vma_hole *
+mos_vma_treap_insert(mos_vma_hole *root, mos_vma_hole *hole)
+{
+    if (root == nullptr)
+        return hole;
+
+    if (hole->offset < root->offset) {
+        root->left = mos_vma_treap_insert(root->left, hole);
+        if (root->left->priority > root->priority)
+            root = mos_vma_treap_rotate_right(root);
+    } else {
+        root->right = mos_vma_treap_insert(root->right, hole);
+        if (root->right->priority > root->priority)
+            root = mos_vma_treap_rotate_left(root);
+    }
+    return root;
+}
+
+/* Join two treaps where every offset in low is below every offset in high */
+static mos_vma_hole *
+mos_vma_treap_join(mos_vma_hole *low, mos_vma_hole *high)
+{
+    if (low == nullptr)
+        return high;
+    if (high == nullptr)
+        return low;
+
+    if (low->priority > high->priority) {
+        low->right = mos_vma_treap_join(low->right, high);
+        return low;
+    } else {
+        high->left = mos_vma_treap_join(low, high->left);
+        return high;
+    }
+}
+
+static mos_vma_hole *
+mos_vma_treap_remove(mos_vma_hole *root, mos_vma_hole *hole)
+{
+    if (root == nullptr)
+        return nullptr;
+
+    if (hole->offset < root->offset)
+        root->left = mos_vma_treap_remove(root->left, hole);
+    else if (hole->offset > root->offset)
+        root->right = mos_vma_treap_remove(root->right, hole);
+    else
+        return mos_vma_treap_join(root->left, root->right);
+
+    return root;
+}
+
+/* Hole with the highest offset <= offset */
+static mos_vma_hole *
+mos_vma_heap_find_le(mos_vma_heap *heap, uint64_t offset)
+{
+    mos_vma_hole *node = heap->root, *found = nullptr;
+
+    while (node) {
+        if (node->offset <= offset) {
+            found = node;
+            node = node->right;
+        } else {
+            node = node->left;
+        }
+    }
+    return found;
+}
+
+/* Hole with the lowest offset > offset */
+static mos_vma_hole *
+mos_vma_heap_find_gt(mos_vma_heap *heap, uint64_t offset)
+{
+    mos_vma_hole *node = heap->root, *found = nullptr;
+
+    while (node) {
+        if (node->offset > offset) {
+            found = node;
+            node = node->left;
+        } else {
+            node = node->right;
+        }
+    }
+    return found;
+}
+
+static void
+mos_vma_heap_link_hole(mos_vma_heap *heap, mos_vma_hole *hole)
+{
+    list_add(&hole->link, &heap->size_class[mos_vma_size_class(hole->size)]);
+}
+
+/* Move a hole to the free list matching its new size */
+static void
+mos_vma_heap_resize_hole(mos_vma_heap *heap, mos_vma_hole *hole, uint64_t size)
+{
+    if (mos_vma_size_class(size) != mos_vma_size_class(hole->size)) {
+        list_del(&hole->link);
+        hole->size = size;
+        mos_vma_heap_link_hole(heap, hole);
+    } else {
+        hole->size = size;
+    }
+}
+
+static mos_vma_hole *
+mos_vma_heap_add_hole(mos_vma_heap *heap, uint64_t offset, uint64_t size)
+{
+    mos_vma_hole *hole = (mos_vma_hole*)calloc(1, sizeof(*hole));
+    if (hole == nullptr) {
+        assert(hole);
+        return nullptr;
+    }
+
+    hole->offset = offset;
+    hole->size = size;
+    hole->priority = mos_vma_heap_next_priority(heap);
+    heap->root = mos_vma_treap_insert(heap->root, hole);
+    mos_vma_heap_link_hole(heap, hole);
+    heap->hole_count++;
+    return hole;
+}
+
+static void
+mos_vma_heap_remove_hole(mos_vma_heap *heap, mos_vma_hole *hole)
+{
+    heap->root = mos_vma_treap_remove(heap->root, hole);
+    list_del(&hole->link);
+    heap->hole_count--;
+    free(hole);
+}
+
 void
 mos_vma_heap_init(mos_vma_heap *heap, uint64_t start, uint64_t size)
 {
     assert(heap);
-    list_inithead(&heap->holes);
+    for (uint32_t i = 0; i < MOS_VMA_SIZE_CLASS_COUNT; i++)
+        list_inithead(&heap->size_class[i]);
+    heap->root = nullptr;
+    heap->free_size = 0;
+    heap->hole_count = 0;
+    heap->seed = 0x9e3779b9u;
+
     mos_vma_heap_free(heap, start, size);
 
     /* Default to using high addresses */
@@ -41,100 +222,151 @@ void
 mos_vma_heap_finish(mos_vma_heap *heap)
 {
     assert(heap);
-    list_for_each_entry_safe(mos_vma_hole, hole, &heap->holes, link)
+    for (uint32_t i = 0; i < MOS_VMA_SIZE_CLASS_COUNT; i++)
     {
-        free(hole);
+        list_for_each_entry_safe(mos_vma_hole, hole, &heap->size_class[i], link)
+        {
+            free(hole);
+        }
+        list_inithead(&heap->size_class[i]);
     }
+    heap->root = nullptr;
+    heap->free_size = 0;
+    heap->hole_count = 0;
 }
 
 #ifdef _DEBUG
+static uint64_t
+mos_vma_treap_validate(mos_vma_hole *node, uint64_t *prev_end, bool *has_prev)
+{
+    if (node == nullptr)
+        return 0;
+
+    uint64_t count = mos_vma_treap_validate(node->left, prev_end, has_prev);
+
+    assert(node->offset > 0);
+    assert(node->size > 0);
+    /* Only the top-most hole may overflow, and only to 0, i.e. 2^64 */
+    assert(node->size + node->offset == 0 ||
+            node->size + node->offset > node->offset);
+    assert(node->left == nullptr || node->left->priority <= node->priority);
+    assert(node->right == nullptr || node->right->priority <= node->priority);
+    /* If the previous hole ends at our offset we failed to join holes
+     * during a mos_vma_heap_free.
+     */
+    assert(!*has_prev || *prev_end < node->offset);
+
+    *prev_end = node->offset + node->size;
+    *has_prev = true;
+
+    return count + 1 + mos_vma_treap_validate(node->right, prev_end, has_prev);
+}
+
 static void
 mos_vma_heap_validate(mos_vma_heap *heap)
 {
     assert(heap);
-    uint64_t prev_offset = 0;
+    uint64_t prev_end = 0;
+    bool has_prev = false;
+    uint64_t listed = 0;
 
-    list_for_each_entry(mos_vma_hole, hole, &heap->holes, link)
+    for (uint32_t i = 0; i < MOS_VMA_SIZE_CLASS_COUNT; i++)
     {
-        assert(hole->offset > 0);
-        assert(hole->size > 0);
-
-        if (&hole->link == heap->holes.next)
+        list_for_each_entry(mos_vma_hole, hole, &heap->size_class[i], link)
         {
-            /* This must be the top-most hole.  Assert that, if it overflows, it
-            * overflows to 0, i.e. 2^64.
-            */
-            assert(hole->size + hole->offset == 0 ||
-                    hole->size + hole->offset > hole->offset);
+            assert(mos_vma_size_class(hole->size) == i);
+            listed++;
         }
-        else
-        {
-            /* This is not the top-most hole so it must not overflow and, in
-            * fact, must be strictly lower than the top-most hole.  If
-            * hole->size + hole->offset == prev_offset, then we failed to join
-            * holes during a mos_vma_heap_free.
-            */
-            assert(hole->size + hole->offset > hole->offset &&
-                    hole->size + hole->offset < prev_offset);
-        }
-        prev_offset = hole->offset;
-   }
+    }
+
+    assert(mos_vma_treap_validate(heap->root, &prev_end, &has_prev) == heap->hole_count);
+    assert(listed == heap->hole_count);
 }
 #else
 #define mos_vma_heap_validate(heap)
 #endif
 
 static void
-mos_vma_hole_alloc(mos_vma_hole *hole, uint64_t offset, uint64_t size)
+mos_vma_hole_alloc(mos_vma_heap *heap, mos_vma_hole *hole, uint64_t offset, uint64_t size)
 {
     assert(hole);
     assert(hole->offset <= offset);
     assert(hole->size >= offset - hole->offset + size);
 
+    heap->free_size -= size;
+
     if (offset == hole->offset && size == hole->size) {
         /* Just get rid of the hole. */
-        list_del(&hole->link);
-        free(hole);
+        mos_vma_heap_remove_hole(heap, hole);
         return;
     }
 
     uint64_t waste = (hole->size - size) - (offset - hole->offset);
     if (waste == 0) {
         /* We allocated at the top.  Shrink the hole down. */
-        hole->size -= size;
+        mos_vma_heap_resize_hole(heap, hole, hole->size - size);
         return;
     }
 
     if (offset == hole->offset) {
-        /* We allocated at the bottom. Shrink the hole up. */
+        /* We allocated at the bottom. Shrink the hole up. The treap stays
+        * ordered since holes never overlap.
+        */
         hole->offset += size;
-        hole->size -= size;
+        mos_vma_heap_resize_hole(heap, hole, hole->size - size);
         return;
     }
 
     /* We allocated in the middle.  We need to split the old hole into two
     * holes, one high and one low.
     */
-    mos_vma_hole *high_hole = (mos_vma_hole*)calloc(1, sizeof(*hole));
-    if(high_hole == nullptr)
+    if (mos_vma_heap_add_hole(heap, offset + size, waste) == nullptr)
     {
-        assert(high_hole);
-
-        return;
+        heap->free_size -= waste;
     }
 
-    high_hole->offset = offset + size;
-    high_hole->size = waste;
-
     /* Adjust the hole to be the amount of space left at he bottom of the
     * original hole.
     */
-    hole->size = offset - hole->offset;
+    mos_vma_heap_resize_hole(heap, hole, offset - hole->offset);
+}
 
-    /* Place the new hole before the old hole so that the list is in order
-    * from high to low.
-    */
-    list_addtail(&high_hole->link, &hole->link);
+/* Returns the aligned offset of a size bytes chunk in hole, or 0 if it does not fit */
+static uint64_t
+mos_vma_hole_fit(mos_vma_heap *heap, mos_vma_hole *hole, uint64_t size, uint64_t alignment)
+{
+    if (size > hole->size)
+        return 0;
+
+    if (heap->alloc_high) {
+        /* Compute the offset as the highest address where a chunk of the
+        * given size can be without going over the top of the hole.
+        *
+        * This calculation is known to not overflow because we know that
+        * hole->size + hole->offset can only overflow to 0 and size > 0.
+        */
+        uint64_t offset = (hole->size - size) + hole->offset;
+
+        /* Align the offset.  We align down and not up because we are
+        * allocating from the top of the hole and not the bottom.
+        */
+        offset = (offset / alignment) * alignment;
+
+        return offset < hole->offset ? 0 : offset;
+    } else {
+        uint64_t offset = hole->offset;
+
+        /* Align the offset */
+        uint64_t misalign = offset % alignment;
+        if (misalign) {
+            uint64_t pad = alignment - misalign;
+            if (pad > hole->size - size)
+                return 0;
+
+            offset += pad;
+        }
+        return offset;
+    }
 }
 
 uint64_t
@@ -147,52 +379,34 @@ mos_vma_heap_alloc(mos_vma_heap *heap, uint64_t size, uint64_t alignment)
 
     mos_vma_heap_validate(heap);
 
-    if (heap->alloc_high) {
-        list_for_each_entry_safe(mos_vma_hole, hole, &heap->holes, link)
-        {
-            if (size > hole->size)
-                continue;
-
-            /* Compute the offset as the highest address where a chunk of the
-            * given size can be without going over the top of the hole.
-            *
-            * This calculation is known to not overflow because we know that
-            * hole->size + hole->offset can only overflow to 0 and size > 0.
-            */
-            uint64_t offset = (hole->size - size) + hole->offset;
-
-            /* Align the offset.  We align down and not up because we are
-            * allocating from the top of the hole and not the bottom.
-            */
-            offset = (offset / alignment) * alignment;
-
-            if (offset < hole->offset)
-            continue;
+    /* Best fit within the request's own size class, where holes may or may
+    * not fit depending on their alignment. In the bigger classes the first
+    * hole that fits is taken, they are all larger than the request anyway.
+    */
+    for (uint32_t i = mos_vma_size_class(size); i < MOS_VMA_SIZE_CLASS_COUNT; i++)
+    {
+        mos_vma_hole *best = nullptr;
+        uint64_t best_offset = 0;
+        bool exact_class = (i == mos_vma_size_class(size));
 
-            mos_vma_hole_alloc(hole, offset, size);
-            mos_vma_heap_validate(heap);
-            return offset;
-        }
-    } else {
-        list_for_each_entry_safe_rev(mos_vma_hole, hole, &heap->holes, link) {
-            if (size > hole->size)
+        list_for_each_entry(mos_vma_hole, hole, &heap->size_class[i], link)
+        {
+            uint64_t offset = mos_vma_hole_fit(heap, hole, size, alignment);
+            if (offset == 0)
                 continue;
 
-            uint64_t offset = hole->offset;
-
-            /* Align the offset */
-            uint64_t misalign = offset % alignment;
-            if (misalign) {
-                uint64_t pad = alignment - misalign;
-                if (pad > hole->size - size)
-                    continue;
-
-                offset += pad;
+            if (best == nullptr || hole->size < best->size) {
+                best = hole;
+                best_offset = offset;
             }
+            if (!exact_class || best->size == size)
+                break;
+        }
 
-            mos_vma_hole_alloc(hole, offset, size);
+        if (best) {
+            mos_vma_hole_alloc(heap, best, best_offset, size);
             mos_vma_heap_validate(heap);
-            return offset;
+            return best_offset;
         }
     }
 
@@ -217,26 +431,15 @@ mos_vma_heap_alloc_addr(mos_vma_heap *heap, uint64_t offset, uint64_t size)
     */
     assert(offset + size == 0 || offset + size > offset);
 
-    /* Find the hole if one exists. */
-    list_for_each_entry_safe(mos_vma_hole, hole, &heap->holes, link)
-    {
-        if (hole->offset > offset)
-            continue;
-
-        /* Holes are ordered high-to-low so the first hole we find with
-        * hole->offset <= is our hole.  If it's not big enough to contain the
-        * requested range, then the allocation fails.
-        */
-        assert(hole->offset <= offset);
-        if (hole->size < offset - hole->offset + size)
-            return false;
-
-        mos_vma_hole_alloc(hole, offset, size);
-        return true;
-    }
+    /* The only hole which can contain the range is the one starting at or
+    * right below offset.
+    */
+    mos_vma_hole *hole = mos_vma_heap_find_le(heap, offset);
+    if (hole == nullptr || hole->size < offset - hole->offset + size)
+        return false;
 
-    /* We didn't find a suitable hole */
-    return false;
+    mos_vma_hole_alloc(heap, hole, offset, size);
+    return true;
 }
 
 void
@@ -259,15 +462,8 @@ mos_vma_heap_free(mos_vma_heap *heap, uint64_t offset, uint64_t size)
     mos_vma_heap_validate(heap);
 
     /* Find immediately higher and lower holes if they exist. */
-    mos_vma_hole *high_hole = NULL, *low_hole = NULL;
-    list_for_each_entry(mos_vma_hole, hole, &heap->holes, link)
-    {
-        if (hole->offset <= offset) {
-            low_hole = hole;
-            break;
-        }
-        high_hole = hole;
-    }
+    mos_vma_hole *low_hole = mos_vma_heap_find_le(heap, offset);
+    mos_vma_hole *high_hole = mos_vma_heap_find_gt(heap, offset);
 
     if (high_hole)
     {
@@ -282,34 +478,55 @@ mos_vma_heap_free(mos_vma_heap *heap, uint64_t offset, uint64_t size)
     }
     bool low_adjacent = low_hole && low_hole->offset + low_hole->size == offset;
 
+    heap->free_size += size;
+
     if (low_adjacent && high_adjacent) {
         /* Merge the two holes */
-        low_hole->size += size + high_hole->size;
-        list_del(&high_hole->link);
-        free(high_hole);
+        uint64_t merged = low_hole->size + size + high_hole->size;
+        mos_vma_heap_remove_hole(heap, high_hole);
+        mos_vma_heap_resize_hole(heap, low_hole, merged);
     } else if (low_adjacent) {
         /* Merge into the low hole */
-        low_hole->size += size;
+        mos_vma_heap_resize_hole(heap, low_hole, low_hole->size + size);
     } else if (high_adjacent) {
         /* Merge into the high hole */
         high_hole->offset = offset;
-        high_hole->size += size;
+        mos_vma_heap_resize_hole(heap, high_hole, high_hole->size + size);
     } else {
         /* Neither hole is adjacent; make a new one */
-        mos_vma_hole *hole = (mos_vma_hole*)calloc(1, sizeof(*hole));
-        assert(hole);
-        if(hole)
+        if (mos_vma_heap_add_hole(heap, offset, size) == nullptr)
         {
-            hole->offset = offset;
-            hole->size = size;
-
-            /* Add it after the high hole so we maintain high-to-low ordering */
-            if (high_hole)
-                list_add(&hole->link, &high_hole->link);
-            else
-                list_add(&hole->link, &heap->holes);
+            heap->free_size -= size;
         }
     }
 
     mos_vma_heap_validate(heap);
 }
+
+void
+mos_vma_heap_get_stats(mos_vma_heap *heap, mos_vma_heap_stats *stats)
+{
+    assert(heap);
+    assert(stats);
+
+    stats->free_size     = heap->free_size;
+    stats->hole_count    = heap->hole_count;
+    stats->largest_hole  = 0;
+    stats->fragmentation = 0;
+
+    for (int32_t i = MOS_VMA_SIZE_CLASS_COUNT - 1; i >= 0; i--)
+    {
+        list_for_each_entry(mos_vma_hole, hole, &heap->size_class[i], link)
+        {
+            if (hole->size > stats->largest_hole)
+                stats->largest_hole = hole->size;
+        }
+        if (stats->largest_hole)
+            break;
+    }
+
+    if (stats->free_size)
+    {
+        stats->fragmentation = (uint32_t)(1000 - (stats->largest_hole * 1000) / stats->free_size);
+    }
+}
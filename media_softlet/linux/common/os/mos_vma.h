@@ -37,8 +37,31 @@
 extern "C" {
 #endif
 
+#define MOS_VMA_SIZE_CLASS_COUNT 64
+
+typedef struct _mos_vma_hole {
+   /** Link in the free list of the hole's size class */
+   struct list_head link;
+
+   /** Address ordered treap used to find neighbours on free */
+   struct _mos_vma_hole *left;
+   struct _mos_vma_hole *right;
+   uint32_t priority;
+
+   uint64_t offset;
+   uint64_t size;
+} mos_vma_hole;
+
 typedef struct _mos_vma_heap {
-   struct list_head holes;
+   /** Segregated free lists, hole of size s is in list floor(log2(s)) */
+   struct list_head size_class[MOS_VMA_SIZE_CLASS_COUNT];
+
+   /** Root of the treap holding all holes ordered by offset */
+   mos_vma_hole *root;
+
+   uint64_t free_size;
+   uint64_t hole_count;
+   uint32_t seed;
 
    /** If true, util_vma_heap_alloc will prefer high addresses
     *
@@ -47,11 +70,12 @@ typedef struct _mos_vma_heap {
    bool alloc_high;
 } mos_vma_heap;
 
-typedef struct _mos_vma_hole {
-   struct list_head link;
-   uint64_t offset;
-   uint64_t size;
-} mos_vma_hole;
+typedef struct _mos_vma_heap_stats {
+   uint64_t free_size;      //!< Total free address space in bytes
+   uint64_t largest_hole;   //!< Size of the largest hole in bytes
+   uint64_t hole_count;     //!< Number of holes
+   uint32_t fragmentation;  //!< 1000 * (1 - largest_hole / free_size), 0 means not fragmented
+} mos_vma_heap_stats;
 
 //!
 //! \brief  Initialize vma heap
@@ -120,6 +144,18 @@ bool mos_vma_heap_alloc_addr(mos_vma_heap *heap, uint64_t addr, uint64_t size);
 //!
 void mos_vma_heap_free(mos_vma_heap *heap, uint64_t offset, uint64_t size);
 
+//!
+//! \brief  Get the fragmentation statistics of a vma heap
+//!
+//! \param  [in] heap
+//!         Pointer to vma heap
+//! \param  [out] stats
+//!         Statistics of the heap
+//!
+//! \return void
+//!
+void mos_vma_heap_get_stats(mos_vma_heap *heap, mos_vma_heap_stats *stats);
+
 #ifdef __cplusplus
 } /* extern C */
 #endif
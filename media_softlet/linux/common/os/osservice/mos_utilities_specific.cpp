@@ -40,6 +40,7 @@
 #include <sys/types.h>
 #include <sys/sem.h>
 #include <sys/mman.h>
+#include <sched.h>
 #include "mos_compat.h" // libc variative definitions: backtrace
 #include "mos_user_setting.h"
 #include "mos_utilities_specific.h"
@@ -527,6 +528,39 @@ void MosUtilities::MosSleep(uint32_t mSec)
     usleep(1000 * mSec);
 }
 
+bool MosUtilities::MosWaitForCounter(volatile uint32_t *counter, uint32_t target, uint32_t timeoutUs)
+{
+    const uint32_t spinCount  = 64;
+    const uint32_t maxSleepUs = 1000;
+
+    if (counter == nullptr)
+    {
+        return false;
+    }
+
+    uint64_t start   = MosGetCurTime();
+    uint32_t spins   = 0;
+    uint32_t sleepUs = 1;
+    while ((int32_t)(*counter - target) < 0)
+    {
+        if (MosGetCurTime() - start >= timeoutUs)
+        {
+            return false;
+        }
+        if (spins < spinCount)
+        {
+            spins++;
+            sched_yield();
+        }
+        else
+        {
+            usleep(sleepUs);
+            sleepUs = (sleepUs * 2 > maxSleepUs) ? maxSleepUs : sleepUs * 2;
+        }
+    }
+    return true;
+}
+
 //User Feature
  MOS_UF_KEY* MosUtilitiesSpecificNext::UserFeatureFindKey(MOS_PUF_KEYLIST pKeyList, char * const pcKeyName)
 {
@@ -1578,12 +1612,12 @@ MOS_STATUS MosUtilities::MosUninitializeReg(RegBufferMap &regBufferMap)
         regStream.open(USER_FEATURE_FILE_NEXT, std::ios::out | std::ios::trunc);
         if (regStream.good())
         {
-            for(auto pair: regBufferMap)
+            for(auto &pair: regBufferMap)
             {
                 regStream << pair.first << "\n";
 
-                auto &keys = regBufferMap[pair.first];
-                for (auto key: keys)
+                auto &keys = pair.second;
+                for (auto &key: keys)
                 {
                     auto name = key.first;
                     regStream << key.first << "=" << key.second << "\n";
@@ -1699,7 +1733,7 @@ MOS_STATUS MosUtilities::MosGetRegValue(
 
     try
     {
-        auto keys = regBufferMap[keyHandle];
+        auto &keys = regBufferMap[keyHandle];
         auto it = keys.find(valueName);
         if (it == keys.end())
         {
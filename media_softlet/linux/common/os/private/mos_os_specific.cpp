@@ -2116,6 +2116,8 @@ MOS_STATUS Mos_Specific_CreateGpuContext(
             MOS_OS_CHK_STATUS_RETURN(gpuContextSpecific->Init(gpuContextMgr->GetOsContext(), osInterface->osStreamState, createOption));
             gpuContextSpecific->SetGpuContext(mosGpuCxt);
             osInterface->m_GpuContextHandleMap[mosGpuCxt] = gpuContextSpecific->GetGpuContextHandle();
+            // Keep legacy interface in sync with the multi-pipe submission mode probed by the context
+            osInterface->bGucSubmission = osInterface->osStreamState->bGucSubmission;
         }
 
         return MOS_STATUS_SUCCESS;
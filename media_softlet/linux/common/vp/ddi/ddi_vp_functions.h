@@ -260,7 +260,10 @@ public:
 
     //!
     //! \brief  Send decode buffers to the server
-    //! \details    Buffers are automatically destroyed afterwards
+    //! \details    Buffers are automatically destroyed afterwards.
+    //!             All pipeline buffers of one call are layers of the one render target.
+    //!             Independent jobs use one Begin/Render/EndPicture each; EndPicture does
+    //!             not wait for the GPU, so a batch needs only one final vaSyncSurface.
     //! \param  [in] ctx
     //!         Pointer to VA driver context
     //! \param  [in] context